@@ -0,0 +1,311 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_gamma_den_0 = {
+	16,
+	4,
+	0,
+	{ 944, 170, 217, 94, 109, 5 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_gamma_den_1 = {
+	17,
+	4,
+	0,
+	{ 24, 17, 78, 481, 624, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_gamma_den_2 = {
+	18,
+	3,
+	0,
+	{ 384, 216, 863, 902, 631, 298 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[7];
+} const_gamma_den_3 = {
+	19,
+	2,
+	0,
+	{ 688, 114, 18, 159, 933, 840, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[7];
+} const_gamma_den_4 = {
+	21,
+	0,
+	0,
+	{ 96, 76, 697, 520, 979, 664, 181 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[7];
+} const_gamma_den_5 = {
+	20,
+	0,
+	0,
+	{ 976, 802, 544, 699, 381, 637, 83 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[7];
+} const_gamma_den_6 = {
+	19,
+	1,
+	0,
+	{ 776, 544, 733, 339, 958, 893, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_gamma_den_7 = {
+	17,
+	2,
+	0,
+	{ 768, 695, 101, 543, 446, 77 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[7];
+} const_gamma_den_8 = {
+	19,
+	0,
+	0,
+	{ 456, 583, 246, 697, 980, 634, 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_gamma_den_9 = {
+	18,
+	0,
+	0,
+	{ 346, 35, 275, 109, 19, 276 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_gamma_den_10 = {
+	17,
+	0,
+	0,
+	{ 745, 859, 86, 535, 600, 37 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_gamma_den_11 = {
+	16,
+	0,
+	0,
+	{ 525, 430, 851, 823, 154, 4 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_den_12 = {
+	15,
+	0,
+	0,
+	{ 531, 802, 999, 100, 373 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_den_13 = {
+	14,
+	0,
+	0,
+	{ 881, 869, 611, 188, 27 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[4];
+} const_gamma_den_14 = {
+	12,
+	1,
+	0,
+	{ 873, 838, 971, 159 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[4];
+} const_gamma_den_15 = {
+	10,
+	1,
+	0,
+	{ 885, 966, 528, 7 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[4];
+} const_gamma_den_16 = {
+	10,
+	0,
+	0,
+	{ 686, 167, 792, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[3];
+} const_gamma_den_17 = {
+	8,
+	0,
+	0,
+	{ 796, 721, 79 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[3];
+} const_gamma_den_18 = {
+	7,
+	0,
+	0,
+	{ 765, 689, 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_19 = {
+	5,
+	0,
+	0,
+	{ 25, 25 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_den_20 = {
+	3,
+	0,
+	0,
+	{ 231 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_den_21 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+const decNumber *const const_gamma_den[22] = {
+	(const decNumber *) &const_gamma_den_0,
+	(const decNumber *) &const_gamma_den_1,
+	(const decNumber *) &const_gamma_den_2,
+	(const decNumber *) &const_gamma_den_3,
+	(const decNumber *) &const_gamma_den_4,
+	(const decNumber *) &const_gamma_den_5,
+	(const decNumber *) &const_gamma_den_6,
+	(const decNumber *) &const_gamma_den_7,
+	(const decNumber *) &const_gamma_den_8,
+	(const decNumber *) &const_gamma_den_9,
+	(const decNumber *) &const_gamma_den_10,
+	(const decNumber *) &const_gamma_den_11,
+	(const decNumber *) &const_gamma_den_12,
+	(const decNumber *) &const_gamma_den_13,
+	(const decNumber *) &const_gamma_den_14,
+	(const decNumber *) &const_gamma_den_15,
+	(const decNumber *) &const_gamma_den_16,
+	(const decNumber *) &const_gamma_den_17,
+	(const decNumber *) &const_gamma_den_18,
+	(const decNumber *) &const_gamma_den_19,
+	(const decNumber *) &const_gamma_den_20,
+	(const decNumber *) &const_gamma_den_21,
+};
+
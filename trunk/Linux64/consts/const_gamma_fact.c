@@ -0,0 +1,441 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_fact_0 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_fact_1 = {
+	4,
+	1,
+	0,
+	{ 32, 4 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[4];
+} const_gamma_fact_2 = {
+	11,
+	3,
+	0,
+	{ 888, 789, 922, 20 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[7];
+} const_gamma_fact_3 = {
+	20,
+	4,
+	0,
+	{ 936, 943, 323, 173, 840, 44, 62 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[10];
+} const_gamma_fact_4 = {
+	29,
+	7,
+	0,
+	{ 216, 801, 721, 16, 353, 369, 693, 83, 313, 26 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_5 = {
+	39,
+	9,
+	0,
+	{ 272, 894, 115, 596, 269, 611, 345, 734, 897, 247, 283, 915, 815 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_6 = {
+	39,
+	23,
+	0,
+	{ 385, 750, 733, 473, 890, 622, 708, 726, 360, 925, 155, 139, 124 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_7 = {
+	39,
+	36,
+	0,
+	{ 736, 949, 724, 463, 647, 45, 854, 451, 863, 804, 587, 998, 710 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_8 = {
+	39,
+	51,
+	0,
+	{ 803, 480, 161, 335, 389, 433, 103, 164, 884, 185, 932, 886, 126 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_9 = {
+	39,
+	65,
+	0,
+	{ 408, 727, 746, 852, 703, 240, 615, 868, 860, 768, 583, 344, 612 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_10 = {
+	39,
+	80,
+	0,
+	{ 656, 321, 865, 231, 337, 115, 948, 22, 638, 462, 570, 694, 715 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_11 = {
+	38,
+	97,
+	0,
+	{ 438, 628, 554, 564, 684, 479, 911, 843, 739, 225, 264, 548, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_12 = {
+	39,
+	111,
+	0,
+	{ 158, 801, 893, 541, 401, 571, 209, 689, 949, 870, 934, 677, 991 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_13 = {
+	39,
+	128,
+	0,
+	{ 831, 442, 650, 647, 838, 485, 238, 276, 456, 451, 167, 990, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_14 = {
+	39,
+	144,
+	0,
+	{ 341, 488, 992, 275, 37, 682, 353, 402, 107, 722, 685, 450, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_15 = {
+	39,
+	160,
+	0,
+	{ 675, 258, 37, 409, 805, 811, 758, 705, 912, 344, 291, 950, 668 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_16 = {
+	39,
+	177,
+	0,
+	{ 617, 640, 463, 923, 65, 677, 735, 421, 580, 362, 482, 620, 385 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_17 = {
+	39,
+	194,
+	0,
+	{ 543, 334, 989, 51, 722, 972, 768, 865, 254, 195, 288, 904, 365 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_18 = {
+	37,
+	213,
+	0,
+	{ 118, 388, 550, 660, 54, 551, 789, 304, 739, 832, 293, 550, 5 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_19 = {
+	39,
+	229,
+	0,
+	{ 481, 711, 471, 123, 467, 672, 560, 254, 345, 568, 588, 133, 131 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_20 = {
+	39,
+	246,
+	0,
+	{ 951, 377, 194, 176, 321, 694, 240, 132, 206, 599, 363, 472, 471 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_21 = {
+	39,
+	264,
+	0,
+	{ 679, 114, 134, 917, 886, 801, 753, 838, 319, 497, 574, 607, 252 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_22 = {
+	39,
+	282,
+	0,
+	{ 917, 948, 27, 201, 349, 523, 781, 593, 89, 431, 110, 903, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_23 = {
+	39,
+	300,
+	0,
+	{ 28, 168, 360, 535, 724, 605, 247, 745, 982, 954, 537, 838, 222 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_24 = {
+	39,
+	318,
+	0,
+	{ 965, 425, 973, 383, 363, 355, 53, 497, 960, 146, 793, 996, 354 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_25 = {
+	39,
+	336,
+	0,
+	{ 295, 62, 185, 932, 213, 363, 552, 503, 790, 364, 867, 657, 788 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_26 = {
+	39,
+	355,
+	0,
+	{ 443, 670, 292, 291, 895, 717, 328, 600, 527, 450, 5, 111, 241 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_27 = {
+	39,
+	374,
+	0,
+	{ 928, 572, 313, 804, 305, 455, 939, 77, 461, 31, 337, 204, 100 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_28 = {
+	39,
+	392,
+	0,
+	{ 765, 931, 645, 13, 731, 45, 46, 604, 377, 375, 935, 715, 559 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_29 = {
+	39,
+	411,
+	0,
+	{ 62, 943, 261, 26, 637, 571, 15, 977, 770, 832, 210, 798, 415 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_30 = {
+	39,
+	430,
+	0,
+	{ 17, 531, 688, 148, 592, 357, 49, 812, 705, 364, 536, 788, 406 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_fact_31 = {
+	39,
+	449,
+	0,
+	{ 899, 384, 107, 52, 932, 150, 955, 695, 864, 101, 339, 334, 519 }
+};
+
+const decNumber *const const_gamma_fact[32] = {
+	(const decNumber *) &const_gamma_fact_0,
+	(const decNumber *) &const_gamma_fact_1,
+	(const decNumber *) &const_gamma_fact_2,
+	(const decNumber *) &const_gamma_fact_3,
+	(const decNumber *) &const_gamma_fact_4,
+	(const decNumber *) &const_gamma_fact_5,
+	(const decNumber *) &const_gamma_fact_6,
+	(const decNumber *) &const_gamma_fact_7,
+	(const decNumber *) &const_gamma_fact_8,
+	(const decNumber *) &const_gamma_fact_9,
+	(const decNumber *) &const_gamma_fact_10,
+	(const decNumber *) &const_gamma_fact_11,
+	(const decNumber *) &const_gamma_fact_12,
+	(const decNumber *) &const_gamma_fact_13,
+	(const decNumber *) &const_gamma_fact_14,
+	(const decNumber *) &const_gamma_fact_15,
+	(const decNumber *) &const_gamma_fact_16,
+	(const decNumber *) &const_gamma_fact_17,
+	(const decNumber *) &const_gamma_fact_18,
+	(const decNumber *) &const_gamma_fact_19,
+	(const decNumber *) &const_gamma_fact_20,
+	(const decNumber *) &const_gamma_fact_21,
+	(const decNumber *) &const_gamma_fact_22,
+	(const decNumber *) &const_gamma_fact_23,
+	(const decNumber *) &const_gamma_fact_24,
+	(const decNumber *) &const_gamma_fact_25,
+	(const decNumber *) &const_gamma_fact_26,
+	(const decNumber *) &const_gamma_fact_27,
+	(const decNumber *) &const_gamma_fact_28,
+	(const decNumber *) &const_gamma_fact_29,
+	(const decNumber *) &const_gamma_fact_30,
+	(const decNumber *) &const_gamma_fact_31,
+};
+
@@ -0,0 +1,441 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_0 = {
+	38,
+	-37,
+	0,
+	{ 828, 451, 411, 833, 674, 981, 272, 160, 55, 509, 538, 724, 17 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_1 = {
+	39,
+	-34,
+	0,
+	{ 803, 281, 296, 20, 779, 705, 985, 125, 834, 934, 72, 344, 140 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_2 = {
+	39,
+	-26,
+	0,
+	{ 345, 693, 766, 437, 177, 248, 307, 508, 12, 304, 845, 999, 518 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_3 = {
+	39,
+	-15,
+	0,
+	{ 937, 165, 854, 61, 212, 546, 235, 746, 293, 307, 634, 990, 125 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_4 = {
+	38,
+	-3,
+	0,
+	{ 268, 500, 323, 821, 971, 988, 384, 904, 513, 788, 60, 334, 46 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_5 = {
+	39,
+	9,
+	0,
+	{ 276, 775, 198, 876, 394, 871, 583, 153, 499, 825, 24, 605, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_6 = {
+	37,
+	24,
+	0,
+	{ 561, 236, 893, 686, 196, 244, 906, 447, 646, 400, 134, 787, 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_7 = {
+	39,
+	35,
+	0,
+	{ 841, 364, 185, 193, 197, 916, 328, 904, 672, 843, 435, 993, 947 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_8 = {
+	39,
+	50,
+	0,
+	{ 986, 218, 950, 338, 490, 679, 0, 684, 127, 153, 188, 299, 158 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_9 = {
+	38,
+	65,
+	0,
+	{ 737, 84, 862, 346, 767, 670, 418, 915, 695, 637, 323, 40, 72 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_10 = {
+	39,
+	79,
+	0,
+	{ 146, 773, 261, 43, 92, 814, 416, 509, 712, 768, 572, 921, 798 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_11 = {
+	39,
+	95,
+	0,
+	{ 458, 295, 719, 31, 121, 171, 60, 140, 45, 289, 502, 444, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_12 = {
+	39,
+	111,
+	0,
+	{ 844, 9, 236, 85, 548, 225, 819, 933, 504, 380, 4, 81, 101 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_13 = {
+	39,
+	127,
+	0,
+	{ 273, 507, 890, 832, 502, 186, 29, 53, 596, 959, 858, 868, 100 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_14 = {
+	39,
+	143,
+	0,
+	{ 646, 186, 857, 399, 350, 571, 820, 60, 181, 585, 248, 365, 186 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_15 = {
+	38,
+	160,
+	0,
+	{ 968, 281, 745, 791, 555, 614, 743, 58, 240, 740, 949, 2, 61 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_16 = {
+	39,
+	176,
+	0,
+	{ 277, 821, 33, 841, 600, 933, 975, 39, 78, 822, 880, 510, 340 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_17 = {
+	39,
+	193,
+	0,
+	{ 52, 439, 583, 172, 814, 738, 614, 177, 394, 88, 89, 472, 313 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_18 = {
+	39,
+	210,
+	0,
+	{ 136, 61, 88, 343, 467, 942, 50, 12, 371, 128, 164, 123, 462 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_19 = {
+	39,
+	228,
+	0,
+	{ 828, 980, 609, 461, 563, 976, 573, 539, 290, 702, 951, 275, 106 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_20 = {
+	39,
+	245,
+	0,
+	{ 318, 326, 985, 57, 946, 882, 490, 963, 281, 305, 548, 440, 372 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_21 = {
+	39,
+	263,
+	0,
+	{ 254, 768, 221, 52, 755, 446, 400, 25, 887, 834, 20, 746, 194 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_22 = {
+	39,
+	281,
+	0,
+	{ 15, 327, 483, 419, 599, 997, 289, 482, 794, 850, 171, 69, 149 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_23 = {
+	38,
+	300,
+	0,
+	{ 841, 298, 664, 307, 765, 172, 373, 913, 950, 533, 718, 416, 16 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_24 = {
+	39,
+	317,
+	0,
+	{ 641, 92, 826, 910, 914, 3, 715, 151, 197, 242, 127, 30, 256 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_25 = {
+	39,
+	335,
+	0,
+	{ 418, 149, 659, 290, 296, 320, 364, 913, 137, 480, 894, 316, 557 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_26 = {
+	39,
+	354,
+	0,
+	{ 921, 333, 314, 411, 138, 16, 42, 991, 77, 832, 963, 79, 167 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_27 = {
+	38,
+	373,
+	0,
+	{ 646, 468, 137, 726, 240, 176, 634, 353, 393, 674, 970, 140, 68 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_28 = {
+	39,
+	391,
+	0,
+	{ 124, 173, 244, 470, 33, 521, 667, 256, 829, 476, 306, 767, 373 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_29 = {
+	39,
+	410,
+	0,
+	{ 283, 201, 39, 267, 73, 948, 887, 666, 627, 618, 856, 837, 272 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_30 = {
+	39,
+	429,
+	0,
+	{ 128, 184, 137, 642, 582, 681, 199, 755, 225, 965, 145, 444, 262 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_half_31 = {
+	39,
+	448,
+	0,
+	{ 969, 555, 770, 802, 726, 698, 710, 819, 673, 536, 458, 611, 329 }
+};
+
+const decNumber *const const_gamma_half[32] = {
+	(const decNumber *) &const_gamma_half_0,
+	(const decNumber *) &const_gamma_half_1,
+	(const decNumber *) &const_gamma_half_2,
+	(const decNumber *) &const_gamma_half_3,
+	(const decNumber *) &const_gamma_half_4,
+	(const decNumber *) &const_gamma_half_5,
+	(const decNumber *) &const_gamma_half_6,
+	(const decNumber *) &const_gamma_half_7,
+	(const decNumber *) &const_gamma_half_8,
+	(const decNumber *) &const_gamma_half_9,
+	(const decNumber *) &const_gamma_half_10,
+	(const decNumber *) &const_gamma_half_11,
+	(const decNumber *) &const_gamma_half_12,
+	(const decNumber *) &const_gamma_half_13,
+	(const decNumber *) &const_gamma_half_14,
+	(const decNumber *) &const_gamma_half_15,
+	(const decNumber *) &const_gamma_half_16,
+	(const decNumber *) &const_gamma_half_17,
+	(const decNumber *) &const_gamma_half_18,
+	(const decNumber *) &const_gamma_half_19,
+	(const decNumber *) &const_gamma_half_20,
+	(const decNumber *) &const_gamma_half_21,
+	(const decNumber *) &const_gamma_half_22,
+	(const decNumber *) &const_gamma_half_23,
+	(const decNumber *) &const_gamma_half_24,
+	(const decNumber *) &const_gamma_half_25,
+	(const decNumber *) &const_gamma_half_26,
+	(const decNumber *) &const_gamma_half_27,
+	(const decNumber *) &const_gamma_half_28,
+	(const decNumber *) &const_gamma_half_29,
+	(const decNumber *) &const_gamma_half_30,
+	(const decNumber *) &const_gamma_half_31,
+};
+
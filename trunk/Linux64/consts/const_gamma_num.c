@@ -0,0 +1,311 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_0 = {
+	39,
+	-9,
+	0,
+	{ 345, 469, 445, 193, 770, 229, 728, 30, 257, 963, 600, 620, 116 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_1 = {
+	39,
+	-9,
+	0,
+	{ 123, 26, 736, 717, 447, 582, 417, 763, 61, 317, 500, 642, 105 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_2 = {
+	39,
+	-10,
+	0,
+	{ 287, 451, 266, 657, 992, 401, 66, 104, 389, 427, 977, 706, 455 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_3 = {
+	39,
+	-10,
+	0,
+	{ 366, 627, 66, 268, 553, 699, 321, 704, 38, 505, 589, 499, 124 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_4 = {
+	39,
+	-11,
+	0,
+	{ 261, 674, 328, 362, 414, 541, 865, 450, 529, 448, 819, 675, 241 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_5 = {
+	39,
+	-12,
+	0,
+	{ 13, 291, 989, 813, 774, 173, 278, 869, 340, 319, 412, 460, 354 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_6 = {
+	39,
+	-13,
+	0,
+	{ 856, 391, 188, 447, 884, 277, 687, 517, 802, 98, 902, 750, 407 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_7 = {
+	38,
+	-13,
+	0,
+	{ 54, 639, 365, 867, 962, 702, 637, 155, 210, 633, 21, 692, 37 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_8 = {
+	39,
+	-15,
+	0,
+	{ 683, 651, 170, 384, 544, 652, 141, 960, 369, 649, 399, 545, 284 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_9 = {
+	39,
+	-16,
+	0,
+	{ 106, 941, 491, 234, 452, 865, 12, 416, 140, 782, 308, 304, 177 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_10 = {
+	39,
+	-18,
+	0,
+	{ 45, 976, 713, 466, 488, 83, 376, 202, 553, 573, 779, 846, 917 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_11 = {
+	39,
+	-19,
+	0,
+	{ 105, 187, 972, 104, 119, 102, 565, 611, 39, 549, 53, 952, 395 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_12 = {
+	39,
+	-20,
+	0,
+	{ 689, 830, 412, 91, 724, 381, 597, 334, 698, 917, 128, 343, 142 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_13 = {
+	39,
+	-22,
+	0,
+	{ 482, 652, 60, 893, 393, 567, 730, 987, 910, 785, 967, 121, 425 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_14 = {
+	39,
+	-23,
+	0,
+	{ 551, 892, 427, 897, 945, 531, 840, 865, 457, 759, 747, 798, 104 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_15 = {
+	39,
+	-25,
+	0,
+	{ 158, 258, 726, 769, 516, 489, 572, 123, 926, 922, 369, 982, 210 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_16 = {
+	39,
+	-27,
+	0,
+	{ 626, 976, 741, 262, 425, 879, 560, 587, 199, 860, 313, 321, 341 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_17 = {
+	39,
+	-29,
+	0,
+	{ 381, 341, 572, 359, 782, 526, 566, 853, 168, 908, 991, 84, 433 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_18 = {
+	39,
+	-31,
+	0,
+	{ 637, 427, 588, 740, 206, 965, 199, 786, 978, 460, 809, 194, 415 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_19 = {
+	39,
+	-33,
+	0,
+	{ 576, 321, 226, 536, 861, 784, 830, 479, 674, 538, 204, 822, 282 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_20 = {
+	39,
+	-35,
+	0,
+	{ 863, 400, 589, 723, 5, 693, 62, 675, 968, 323, 111, 14, 122 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_num_21 = {
+	39,
+	-38,
+	0,
+	{ 819, 621, 24, 481, 528, 576, 241, 50, 100, 463, 827, 662, 250 }
+};
+
+const decNumber *const const_gamma_num[22] = {
+	(const decNumber *) &const_gamma_num_0,
+	(const decNumber *) &const_gamma_num_1,
+	(const decNumber *) &const_gamma_num_2,
+	(const decNumber *) &const_gamma_num_3,
+	(const decNumber *) &const_gamma_num_4,
+	(const decNumber *) &const_gamma_num_5,
+	(const decNumber *) &const_gamma_num_6,
+	(const decNumber *) &const_gamma_num_7,
+	(const decNumber *) &const_gamma_num_8,
+	(const decNumber *) &const_gamma_num_9,
+	(const decNumber *) &const_gamma_num_10,
+	(const decNumber *) &const_gamma_num_11,
+	(const decNumber *) &const_gamma_num_12,
+	(const decNumber *) &const_gamma_num_13,
+	(const decNumber *) &const_gamma_num_14,
+	(const decNumber *) &const_gamma_num_15,
+	(const decNumber *) &const_gamma_num_16,
+	(const decNumber *) &const_gamma_num_17,
+	(const decNumber *) &const_gamma_num_18,
+	(const decNumber *) &const_gamma_num_19,
+	(const decNumber *) &const_gamma_num_20,
+	(const decNumber *) &const_gamma_num_21,
+};
+
@@ -0,0 +1,337 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_0 = {
+	39,
+	-40,
+	0,
+	{ 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 833 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_1 = {
+	39,
+	-41,
+	128,
+	{ 778, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_2 = {
+	39,
+	-42,
+	0,
+	{ 794, 650, 793, 650, 793, 650, 793, 650, 793, 650, 793, 650, 793 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_3 = {
+	39,
+	-42,
+	128,
+	{ 95, 238, 95, 238, 95, 238, 95, 238, 95, 238, 95, 238, 595 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_4 = {
+	39,
+	-42,
+	0,
+	{ 842, 750, 841, 750, 841, 750, 841, 750, 841, 750, 841, 750, 841 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_5 = {
+	39,
+	-41,
+	128,
+	{ 692, 752, 691, 752, 691, 752, 691, 752, 691, 752, 691, 752, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_6 = {
+	39,
+	-41,
+	0,
+	{ 641, 25, 641, 25, 641, 25, 641, 25, 641, 25, 641, 25, 641 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_7 = {
+	39,
+	-40,
+	128,
+	{ 65, 830, 241, 771, 594, 653, 300, 418, 712, 947, 535, 506, 295 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_8 = {
+	39,
+	-39,
+	0,
+	{ 694, 396, 889, 15, 490, 938, 164, 573, 830, 368, 372, 644, 179 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_9 = {
+	39,
+	-38,
+	128,
+	{ 643, 111, 590, 690, 221, 743, 642, 111, 590, 690, 221, 243, 139 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_10 = {
+	39,
+	-37,
+	0,
+	{ 249, 311, 901, 6, 510, 789, 944, 919, 683, 441, 640, 28, 134 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_11 = {
+	39,
+	-36,
+	128,
+	{ 828, 973, 88, 452, 132, 365, 306, 17, 2, 626, 284, 848, 156 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_12 = {
+	39,
+	-35,
+	0,
+	{ 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 310, 219 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_13 = {
+	39,
+	-34,
+	128,
+	{ 365, 307, 422, 192, 652, 732, 571, 893, 249, 537, 712, 87, 361 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_14 = {
+	39,
+	-33,
+	0,
+	{ 553, 467, 673, 775, 250, 395, 108, 67, 313, 851, 268, 472, 691 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_15 = {
+	39,
+	-31,
+	128,
+	{ 187, 805, 867, 588, 649, 833, 922, 161, 74, 394, 215, 382, 152 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_16 = {
+	39,
+	-30,
+	0,
+	{ 414, 141, 414, 141, 414, 141, 414, 141, 414, 391, 751, 900, 382 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_17 = {
+	39,
+	-28,
+	128,
+	{ 747, 53, 251, 655, 491, 151, 890, 910, 843, 357, 660, 822, 108 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_18 = {
+	39,
+	-27,
+	0,
+	{ 252, 252, 252, 252, 252, 252, 252, 252, 2, 765, 283, 320, 347 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_19 = {
+	39,
+	-25,
+	128,
+	{ 811, 248, 713, 492, 103, 517, 542, 744, 692, 422, 21, 696, 123 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_20 = {
+	39,
+	-24,
+	0,
+	{ 108, 902, 22, 518, 162, 815, 75, 335, 79, 793, 64, 788, 488 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_21 = {
+	39,
+	-22,
+	128,
+	{ 575, 385, 368, 821, 589, 750, 969, 738, 193, 609, 339, 203, 213 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_22 = {
+	39,
+	-20,
+	0,
+	{ 39, 550, 358, 805, 762, 528, 756, 7, 570, 652, 529, 177, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_gamma_stirling_23 = {
+	39,
+	-19,
+	128,
+	{ 848, 44, 692, 919, 91, 277, 108, 36, 2, 733, 721, 754, 535 }
+};
+
+const decNumber *const const_gamma_stirling[24] = {
+	(const decNumber *) &const_gamma_stirling_0,
+	(const decNumber *) &const_gamma_stirling_1,
+	(const decNumber *) &const_gamma_stirling_2,
+	(const decNumber *) &const_gamma_stirling_3,
+	(const decNumber *) &const_gamma_stirling_4,
+	(const decNumber *) &const_gamma_stirling_5,
+	(const decNumber *) &const_gamma_stirling_6,
+	(const decNumber *) &const_gamma_stirling_7,
+	(const decNumber *) &const_gamma_stirling_8,
+	(const decNumber *) &const_gamma_stirling_9,
+	(const decNumber *) &const_gamma_stirling_10,
+	(const decNumber *) &const_gamma_stirling_11,
+	(const decNumber *) &const_gamma_stirling_12,
+	(const decNumber *) &const_gamma_stirling_13,
+	(const decNumber *) &const_gamma_stirling_14,
+	(const decNumber *) &const_gamma_stirling_15,
+	(const decNumber *) &const_gamma_stirling_16,
+	(const decNumber *) &const_gamma_stirling_17,
+	(const decNumber *) &const_gamma_stirling_18,
+	(const decNumber *) &const_gamma_stirling_19,
+	(const decNumber *) &const_gamma_stirling_20,
+	(const decNumber *) &const_gamma_stirling_21,
+	(const decNumber *) &const_gamma_stirling_22,
+	(const decNumber *) &const_gamma_stirling_23,
+};
+
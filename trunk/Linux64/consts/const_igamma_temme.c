@@ -0,0 +1,8345 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_0 = {
+	39,
+	-39,
+	128,
+	{ 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_1 = {
+	39,
+	-40,
+	0,
+	{ 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 833 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_2 = {
+	39,
+	-40,
+	128,
+	{ 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148, 148 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_3 = {
+	39,
+	-41,
+	0,
+	{ 741, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 740, 115 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_4 = {
+	39,
+	-42,
+	0,
+	{ 353, 400, 19, 67, 686, 733, 352, 400, 19, 67, 686, 733, 352 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_5 = {
+	39,
+	-42,
+	128,
+	{ 33, 144, 255, 366, 477, 588, 699, 810, 921, 32, 144, 755, 178 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_6 = {
+	39,
+	-43,
+	0,
+	{ 947, 555, 21, 630, 95, 704, 169, 778, 243, 852, 317, 926, 391 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_7 = {
+	39,
+	-44,
+	128,
+	{ 592, 660, 443, 512, 295, 364, 147, 216, 999, 67, 851, 544, 218 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_8 = {
+	39,
+	-44,
+	128,
+	{ 288, 325, 956, 622, 883, 179, 70, 996, 515, 71, 221, 406, 185 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_9 = {
+	39,
+	-45,
+	0,
+	{ 192, 227, 443, 166, 213, 624, 501, 600, 308, 95, 134, 671, 829 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_10 = {
+	39,
+	-45,
+	128,
+	{ 355, 30, 424, 457, 542, 600, 43, 793, 260, 368, 527, 659, 176 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_11 = {
+	39,
+	-47,
+	0,
+	{ 192, 572, 613, 29, 710, 939, 36, 858, 149, 340, 354, 785, 670 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_12 = {
+	39,
+	-46,
+	0,
+	{ 872, 950, 252, 227, 573, 739, 425, 80, 403, 842, 97, 618, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_13 = {
+	39,
+	-47,
+	128,
+	{ 389, 123, 719, 244, 462, 297, 655, 318, 335, 845, 601, 203, 438 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_14 = {
+	39,
+	-48,
+	0,
+	{ 785, 680, 113, 633, 817, 248, 418, 23, 679, 223, 958, 769, 914 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_15 = {
+	39,
+	-49,
+	128,
+	{ 144, 13, 887, 993, 537, 779, 668, 497, 462, 949, 939, 141, 255 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_16 = {
+	39,
+	-49,
+	128,
+	{ 531, 797, 35, 40, 945, 408, 746, 506, 42, 255, 213, 77, 583 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_17 = {
+	39,
+	-49,
+	0,
+	{ 867, 942, 789, 707, 696, 940, 436, 162, 674, 206, 480, 619, 243 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_18 = {
+	39,
+	-50,
+	128,
+	{ 524, 365, 744, 925, 985, 54, 909, 558, 417, 11, 928, 766, 502 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_19 = {
+	39,
+	-51,
+	0,
+	{ 334, 411, 293, 497, 174, 374, 708, 347, 561, 319, 920, 43, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_20 = {
+	39,
+	-51,
+	0,
+	{ 827, 184, 200, 169, 884, 769, 882, 537, 98, 240, 326, 176, 337 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_21 = {
+	39,
+	-51,
+	128,
+	{ 895, 979, 579, 489, 618, 936, 591, 206, 816, 241, 872, 238, 139 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_22 = {
+	39,
+	-52,
+	0,
+	{ 924, 298, 828, 52, 99, 669, 39, 432, 474, 70, 938, 348, 285 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_23 = {
+	39,
+	-54,
+	128,
+	{ 454, 205, 494, 300, 580, 64, 899, 261, 257, 424, 183, 911, 513 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_24 = {
+	39,
+	-53,
+	128,
+	{ 202, 912, 710, 580, 401, 962, 353, 428, 494, 943, 882, 522, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_25 = {
+	39,
+	-54,
+	0,
+	{ 316, 255, 575, 702, 668, 115, 407, 133, 456, 670, 115, 952, 809 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_26 = {
+	39,
+	-54,
+	128,
+	{ 648, 161, 351, 265, 820, 514, 191, 618, 981, 163, 312, 225, 165 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_27 = {
+	39,
+	-56,
+	0,
+	{ 909, 384, 267, 60, 90, 61, 327, 842, 788, 974, 300, 54, 253 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_28 = {
+	38,
+	-54,
+	0,
+	{ 462, 347, 779, 650, 87, 823, 588, 576, 559, 738, 939, 686, 11 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_29 = {
+	39,
+	-56,
+	128,
+	{ 403, 597, 816, 84, 804, 167, 822, 475, 48, 982, 704, 3, 477 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_30 = {
+	39,
+	-57,
+	0,
+	{ 423, 354, 585, 898, 685, 709, 420, 712, 623, 905, 605, 912, 969 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_31 = {
+	38,
+	-57,
+	128,
+	{ 198, 291, 496, 774, 256, 443, 10, 175, 38, 538, 565, 932, 12 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_32 = {
+	39,
+	-58,
+	128,
+	{ 968, 451, 519, 585, 631, 54, 53, 338, 569, 318, 25, 923, 696 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_33 = {
+	39,
+	-58,
+	0,
+	{ 839, 750, 168, 713, 618, 319, 992, 659, 693, 217, 543, 514, 283 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_34 = {
+	39,
+	-59,
+	128,
+	{ 598, 234, 84, 952, 613, 266, 16, 750, 704, 900, 215, 98, 575 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_35 = {
+	39,
+	-61,
+	0,
+	{ 88, 142, 43, 437, 566, 496, 461, 456, 891, 348, 378, 295, 679 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_36 = {
+	38,
+	-59,
+	0,
+	{ 659, 268, 482, 93, 726, 79, 578, 358, 113, 261, 254, 821, 41 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_37 = {
+	39,
+	-60,
+	128,
+	{ 674, 731, 824, 505, 569, 950, 321, 37, 476, 200, 396, 715, 169 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_38 = {
+	39,
+	-61,
+	0,
+	{ 307, 858, 942, 246, 564, 42, 296, 988, 431, 839, 593, 621, 343 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_39 = {
+	39,
+	-63,
+	128,
+	{ 611, 728, 545, 784, 686, 939, 196, 101, 802, 962, 577, 399, 364 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_40 = {
+	39,
+	-41,
+	128,
+	{ 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_41 = {
+	39,
+	-41,
+	128,
+	{ 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 347 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_42 = {
+	39,
+	-41,
+	0,
+	{ 265, 550, 264, 550, 264, 550, 264, 550, 264, 550, 264, 550, 264 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_43 = {
+	39,
+	-42,
+	128,
+	{ 449, 337, 226, 115, 4, 893, 781, 670, 559, 448, 337, 226, 990 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_44 = {
+	39,
+	-42,
+	0,
+	{ 872, 316, 761, 205, 650, 94, 539, 983, 427, 872, 316, 761, 205 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_45 = {
+	39,
+	-45,
+	128,
+	{ 16, 572, 127, 683, 238, 794, 349, 905, 460, 16, 572, 877, 401 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_46 = {
+	39,
+	-43,
+	128,
+	{ 226, 523, 533, 867, 914, 285, 370, 778, 899, 344, 503, 985, 180 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_47 = {
+	39,
+	-44,
+	0,
+	{ 522, 209, 169, 809, 149, 742, 463, 8, 111, 608, 91, 916, 764 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_48 = {
+	39,
+	-44,
+	128,
+	{ 914, 669, 177, 822, 218, 752, 37, 460, 634, 945, 8, 209, 161 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_49 = {
+	39,
+	-47,
+	0,
+	{ 847, 400, 722, 938, 33, 135, 226, 434, 743, 280, 780, 712, 464 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_50 = {
+	38,
+	-44,
+	0,
+	{ 691, 887, 748, 307, 753, 118, 593, 209, 157, 469, 334, 786, 13 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_51 = {
+	38,
+	-45,
+	128,
+	{ 684, 830, 504, 183, 453, 219, 640, 49, 177, 35, 456, 525, 57 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_52 = {
+	39,
+	-46,
+	0,
+	{ 404, 169, 698, 699, 536, 76, 243, 473, 781, 997, 285, 516, 119 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_53 = {
+	38,
+	-48,
+	128,
+	{ 225, 250, 231, 120, 755, 754, 623, 647, 747, 719, 241, 543, 17 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_54 = {
+	39,
+	-47,
+	128,
+	{ 945, 674, 681, 686, 504, 577, 274, 126, 4, 106, 437, 915, 100 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_55 = {
+	39,
+	-48,
+	0,
+	{ 984, 627, 858, 219, 347, 372, 623, 263, 258, 184, 299, 279, 416 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_56 = {
+	39,
+	-49,
+	128,
+	{ 149, 208, 670, 579, 562, 431, 807, 63, 298, 649, 702, 390, 856 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_57 = {
+	39,
+	-52,
+	0,
+	{ 217, 581, 919, 169, 762, 701, 512, 861, 475, 160, 510, 721, 606 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_58 = {
+	39,
+	-50,
+	0,
+	{ 447, 733, 545, 165, 17, 961, 7, 539, 148, 481, 896, 249, 716 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_59 = {
+	39,
+	-50,
+	128,
+	{ 874, 402, 595, 615, 683, 636, 740, 711, 143, 377, 664, 318, 293 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_60 = {
+	39,
+	-51,
+	0,
+	{ 897, 908, 788, 568, 527, 374, 330, 872, 368, 568, 636, 669, 599 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_61 = {
+	39,
+	-54,
+	128,
+	{ 206, 734, 701, 779, 472, 100, 17, 141, 233, 273, 865, 717, 216 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_62 = {
+	39,
+	-52,
+	128,
+	{ 528, 547, 108, 48, 522, 815, 52, 164, 926, 236, 997, 833, 497 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_63 = {
+	39,
+	-52,
+	0,
+	{ 667, 225, 894, 325, 804, 694, 736, 247, 134, 237, 288, 916, 202 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_64 = {
+	39,
+	-53,
+	128,
+	{ 935, 110, 187, 558, 332, 108, 935, 4, 61, 381, 571, 125, 413 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_65 = {
+	39,
+	-57,
+	0,
+	{ 699, 315, 589, 57, 591, 188, 380, 644, 309, 988, 623, 651, 828 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_66 = {
+	39,
+	-54,
+	0,
+	{ 407, 992, 600, 910, 355, 339, 336, 279, 333, 693, 88, 3, 341 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_67 = {
+	39,
+	-54,
+	128,
+	{ 734, 702, 313, 426, 547, 34, 357, 715, 939, 28, 953, 541, 138 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_68 = {
+	39,
+	-55,
+	0,
+	{ 442, 483, 259, 727, 332, 860, 568, 466, 887, 322, 665, 234, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_69 = {
+	39,
+	-59,
+	128,
+	{ 386, 930, 452, 870, 993, 778, 526, 880, 302, 414, 419, 644, 340 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_70 = {
+	39,
+	-56,
+	128,
+	{ 917, 435, 854, 489, 729, 816, 113, 719, 155, 151, 973, 97, 231 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_71 = {
+	39,
+	-57,
+	0,
+	{ 34, 902, 664, 484, 346, 858, 558, 592, 225, 413, 706, 675, 936 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_72 = {
+	39,
+	-57,
+	128,
+	{ 663, 977, 495, 480, 193, 755, 521, 870, 584, 528, 701, 725, 189 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_73 = {
+	39,
+	-61,
+	0,
+	{ 867, 69, 114, 199, 599, 411, 792, 976, 395, 403, 307, 126, 149 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_74 = {
+	39,
+	-58,
+	0,
+	{ 461, 202, 470, 719, 235, 889, 797, 963, 513, 472, 0, 349, 155 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_75 = {
+	39,
+	-59,
+	128,
+	{ 144, 43, 249, 310, 354, 268, 638, 747, 718, 423, 45, 513, 628 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_76 = {
+	39,
+	-59,
+	0,
+	{ 102, 97, 48, 906, 863, 322, 4, 709, 224, 137, 101, 91, 127 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_77 = {
+	39,
+	-64,
+	128,
+	{ 494, 763, 557, 785, 257, 3, 181, 365, 788, 762, 571, 338, 686 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_78 = {
+	39,
+	-60,
+	128,
+	{ 13, 162, 307, 712, 779, 382, 604, 617, 132, 825, 939, 764, 103 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_79 = {
+	39,
+	-61,
+	0,
+	{ 702, 900, 825, 297, 441, 931, 116, 500, 916, 48, 965, 211, 419 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_80 = {
+	39,
+	-41,
+	0,
+	{ 788, 359, 788, 359, 788, 359, 788, 359, 788, 359, 788, 359, 413 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_81 = {
+	39,
+	-41,
+	128,
+	{ 49, 716, 382, 49, 716, 382, 49, 716, 382, 49, 716, 132, 268 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_82 = {
+	39,
+	-42,
+	0,
+	{ 272, 938, 604, 271, 938, 604, 271, 938, 604, 271, 938, 604, 771 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_83 = {
+	39,
+	-44,
+	0,
+	{ 8, 786, 563, 341, 119, 897, 674, 452, 230, 8, 786, 938, 200 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_84 = {
+	39,
+	-42,
+	128,
+	{ 573, 296, 676, 621, 223, 391, 215, 605, 651, 263, 532, 366, 107 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_85 = {
+	39,
+	-43,
+	0,
+	{ 53, 143, 90, 180, 127, 217, 164, 254, 201, 291, 488, 234, 529 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_86 = {
+	38,
+	-42,
+	128,
+	{ 664, 11, 236, 139, 919, 377, 713, 727, 618, 188, 635, 760, 12 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_87 = {
+	39,
+	-46,
+	0,
+	{ 724, 889, 473, 47, 39, 20, 419, 807, 613, 409, 873, 357, 342 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_88 = {
+	39,
+	-44,
+	0,
+	{ 558, 278, 20, 926, 852, 943, 55, 332, 629, 90, 573, 219, 137 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_89 = {
+	39,
+	-45,
+	128,
+	{ 319, 876, 391, 278, 234, 672, 290, 502, 5, 838, 213, 899, 629 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_90 = {
+	39,
+	-45,
+	0,
+	{ 624, 747, 771, 822, 8, 846, 915, 417, 642, 60, 142, 806, 142 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_91 = {
+	39,
+	-48,
+	128,
+	{ 113, 226, 200, 409, 854, 195, 149, 660, 908, 219, 984, 770, 204 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_92 = {
+	39,
+	-46,
+	128,
+	{ 177, 272, 315, 154, 244, 930, 532, 210, 675, 108, 299, 925, 140 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_93 = {
+	39,
+	-47,
+	0,
+	{ 686, 111, 327, 530, 293, 394, 356, 203, 202, 492, 408, 897, 622 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_94 = {
+	39,
+	-47,
+	128,
+	{ 165, 402, 402, 284, 380, 724, 992, 134, 171, 966, 883, 704, 136 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_95 = {
+	39,
+	-51,
+	0,
+	{ 171, 75, 208, 663, 211, 711, 547, 819, 467, 901, 615, 835, 942 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_96 = {
+	39,
+	-48,
+	0,
+	{ 813, 441, 770, 872, 368, 479, 595, 180, 893, 0, 524, 722, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_97 = {
+	39,
+	-49,
+	128,
+	{ 269, 439, 951, 894, 765, 414, 465, 211, 633, 343, 561, 459, 556 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_98 = {
+	39,
+	-49,
+	0,
+	{ 764, 342, 311, 310, 150, 898, 35, 810, 669, 463, 355, 759, 119 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_99 = {
+	39,
+	-53,
+	128,
+	{ 231, 96, 480, 692, 626, 836, 403, 350, 386, 518, 822, 897, 416 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_100 = {
+	38,
+	-49,
+	128,
+	{ 817, 290, 80, 864, 900, 929, 409, 594, 884, 427, 640, 940, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_101 = {
+	39,
+	-51,
+	0,
+	{ 659, 899, 467, 246, 492, 620, 632, 574, 13, 639, 994, 223, 466 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_102 = {
+	39,
+	-52,
+	128,
+	{ 318, 301, 382, 212, 258, 122, 844, 597, 690, 390, 576, 510, 990 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_103 = {
+	39,
+	-55,
+	0,
+	{ 13, 169, 630, 170, 183, 885, 56, 145, 735, 683, 767, 318, 189 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_104 = {
+	39,
+	-53,
+	0,
+	{ 368, 667, 740, 28, 67, 31, 176, 726, 112, 259, 187, 922, 885 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_105 = {
+	38,
+	-52,
+	128,
+	{ 653, 193, 719, 177, 25, 656, 530, 54, 464, 980, 203, 378, 37 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_106 = {
+	39,
+	-54,
+	0,
+	{ 993, 750, 960, 65, 394, 88, 774, 525, 515, 903, 363, 883, 786 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_107 = {
+	39,
+	-58,
+	128,
+	{ 25, 545, 609, 175, 648, 540, 608, 116, 121, 574, 739, 2, 900 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_108 = {
+	39,
+	-55,
+	128,
+	{ 963, 135, 800, 592, 164, 227, 43, 172, 767, 934, 122, 888, 692 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_109 = {
+	39,
+	-55,
+	0,
+	{ 423, 669, 716, 922, 56, 30, 528, 833, 647, 701, 842, 203, 290 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_110 = {
+	39,
+	-56,
+	128,
+	{ 386, 786, 316, 163, 317, 248, 547, 688, 87, 681, 469, 785, 606 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_111 = {
+	39,
+	-60,
+	0,
+	{ 456, 419, 75, 890, 746, 474, 406, 282, 685, 979, 72, 212, 447 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_112 = {
+	39,
+	-57,
+	0,
+	{ 445, 827, 564, 143, 424, 999, 225, 529, 978, 444, 614, 944, 527 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_113 = {
+	39,
+	-57,
+	128,
+	{ 951, 425, 978, 140, 924, 229, 819, 195, 573, 348, 123, 881, 219 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_114 = {
+	39,
+	-58,
+	0,
+	{ 429, 231, 484, 487, 217, 362, 377, 874, 487, 213, 277, 328, 457 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_115 = {
+	39,
+	-62,
+	128,
+	{ 837, 707, 925, 934, 907, 835, 989, 963, 672, 470, 626, 358, 230 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_116 = {
+	39,
+	-59,
+	128,
+	{ 437, 624, 942, 968, 674, 480, 290, 303, 97, 647, 558, 161, 394 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_117 = {
+	39,
+	-59,
+	0,
+	{ 909, 689, 73, 825, 584, 977, 865, 380, 63, 412, 737, 433, 163 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_118 = {
+	39,
+	-60,
+	128,
+	{ 733, 129, 428, 305, 820, 730, 128, 38, 294, 687, 214, 496, 338 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_119 = {
+	39,
+	-64,
+	0,
+	{ 909, 784, 570, 25, 861, 399, 482, 120, 96, 764, 726, 970, 121 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_120 = {
+	39,
+	-42,
+	0,
+	{ 379, 156, 934, 711, 489, 267, 45, 823, 600, 378, 156, 434, 649 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_121 = {
+	39,
+	-42,
+	0,
+	{ 621, 843, 65, 288, 510, 732, 954, 176, 399, 621, 93, 472, 229 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_122 = {
+	39,
+	-42,
+	128,
+	{ 412, 329, 206, 679, 111, 140, 128, 712, 255, 395, 494, 189, 469 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_123 = {
+	39,
+	-42,
+	0,
+	{ 333, 223, 209, 433, 752, 309, 962, 852, 838, 62, 632, 720, 267 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_124 = {
+	39,
+	-43,
+	128,
+	{ 764, 665, 755, 879, 191, 538, 72, 641, 397, 188, 167, 180, 756 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_125 = {
+	39,
+	-45,
+	128,
+	{ 806, 722, 231, 333, 27, 314, 193, 665, 729, 386, 511, 650, 239 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_126 = {
+	39,
+	-43,
+	0,
+	{ 633, 226, 861, 726, 299, 770, 614, 23, 473, 153, 541, 826, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_127 = {
+	39,
+	-44,
+	128,
+	{ 447, 205, 560, 701, 105, 963, 749, 656, 159, 699, 282, 495, 567 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_128 = {
+	39,
+	-44,
+	0,
+	{ 8, 330, 804, 705, 944, 518, 145, 839, 358, 324, 7, 309, 142 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_129 = {
+	39,
+	-49,
+	128,
+	{ 924, 451, 174, 211, 158, 802, 405, 422, 281, 915, 802, 610, 278 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_130 = {
+	39,
+	-45,
+	128,
+	{ 595, 669, 202, 958, 687, 641, 898, 772, 302, 919, 40, 584, 169 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_131 = {
+	39,
+	-46,
+	0,
+	{ 621, 80, 724, 852, 504, 278, 335, 236, 808, 538, 490, 946, 809 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_132 = {
+	39,
+	-46,
+	128,
+	{ 632, 634, 727, 872, 140, 728, 606, 540, 736, 859, 684, 111, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_133 = {
+	38,
+	-49,
+	0,
+	{ 583, 205, 228, 402, 351, 641, 968, 117, 808, 439, 620, 928, 23 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_134 = {
+	39,
+	-47,
+	0,
+	{ 725, 548, 654, 486, 818, 925, 369, 984, 887, 154, 318, 201, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_135 = {
+	39,
+	-48,
+	128,
+	{ 839, 813, 192, 510, 988, 417, 375, 217, 513, 185, 666, 49, 946 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_136 = {
+	39,
+	-48,
+	0,
+	{ 314, 512, 744, 468, 268, 130, 380, 78, 749, 757, 497, 410, 215 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_137 = {
+	39,
+	-52,
+	128,
+	{ 277, 291, 735, 490, 682, 424, 603, 304, 390, 681, 333, 882, 138 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_138 = {
+	39,
+	-49,
+	128,
+	{ 357, 455, 489, 466, 400, 123, 64, 394, 639, 819, 616, 947, 218 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_139 = {
+	39,
+	-50,
+	0,
+	{ 189, 368, 883, 255, 802, 262, 568, 512, 168, 117, 895, 99, 979 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_140 = {
+	39,
+	-50,
+	128,
+	{ 358, 244, 393, 11, 472, 859, 153, 621, 809, 801, 918, 821, 217 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_141 = {
+	39,
+	-55,
+	0,
+	{ 841, 49, 722, 849, 616, 663, 581, 142, 790, 340, 957, 881, 620 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_142 = {
+	38,
+	-50,
+	0,
+	{ 146, 447, 461, 711, 253, 670, 769, 369, 797, 632, 783, 269, 21 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_143 = {
+	39,
+	-52,
+	128,
+	{ 632, 472, 749, 626, 765, 396, 127, 333, 743, 151, 879, 468, 934 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_144 = {
+	39,
+	-52,
+	0,
+	{ 429, 436, 207, 63, 913, 215, 249, 493, 828, 267, 712, 536, 204 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_145 = {
+	39,
+	-57,
+	128,
+	{ 395, 521, 842, 637, 968, 467, 332, 21, 495, 403, 790, 260, 258 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_146 = {
+	39,
+	-53,
+	128,
+	{ 52, 175, 251, 487, 136, 438, 675, 443, 445, 733, 976, 52, 194 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_147 = {
+	39,
+	-54,
+	0,
+	{ 243, 991, 840, 443, 141, 138, 40, 552, 481, 48, 929, 597, 841 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_148 = {
+	39,
+	-54,
+	128,
+	{ 317, 324, 178, 305, 828, 922, 143, 252, 382, 395, 304, 4, 182 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_149 = {
+	38,
+	-58,
+	0,
+	{ 737, 608, 514, 721, 961, 516, 962, 309, 247, 641, 443, 735, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_150 = {
+	39,
+	-55,
+	0,
+	{ 425, 843, 953, 933, 367, 769, 296, 330, 528, 152, 283, 968, 168 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_151 = {
+	39,
+	-56,
+	128,
+	{ 716, 90, 637, 115, 738, 847, 25, 747, 214, 694, 174, 611, 725 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_152 = {
+	39,
+	-56,
+	0,
+	{ 648, 801, 596, 809, 746, 931, 216, 275, 220, 466, 927, 472, 155 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_153 = {
+	39,
+	-62,
+	128,
+	{ 212, 333, 654, 158, 890, 155, 313, 890, 523, 227, 475, 599, 460 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_154 = {
+	38,
+	-56,
+	128,
+	{ 792, 387, 983, 235, 627, 85, 21, 749, 761, 137, 358, 191, 14 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_155 = {
+	39,
+	-58,
+	0,
+	{ 308, 406, 75, 634, 992, 242, 17, 474, 782, 837, 649, 706, 604 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_156 = {
+	39,
+	-58,
+	128,
+	{ 755, 234, 86, 703, 283, 774, 343, 110, 678, 934, 347, 617, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_157 = {
+	39,
+	-64,
+	0,
+	{ 528, 301, 716, 497, 874, 737, 830, 938, 675, 936, 329, 233, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_158 = {
+	39,
+	-59,
+	0,
+	{ 552, 323, 725, 16, 511, 282, 632, 603, 630, 884, 640, 816, 115 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_159 = {
+	39,
+	-60,
+	128,
+	{ 634, 710, 64, 817, 931, 270, 468, 339, 800, 506, 908, 410, 490 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_160 = {
+	39,
+	-42,
+	128,
+	{ 617, 377, 57, 929, 719, 702, 604, 698, 711, 916, 290, 888, 861 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_161 = {
+	39,
+	-42,
+	0,
+	{ 696, 849, 288, 442, 881, 34, 474, 627, 66, 720, 221, 39, 784 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_162 = {
+	39,
+	-42,
+	128,
+	{ 363, 809, 819, 932, 609, 389, 733, 179, 190, 303, 480, 72, 299 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_163 = {
+	39,
+	-44,
+	128,
+	{ 267, 556, 697, 690, 535, 232, 781, 181, 434, 788, 525, 384, 146 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_164 = {
+	39,
+	-43,
+	0,
+	{ 905, 12, 862, 451, 782, 853, 665, 218, 512, 546, 821, 149, 664 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_165 = {
+	39,
+	-43,
+	128,
+	{ 81, 882, 386, 595, 507, 123, 443, 466, 943, 717, 504, 836, 396 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_166 = {
+	39,
+	-43,
+	0,
+	{ 796, 758, 831, 885, 42, 552, 980, 190, 784, 706, 269, 757, 113 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_167 = {
+	39,
+	-48,
+	0,
+	{ 731, 6, 57, 390, 942, 221, 165, 280, 753, 623, 722, 749, 250 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_168 = {
+	38,
+	-43,
+	128,
+	{ 181, 575, 152, 678, 435, 716, 14, 306, 558, 536, 149, 954, 16 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_169 = {
+	39,
+	-45,
+	0,
+	{ 851, 923, 515, 505, 422, 898, 882, 968, 530, 220, 753, 750, 890 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_170 = {
+	39,
+	-45,
+	128,
+	{ 297, 518, 158, 891, 364, 216, 57, 487, 80, 400, 483, 293, 229 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_171 = {
+	38,
+	-48,
+	0,
+	{ 773, 458, 0, 250, 285, 657, 469, 490, 440, 375, 941, 567, 29 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_172 = {
+	39,
+	-46,
+	0,
+	{ 569, 503, 184, 604, 274, 341, 297, 836, 87, 427, 297, 658, 288 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_173 = {
+	38,
+	-45,
+	128,
+	{ 682, 271, 398, 390, 430, 477, 389, 219, 803, 437, 739, 189, 14 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_174 = {
+	39,
+	-47,
+	0,
+	{ 441, 356, 194, 474, 720, 527, 659, 970, 648, 994, 804, 635, 344 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_175 = {
+	39,
+	-51,
+	128,
+	{ 4, 87, 147, 850, 735, 192, 320, 671, 280, 745, 171, 245, 230 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_176 = {
+	39,
+	-48,
+	128,
+	{ 786, 798, 291, 85, 640, 697, 750, 52, 464, 280, 330, 92, 394 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_177 = {
+	38,
+	-47,
+	0,
+	{ 879, 563, 518, 304, 853, 425, 913, 501, 504, 968, 338, 602, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_178 = {
+	39,
+	-49,
+	128,
+	{ 285, 424, 262, 446, 327, 678, 380, 804, 661, 505, 300, 632, 435 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_179 = {
+	39,
+	-53,
+	0,
+	{ 6, 726, 930, 349, 463, 550, 660, 312, 962, 162, 10, 860, 127 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_180 = {
+	39,
+	-50,
+	0,
+	{ 307, 62, 760, 991, 739, 382, 200, 946, 791, 665, 502, 927, 467 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_181 = {
+	39,
+	-50,
+	128,
+	{ 698, 85, 721, 910, 341, 535, 410, 285, 348, 61, 647, 924, 214 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_182 = {
+	39,
+	-51,
+	0,
+	{ 121, 82, 984, 463, 688, 649, 323, 216, 965, 480, 561, 881, 490 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_183 = {
+	39,
+	-56,
+	128,
+	{ 612, 534, 49, 679, 567, 560, 604, 32, 156, 489, 148, 859, 633 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_184 = {
+	39,
+	-52,
+	128,
+	{ 761, 479, 118, 296, 251, 729, 733, 435, 9, 908, 206, 533, 504 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_185 = {
+	39,
+	-52,
+	0,
+	{ 768, 659, 846, 351, 818, 384, 238, 859, 12, 229, 582, 229, 227 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_186 = {
+	39,
+	-53,
+	128,
+	{ 53, 747, 287, 183, 847, 570, 193, 154, 240, 847, 260, 608, 509 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_187 = {
+	39,
+	-58,
+	0,
+	{ 808, 389, 936, 895, 224, 749, 889, 541, 713, 571, 975, 520, 305 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_188 = {
+	39,
+	-54,
+	0,
+	{ 592, 199, 898, 289, 412, 728, 496, 156, 55, 631, 167, 902, 506 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_189 = {
+	39,
+	-54,
+	128,
+	{ 853, 70, 806, 58, 253, 4, 629, 97, 818, 564, 369, 938, 224 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_190 = {
+	39,
+	-55,
+	0,
+	{ 8, 474, 171, 943, 715, 893, 188, 811, 141, 213, 142, 511, 497 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_191 = {
+	39,
+	-60,
+	128,
+	{ 138, 488, 946, 393, 673, 544, 88, 307, 173, 935, 163, 30, 149 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_192 = {
+	39,
+	-56,
+	128,
+	{ 353, 602, 585, 821, 301, 990, 601, 338, 42, 440, 577, 504, 482 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_193 = {
+	39,
+	-56,
+	0,
+	{ 934, 190, 653, 24, 33, 809, 117, 823, 465, 856, 676, 646, 211 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_194 = {
+	38,
+	-56,
+	128,
+	{ 442, 286, 634, 25, 552, 601, 57, 479, 492, 287, 113, 302, 46 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_195 = {
+	39,
+	-63,
+	0,
+	{ 972, 887, 614, 204, 859, 810, 97, 914, 994, 499, 387, 475, 747 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_196 = {
+	39,
+	-58,
+	0,
+	{ 737, 763, 596, 673, 517, 285, 748, 976, 518, 680, 275, 102, 440 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_197 = {
+	39,
+	-58,
+	128,
+	{ 517, 480, 68, 46, 702, 711, 307, 273, 179, 868, 864, 259, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_198 = {
+	38,
+	-58,
+	0,
+	{ 324, 288, 619, 82, 236, 254, 139, 277, 767, 63, 922, 473, 41 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_199 = {
+	38,
+	-64,
+	128,
+	{ 243, 556, 72, 683, 588, 521, 772, 84, 166, 311, 847, 639, 38 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_200 = {
+	39,
+	-42,
+	128,
+	{ 161, 2, 210, 718, 592, 767, 308, 150, 358, 366, 553, 798, 336 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_201 = {
+	39,
+	-43,
+	128,
+	{ 294, 308, 783, 575, 828, 398, 429, 777, 585, 836, 375, 281, 697 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_202 = {
+	39,
+	-42,
+	0,
+	{ 343, 10, 75, 965, 251, 364, 873, 207, 939, 495, 324, 275, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_203 = {
+	38,
+	-41,
+	128,
+	{ 832, 423, 84, 528, 40, 336, 700, 847, 188, 516, 570, 932, 19 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_204 = {
+	39,
+	-43,
+	0,
+	{ 19, 742, 435, 604, 176, 640, 881, 783, 720, 793, 47, 778, 679 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_205 = {
+	39,
+	-45,
+	0,
+	{ 696, 756, 575, 105, 727, 392, 483, 701, 396, 64, 292, 906, 141 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_206 = {
+	38,
+	-42,
+	128,
+	{ 931, 446, 750, 883, 393, 458, 278, 693, 768, 189, 48, 594, 13 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_207 = {
+	39,
+	-44,
+	0,
+	{ 815, 839, 196, 804, 719, 925, 971, 153, 420, 633, 25, 847, 801 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_208 = {
+	39,
+	-44,
+	128,
+	{ 396, 806, 781, 128, 790, 48, 38, 517, 809, 650, 117, 148, 229 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_209 = {
+	39,
+	-48,
+	128,
+	{ 503, 46, 5, 750, 137, 230, 166, 395, 845, 129, 355, 247, 325 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_210 = {
+	38,
+	-44,
+	0,
+	{ 524, 981, 757, 682, 549, 919, 955, 264, 85, 491, 846, 652, 34 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_211 = {
+	39,
+	-45,
+	128,
+	{ 154, 978, 920, 374, 367, 322, 765, 432, 713, 911, 871, 471, 184 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_212 = {
+	39,
+	-46,
+	0,
+	{ 398, 2, 989, 738, 631, 762, 563, 807, 941, 378, 670, 409, 482 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_213 = {
+	39,
+	-52,
+	128,
+	{ 314, 314, 644, 716, 291, 754, 25, 153, 435, 217, 667, 894, 179 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_214 = {
+	39,
+	-47,
+	128,
+	{ 973, 697, 944, 425, 981, 516, 517, 343, 352, 1, 450, 619, 630 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_215 = {
+	39,
+	-47,
+	0,
+	{ 138, 623, 969, 540, 181, 762, 773, 793, 456, 877, 762, 241, 316 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_216 = {
+	39,
+	-48,
+	128,
+	{ 997, 544, 267, 523, 303, 839, 0, 929, 742, 369, 425, 92, 784 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_217 = {
+	39,
+	-53,
+	0,
+	{ 363, 786, 746, 440, 764, 621, 377, 72, 404, 525, 916, 267, 519 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_218 = {
+	39,
+	-49,
+	0,
+	{ 584, 784, 645, 923, 623, 590, 459, 358, 678, 230, 424, 894, 935 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_219 = {
+	39,
+	-49,
+	128,
+	{ 436, 634, 328, 130, 193, 171, 101, 823, 327, 616, 621, 342, 451 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_220 = {
+	39,
+	-49,
+	0,
+	{ 773, 882, 321, 76, 885, 835, 409, 270, 168, 931, 299, 991, 107 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_221 = {
+	39,
+	-55,
+	128,
+	{ 806, 932, 385, 943, 727, 792, 90, 201, 525, 268, 671, 188, 366 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_222 = {
+	39,
+	-50,
+	128,
+	{ 312, 591, 709, 344, 885, 737, 798, 498, 515, 905, 206, 90, 121 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_223 = {
+	39,
+	-51,
+	0,
+	{ 211, 279, 254, 310, 838, 30, 289, 433, 56, 499, 358, 74, 568 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_224 = {
+	39,
+	-51,
+	128,
+	{ 43, 664, 708, 751, 474, 380, 878, 290, 408, 163, 599, 496, 132 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_225 = {
+	39,
+	-57,
+	0,
+	{ 282, 573, 867, 812, 115, 851, 204, 755, 840, 642, 407, 872, 189 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_226 = {
+	39,
+	-52,
+	0,
+	{ 736, 44, 16, 17, 840, 138, 851, 18, 947, 367, 902, 933, 141 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_227 = {
+	39,
+	-53,
+	128,
+	{ 462, 168, 921, 186, 982, 53, 313, 672, 469, 142, 470, 321, 652 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_228 = {
+	39,
+	-53,
+	0,
+	{ 699, 963, 531, 26, 732, 730, 399, 852, 28, 362, 426, 252, 149 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_229 = {
+	38,
+	-59,
+	128,
+	{ 407, 591, 836, 600, 571, 595, 867, 696, 323, 587, 894, 3, 88 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_230 = {
+	39,
+	-54,
+	128,
+	{ 687, 875, 307, 59, 981, 550, 79, 219, 338, 230, 225, 402, 154 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_231 = {
+	39,
+	-55,
+	0,
+	{ 614, 77, 95, 98, 359, 824, 160, 409, 723, 22, 135, 434, 698 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_232 = {
+	39,
+	-55,
+	128,
+	{ 375, 156, 899, 140, 185, 452, 230, 59, 488, 762, 638, 426, 157 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_233 = {
+	39,
+	-62,
+	0,
+	{ 875, 347, 68, 314, 775, 104, 626, 883, 774, 142, 638, 298, 393 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_234 = {
+	39,
+	-56,
+	0,
+	{ 499, 25, 759, 70, 130, 781, 16, 439, 544, 144, 270, 437, 158 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_235 = {
+	39,
+	-57,
+	128,
+	{ 585, 260, 652, 971, 885, 838, 108, 287, 685, 271, 553, 661, 707 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_236 = {
+	39,
+	-57,
+	0,
+	{ 418, 259, 925, 260, 449, 788, 725, 230, 279, 947, 575, 600, 157 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_237 = {
+	39,
+	-64,
+	128,
+	{ 625, 942, 629, 425, 314, 687, 92, 455, 137, 626, 773, 318, 176 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_238 = {
+	39,
+	-58,
+	128,
+	{ 859, 188, 533, 3, 678, 181, 592, 885, 155, 648, 914, 117, 155 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_239 = {
+	39,
+	-59,
+	0,
+	{ 447, 409, 984, 392, 268, 688, 317, 885, 330, 477, 989, 706, 685 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_240 = {
+	39,
+	-42,
+	0,
+	{ 409, 910, 623, 977, 542, 748, 165, 223, 992, 463, 936, 307, 531 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_241 = {
+	39,
+	-42,
+	128,
+	{ 392, 187, 401, 604, 225, 836, 864, 882, 693, 353, 437, 166, 592 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_242 = {
+	39,
+	-42,
+	0,
+	{ 906, 691, 328, 488, 183, 279, 771, 482, 804, 671, 209, 878, 270 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_243 = {
+	39,
+	-45,
+	0,
+	{ 384, 666, 816, 390, 944, 32, 212, 787, 32, 266, 323, 235, 790 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_244 = {
+	39,
+	-43,
+	128,
+	{ 216, 624, 682, 464, 88, 890, 92, 875, 196, 756, 936, 396, 815 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_245 = {
+	39,
+	-43,
+	0,
+	{ 918, 694, 471, 41, 619, 775, 3, 965, 624, 310, 275, 168, 561 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_246 = {
+	39,
+	-43,
+	128,
+	{ 712, 312, 98, 374, 749, 259, 673, 755, 433, 828, 165, 291, 183 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_247 = {
+	39,
+	-47,
+	128,
+	{ 854, 5, 677, 546, 192, 414, 256, 478, 330, 60, 345, 961, 307 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_248 = {
+	39,
+	-44,
+	0,
+	{ 536, 912, 376, 745, 529, 728, 673, 908, 360, 880, 536, 515, 346 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_249 = {
+	39,
+	-44,
+	128,
+	{ 53, 285, 695, 582, 254, 527, 269, 37, 586, 960, 273, 913, 202 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_250 = {
+	38,
+	-44,
+	0,
+	{ 708, 768, 318, 620, 758, 999, 88, 37, 490, 631, 928, 887, 57 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_251 = {
+	39,
+	-51,
+	0,
+	{ 608, 608, 637, 231, 579, 480, 933, 698, 665, 382, 67, 863, 233 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_252 = {
+	39,
+	-46,
+	128,
+	{ 567, 459, 262, 179, 243, 85, 505, 352, 48, 633, 74, 860, 882 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_253 = {
+	39,
+	-46,
+	0,
+	{ 18, 426, 852, 595, 770, 150, 32, 278, 81, 804, 588, 359, 474 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_254 = {
+	39,
+	-46,
+	128,
+	{ 335, 73, 783, 214, 611, 130, 457, 824, 103, 207, 150, 454, 125 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_255 = {
+	39,
+	-52,
+	0,
+	{ 562, 442, 900, 18, 303, 668, 134, 247, 29, 801, 885, 964, 864 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_256 = {
+	38,
+	-46,
+	0,
+	{ 599, 371, 634, 238, 777, 435, 708, 62, 264, 979, 58, 846, 16 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_257 = {
+	39,
+	-48,
+	128,
+	{ 577, 595, 584, 448, 200, 861, 855, 472, 759, 357, 282, 549, 857 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_258 = {
+	39,
+	-48,
+	0,
+	{ 514, 902, 929, 680, 258, 759, 884, 251, 321, 292, 249, 982, 215 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_259 = {
+	39,
+	-54,
+	128,
+	{ 644, 804, 425, 455, 999, 777, 834, 386, 615, 47, 52, 323, 761 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_260 = {
+	39,
+	-49,
+	128,
+	{ 591, 76, 544, 9, 699, 815, 135, 437, 361, 85, 220, 398, 266 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_261 = {
+	39,
+	-49,
+	0,
+	{ 197, 515, 177, 289, 880, 279, 948, 572, 110, 366, 5, 657, 130 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_262 = {
+	38,
+	-49,
+	128,
+	{ 179, 363, 834, 9, 107, 899, 681, 976, 367, 902, 163, 799, 31 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_263 = {
+	39,
+	-56,
+	0,
+	{ 939, 747, 30, 492, 194, 674, 23, 147, 743, 136, 612, 97, 471 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_264 = {
+	39,
+	-51,
+	0,
+	{ 295, 651, 923, 174, 89, 284, 964, 670, 634, 427, 8, 28, 369 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_265 = {
+	39,
+	-51,
+	128,
+	{ 569, 891, 272, 385, 580, 612, 879, 253, 14, 462, 740, 126, 176 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_266 = {
+	39,
+	-52,
+	0,
+	{ 109, 328, 153, 650, 614, 771, 988, 797, 147, 605, 678, 906, 417 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_267 = {
+	39,
+	-58,
+	128,
+	{ 138, 365, 826, 61, 976, 773, 581, 58, 788, 791, 793, 446, 253 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_268 = {
+	39,
+	-53,
+	128,
+	{ 2, 991, 216, 920, 440, 756, 17, 455, 160, 200, 594, 206, 463 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_269 = {
+	39,
+	-53,
+	0,
+	{ 466, 548, 804, 615, 860, 692, 936, 287, 464, 596, 548, 514, 216 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_270 = {
+	39,
+	-54,
+	128,
+	{ 296, 582, 140, 506, 604, 295, 825, 160, 762, 409, 176, 765, 503 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_271 = {
+	39,
+	-60,
+	0,
+	{ 691, 991, 393, 690, 692, 757, 209, 704, 969, 877, 786, 886, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_272 = {
+	39,
+	-55,
+	0,
+	{ 212, 752, 811, 734, 640, 282, 24, 498, 306, 896, 669, 686, 538 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_273 = {
+	39,
+	-55,
+	128,
+	{ 173, 630, 852, 235, 198, 634, 36, 774, 148, 876, 523, 681, 247 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_274 = {
+	39,
+	-56,
+	0,
+	{ 222, 403, 831, 546, 456, 912, 171, 708, 677, 309, 33, 362, 567 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_275 = {
+	39,
+	-63,
+	128,
+	{ 958, 181, 676, 11, 764, 68, 676, 92, 563, 256, 862, 642, 647 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_276 = {
+	39,
+	-57,
+	128,
+	{ 162, 287, 872, 115, 167, 492, 849, 654, 810, 501, 46, 448, 589 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_277 = {
+	39,
+	-57,
+	0,
+	{ 716, 263, 794, 621, 61, 979, 941, 548, 220, 62, 714, 425, 267 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_278 = {
+	39,
+	-58,
+	128,
+	{ 677, 12, 785, 761, 732, 994, 622, 879, 573, 470, 856, 850, 604 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_279 = {
+	39,
+	-65,
+	0,
+	{ 543, 365, 357, 760, 30, 493, 563, 477, 525, 87, 418, 229, 329 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_280 = {
+	39,
+	-42,
+	0,
+	{ 682, 654, 523, 108, 625, 279, 254, 671, 377, 892, 606, 367, 344 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_281 = {
+	39,
+	-43,
+	0,
+	{ 818, 822, 58, 2, 843, 57, 337, 219, 59, 826, 90, 179, 517 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_282 = {
+	39,
+	-42,
+	128,
+	{ 537, 326, 12, 580, 90, 635, 116, 363, 422, 811, 610, 931, 334 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_283 = {
+	39,
+	-42,
+	0,
+	{ 463, 978, 777, 707, 110, 722, 273, 702, 323, 476, 515, 269, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_284 = {
+	39,
+	-42,
+	128,
+	{ 845, 4, 789, 500, 824, 396, 235, 310, 847, 446, 822, 765, 109 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_285 = {
+	39,
+	-45,
+	128,
+	{ 238, 623, 107, 588, 954, 579, 794, 853, 844, 954, 90, 410, 127 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_286 = {
+	39,
+	-43,
+	0,
+	{ 9, 622, 712, 933, 73, 715, 570, 441, 636, 115, 515, 444, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_287 = {
+	39,
+	-43,
+	128,
+	{ 712, 722, 892, 681, 442, 324, 614, 326, 113, 57, 888, 634, 182 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_288 = {
+	39,
+	-44,
+	0,
+	{ 624, 382, 843, 70, 121, 178, 894, 239, 505, 973, 494, 769, 578 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_289 = {
+	39,
+	-48,
+	0,
+	{ 623, 501, 565, 398, 418, 813, 981, 39, 627, 393, 893, 875, 493 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_290 = {
+	39,
+	-44,
+	128,
+	{ 524, 944, 633, 209, 566, 98, 338, 427, 260, 140, 670, 953, 105 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_291 = {
+	38,
+	-44,
+	0,
+	{ 512, 76, 489, 400, 625, 883, 785, 74, 104, 761, 143, 667, 61 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_292 = {
+	39,
+	-45,
+	128,
+	{ 865, 387, 265, 914, 693, 669, 378, 619, 604, 590, 733, 629, 175 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_293 = {
+	39,
+	-50,
+	128,
+	{ 384, 66, 835, 452, 245, 200, 70, 387, 154, 870, 732, 744, 129 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_294 = {
+	39,
+	-46,
+	0,
+	{ 537, 930, 341, 428, 250, 920, 368, 598, 896, 628, 360, 542, 269 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_295 = {
+	39,
+	-46,
+	128,
+	{ 759, 486, 511, 110, 136, 807, 768, 709, 312, 87, 529, 783, 145 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_296 = {
+	39,
+	-47,
+	0,
+	{ 936, 195, 832, 89, 968, 195, 807, 499, 617, 938, 595, 764, 388 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_297 = {
+	39,
+	-55,
+	128,
+	{ 295, 492, 961, 714, 779, 711, 553, 212, 941, 101, 225, 100, 388 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_298 = {
+	39,
+	-48,
+	128,
+	{ 728, 816, 759, 984, 625, 812, 93, 672, 728, 387, 417, 799, 532 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_299 = {
+	37,
+	-46,
+	0,
+	{ 648, 250, 876, 874, 938, 597, 512, 484, 331, 764, 797, 743, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_300 = {
+	39,
+	-49,
+	128,
+	{ 898, 246, 523, 110, 905, 162, 942, 790, 56, 207, 609, 579, 699 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_301 = {
+	39,
+	-55,
+	0,
+	{ 468, 662, 223, 653, 68, 132, 801, 809, 684, 748, 638, 998, 258 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_302 = {
+	39,
+	-50,
+	0,
+	{ 731, 523, 647, 352, 794, 13, 841, 808, 963, 966, 909, 668, 885 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_303 = {
+	39,
+	-50,
+	128,
+	{ 497, 53, 536, 276, 857, 343, 155, 95, 131, 587, 881, 316, 440 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_304 = {
+	38,
+	-49,
+	0,
+	{ 406, 412, 27, 915, 722, 727, 899, 653, 91, 947, 561, 865, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_305 = {
+	39,
+	-57,
+	128,
+	{ 36, 510, 245, 212, 786, 228, 760, 774, 166, 474, 884, 679, 204 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_306 = {
+	39,
+	-51,
+	128,
+	{ 715, 967, 689, 254, 588, 908, 201, 392, 929, 216, 944, 697, 129 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_307 = {
+	39,
+	-52,
+	0,
+	{ 877, 258, 886, 344, 683, 418, 543, 821, 772, 914, 205, 892, 627 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_308 = {
+	39,
+	-52,
+	128,
+	{ 291, 956, 117, 647, 923, 237, 746, 962, 793, 716, 483, 129, 151 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_309 = {
+	39,
+	-59,
+	0,
+	{ 398, 709, 485, 637, 543, 341, 605, 995, 973, 737, 454, 83, 117 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_310 = {
+	39,
+	-53,
+	0,
+	{ 191, 105, 743, 954, 211, 821, 724, 317, 787, 801, 791, 379, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_311 = {
+	39,
+	-54,
+	128,
+	{ 338, 785, 626, 647, 240, 116, 824, 214, 522, 449, 36, 349, 817 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_312 = {
+	39,
+	-54,
+	0,
+	{ 314, 400, 999, 709, 661, 909, 512, 919, 847, 55, 50, 903, 192 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_313 = {
+	39,
+	-62,
+	128,
+	{ 164, 187, 933, 756, 222, 662, 21, 528, 155, 946, 47, 872, 587 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_314 = {
+	39,
+	-55,
+	128,
+	{ 33, 302, 559, 828, 41, 397, 584, 999, 37, 796, 330, 201, 212 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_315 = {
+	38,
+	-55,
+	0,
+	{ 724, 347, 966, 452, 869, 224, 216, 527, 277, 605, 514, 947, 98 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_316 = {
+	39,
+	-56,
+	128,
+	{ 342, 479, 859, 273, 990, 250, 790, 932, 674, 693, 300, 843, 229 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_317 = {
+	39,
+	-64,
+	0,
+	{ 169, 834, 14, 968, 487, 533, 608, 60, 284, 220, 115, 997, 278 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_318 = {
+	39,
+	-57,
+	0,
+	{ 989, 408, 800, 641, 986, 480, 592, 421, 808, 61, 718, 475, 245 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_319 = {
+	39,
+	-57,
+	128,
+	{ 297, 308, 495, 643, 643, 100, 862, 937, 358, 130, 540, 899, 112 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_320 = {
+	39,
+	-42,
+	128,
+	{ 313, 692, 622, 726, 919, 34, 922, 418, 309, 595, 918, 623, 652 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_321 = {
+	39,
+	-42,
+	0,
+	{ 198, 445, 983, 764, 516, 357, 993, 279, 87, 672, 720, 498, 839 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_322 = {
+	39,
+	-42,
+	128,
+	{ 679, 376, 560, 50, 953, 87, 61, 5, 721, 541, 98, 297, 438 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_323 = {
+	39,
+	-45,
+	128,
+	{ 166, 702, 72, 362, 97, 911, 136, 197, 55, 842, 145, 909, 696 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_324 = {
+	39,
+	-42,
+	0,
+	{ 284, 10, 261, 623, 726, 845, 373, 478, 675, 420, 466, 448, 166 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_325 = {
+	39,
+	-42,
+	128,
+	{ 668, 246, 664, 461, 1, 344, 853, 185, 692, 797, 176, 835, 127 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_326 = {
+	39,
+	-43,
+	0,
+	{ 187, 636, 489, 704, 32, 361, 61, 429, 130, 369, 326, 995, 462 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_327 = {
+	39,
+	-47,
+	0,
+	{ 678, 615, 219, 232, 294, 749, 162, 771, 270, 792, 986, 790, 455 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_328 = {
+	38,
+	-42,
+	128,
+	{ 758, 232, 287, 31, 850, 823, 471, 195, 805, 125, 271, 595, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_329 = {
+	39,
+	-44,
+	0,
+	{ 847, 431, 269, 749, 740, 73, 273, 662, 516, 486, 290, 334, 678 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_330 = {
+	39,
+	-44,
+	128,
+	{ 804, 444, 376, 229, 680, 972, 469, 42, 588, 662, 766, 754, 210 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_331 = {
+	39,
+	-49,
+	128,
+	{ 679, 559, 107, 912, 614, 181, 993, 449, 171, 328, 314, 137, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_332 = {
+	39,
+	-45,
+	0,
+	{ 9, 2, 544, 298, 937, 344, 380, 793, 109, 161, 774, 358, 377 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_333 = {
+	39,
+	-45,
+	128,
+	{ 872, 71, 389, 114, 606, 244, 578, 665, 228, 1, 67, 675, 218 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_334 = {
+	39,
+	-46,
+	0,
+	{ 909, 262, 808, 159, 202, 22, 577, 690, 892, 401, 880, 22, 622 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_335 = {
+	39,
+	-54,
+	0,
+	{ 902, 536, 434, 515, 25, 310, 341, 61, 300, 673, 382, 770, 659 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_336 = {
+	39,
+	-47,
+	128,
+	{ 308, 968, 319, 658, 581, 733, 133, 577, 568, 742, 649, 38, 959 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_337 = {
+	39,
+	-47,
+	0,
+	{ 936, 993, 241, 752, 495, 735, 588, 776, 80, 228, 449, 321, 521 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_338 = {
+	39,
+	-47,
+	128,
+	{ 916, 802, 224, 201, 702, 862, 552, 85, 357, 839, 895, 915, 139 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_339 = {
+	39,
+	-54,
+	0,
+	{ 806, 670, 271, 704, 665, 481, 390, 496, 57, 906, 899, 205, 538 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_340 = {
+	39,
+	-48,
+	0,
+	{ 785, 925, 143, 220, 418, 533, 652, 452, 677, 754, 142, 847, 194 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_341 = {
+	39,
+	-48,
+	128,
+	{ 618, 253, 922, 381, 109, 897, 518, 816, 896, 563, 875, 272, 101 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_342 = {
+	39,
+	-49,
+	0,
+	{ 906, 656, 909, 790, 984, 520, 646, 257, 549, 972, 471, 773, 260 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_343 = {
+	39,
+	-56,
+	128,
+	{ 867, 6, 713, 671, 211, 343, 644, 921, 329, 999, 869, 41, 509 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_344 = {
+	39,
+	-50,
+	128,
+	{ 144, 93, 140, 294, 493, 105, 919, 917, 545, 748, 644, 214, 337 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_345 = {
+	39,
+	-50,
+	0,
+	{ 465, 799, 658, 187, 491, 826, 865, 673, 85, 408, 891, 530, 169 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_346 = {
+	39,
+	-51,
+	128,
+	{ 882, 952, 387, 820, 540, 482, 47, 423, 915, 861, 545, 162, 423 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_347 = {
+	38,
+	-57,
+	0,
+	{ 249, 516, 307, 771, 65, 819, 480, 693, 704, 480, 327, 823, 33 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_348 = {
+	39,
+	-52,
+	0,
+	{ 846, 951, 637, 997, 587, 279, 647, 84, 121, 361, 369, 139, 517 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_349 = {
+	39,
+	-52,
+	128,
+	{ 385, 707, 254, 401, 982, 699, 962, 461, 388, 832, 198, 378, 253 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_350 = {
+	39,
+	-53,
+	0,
+	{ 561, 131, 645, 154, 442, 267, 411, 145, 528, 162, 755, 289, 617 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_351 = {
+	39,
+	-60,
+	128,
+	{ 944, 320, 656, 877, 639, 194, 374, 223, 530, 573, 930, 328, 193 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_352 = {
+	39,
+	-54,
+	128,
+	{ 656, 113, 510, 328, 536, 906, 486, 32, 189, 102, 521, 484, 721 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_353 = {
+	38,
+	-53,
+	0,
+	{ 157, 382, 830, 93, 423, 386, 828, 340, 219, 965, 629, 631, 34 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_354 = {
+	38,
+	-54,
+	128,
+	{ 448, 248, 428, 257, 160, 275, 369, 203, 294, 952, 587, 743, 82 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_355 = {
+	39,
+	-62,
+	0,
+	{ 966, 552, 869, 512, 702, 257, 829, 278, 328, 265, 615, 877, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_356 = {
+	39,
+	-56,
+	0,
+	{ 272, 404, 154, 950, 566, 621, 454, 176, 964, 471, 726, 807, 932 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_357 = {
+	39,
+	-56,
+	128,
+	{ 878, 294, 460, 771, 287, 726, 600, 314, 667, 630, 205, 308, 440 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_358 = {
+	39,
+	-56,
+	0,
+	{ 551, 539, 582, 346, 877, 333, 344, 546, 347, 997, 988, 531, 103 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_359 = {
+	39,
+	-65,
+	128,
+	{ 351, 661, 229, 639, 247, 976, 169, 817, 277, 370, 417, 420, 532 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_360 = {
+	39,
+	-42,
+	128,
+	{ 959, 604, 459, 179, 67, 390, 124, 250, 746, 192, 290, 761, 596 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_361 = {
+	39,
+	-43,
+	128,
+	{ 63, 52, 15, 225, 930, 571, 908, 55, 1, 602, 541, 489, 720 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_362 = {
+	38,
+	-41,
+	0,
+	{ 551, 342, 67, 600, 116, 195, 616, 283, 673, 376, 88, 823, 67 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_363 = {
+	39,
+	-42,
+	128,
+	{ 992, 778, 354, 582, 652, 45, 100, 845, 275, 26, 526, 147, 640 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_364 = {
+	39,
+	-42,
+	0,
+	{ 37, 463, 845, 205, 518, 374, 992, 44, 287, 343, 76, 501, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_365 = {
+	39,
+	-45,
+	0,
+	{ 907, 201, 325, 30, 554, 686, 461, 510, 651, 804, 83, 970, 181 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_366 = {
+	39,
+	-43,
+	128,
+	{ 838, 85, 810, 632, 559, 732, 239, 318, 850, 706, 711, 950, 847 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_367 = {
+	38,
+	-42,
+	0,
+	{ 806, 945, 85, 274, 912, 470, 176, 310, 15, 825, 920, 51, 61 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_368 = {
+	39,
+	-43,
+	128,
+	{ 468, 306, 773, 893, 255, 975, 82, 624, 48, 834, 201, 739, 210 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_369 = {
+	39,
+	-48,
+	128,
+	{ 525, 545, 492, 750, 802, 724, 921, 938, 559, 412, 901, 858, 885 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_370 = {
+	39,
+	-44,
+	0,
+	{ 403, 80, 889, 163, 938, 975, 108, 771, 53, 538, 359, 845, 452 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_371 = {
+	37,
+	-42,
+	128,
+	{ 904, 374, 931, 759, 726, 802, 793, 440, 250, 502, 781, 842, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_372 = {
+	39,
+	-45,
+	0,
+	{ 651, 562, 454, 189, 237, 231, 761, 116, 464, 786, 417, 823, 870 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_373 = {
+	38,
+	-49,
+	0,
+	{ 235, 380, 615, 73, 994, 144, 492, 965, 706, 871, 101, 886, 36 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_374 = {
+	39,
+	-45,
+	128,
+	{ 271, 570, 960, 724, 265, 664, 378, 610, 20, 907, 951, 446, 153 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_375 = {
+	39,
+	-46,
+	0,
+	{ 303, 959, 28, 585, 256, 134, 569, 497, 69, 879, 677, 246, 886 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_376 = {
+	39,
+	-46,
+	128,
+	{ 779, 657, 146, 72, 622, 156, 341, 173, 268, 18, 123, 848, 251 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_377 = {
+	39,
+	-52,
+	128,
+	{ 453, 617, 811, 483, 516, 191, 314, 924, 150, 982, 120, 259, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_378 = {
+	38,
+	-46,
+	0,
+	{ 684, 16, 636, 392, 4, 551, 712, 776, 154, 758, 470, 969, 38 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_379 = {
+	39,
+	-47,
+	128,
+	{ 613, 217, 517, 705, 74, 970, 290, 347, 356, 922, 47, 673, 212 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_380 = {
+	39,
+	-48,
+	0,
+	{ 288, 267, 408, 222, 959, 290, 345, 847, 513, 280, 355, 701, 573 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_381 = {
+	39,
+	-57,
+	128,
+	{ 41, 357, 389, 599, 467, 720, 667, 154, 971, 16, 985, 774, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_382 = {
+	39,
+	-49,
+	128,
+	{ 772, 903, 317, 713, 310, 800, 307, 658, 578, 946, 386, 315, 809 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_383 = {
+	39,
+	-49,
+	0,
+	{ 756, 869, 606, 376, 805, 989, 901, 994, 491, 834, 232, 827, 423 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_384 = {
+	39,
+	-49,
+	128,
+	{ 327, 401, 34, 191, 254, 743, 539, 256, 77, 342, 245, 22, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_385 = {
+	39,
+	-57,
+	0,
+	{ 5, 643, 148, 346, 787, 869, 824, 343, 28, 68, 77, 276, 233 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_386 = {
+	39,
+	-50,
+	0,
+	{ 325, 611, 260, 4, 206, 121, 132, 722, 757, 291, 37, 799, 144 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_387 = {
+	39,
+	-51,
+	128,
+	{ 713, 442, 797, 329, 571, 875, 980, 158, 314, 738, 778, 796, 734 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_388 = {
+	38,
+	-50,
+	0,
+	{ 394, 850, 265, 225, 750, 83, 453, 748, 758, 673, 691, 518, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_389 = {
+	39,
+	-59,
+	128,
+	{ 498, 806, 237, 636, 644, 203, 401, 251, 668, 689, 684, 875, 198 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_390 = {
+	39,
+	-52,
+	128,
+	{ 6, 558, 261, 757, 816, 824, 610, 408, 104, 895, 54, 875, 230 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_391 = {
+	39,
+	-52,
+	0,
+	{ 358, 360, 630, 491, 916, 584, 975, 546, 792, 993, 378, 284, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_392 = {
+	39,
+	-53,
+	128,
+	{ 745, 487, 398, 96, 25, 939, 836, 409, 140, 187, 193, 328, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_393 = {
+	39,
+	-61,
+	0,
+	{ 96, 215, 174, 837, 489, 995, 796, 948, 463, 105, 557, 61, 122 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_394 = {
+	39,
+	-54,
+	0,
+	{ 92, 854, 186, 5, 568, 78, 618, 268, 849, 357, 786, 810, 335 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_395 = {
+	39,
+	-54,
+	128,
+	{ 968, 32, 933, 901, 313, 504, 510, 666, 373, 140, 36, 914, 162 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_396 = {
+	39,
+	-55,
+	0,
+	{ 138, 643, 889, 570, 401, 794, 197, 731, 31, 679, 554, 421, 393 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_397 = {
+	39,
+	-64,
+	128,
+	{ 707, 849, 862, 209, 626, 680, 684, 929, 522, 857, 47, 681, 651 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_398 = {
+	39,
+	-56,
+	128,
+	{ 612, 949, 92, 322, 73, 892, 799, 487, 414, 71, 757, 134, 453 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_399 = {
+	39,
+	-56,
+	0,
+	{ 146, 30, 352, 198, 87, 609, 987, 41, 265, 225, 273, 199, 216 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_400 = {
+	39,
+	-41,
+	0,
+	{ 262, 968, 717, 432, 993, 694, 712, 563, 6, 948, 544, 244, 133 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_401 = {
+	39,
+	-41,
+	128,
+	{ 488, 254, 852, 832, 885, 89, 650, 752, 547, 856, 849, 443, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_402 = {
+	39,
+	-41,
+	0,
+	{ 22, 220, 675, 292, 463, 74, 396, 373, 966, 345, 691, 893, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_403 = {
+	39,
+	-45,
+	0,
+	{ 488, 566, 817, 75, 262, 295, 742, 896, 229, 264, 412, 240, 993 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_404 = {
+	39,
+	-42,
+	128,
+	{ 76, 774, 956, 305, 25, 393, 848, 989, 931, 930, 12, 745, 508 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_405 = {
+	39,
+	-42,
+	0,
+	{ 946, 439, 404, 600, 711, 322, 284, 843, 928, 653, 566, 350, 427 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_406 = {
+	39,
+	-42,
+	128,
+	{ 793, 58, 382, 662, 814, 552, 33, 988, 107, 679, 537, 588, 168 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_407 = {
+	39,
+	-47,
+	128,
+	{ 399, 863, 345, 642, 463, 221, 643, 979, 849, 227, 939, 18, 813 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_408 = {
+	39,
+	-43,
+	0,
+	{ 58, 308, 325, 839, 539, 685, 350, 471, 621, 705, 23, 844, 452 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_409 = {
+	38,
+	-42,
+	128,
+	{ 116, 33, 670, 258, 733, 705, 257, 340, 817, 747, 536, 270, 31 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_410 = {
+	39,
+	-43,
+	0,
+	{ 14, 24, 728, 180, 988, 968, 826, 800, 33, 853, 682, 498, 104 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_411 = {
+	39,
+	-49,
+	0,
+	{ 534, 422, 797, 359, 179, 775, 604, 255, 809, 656, 262, 352, 484 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_412 = {
+	39,
+	-44,
+	128,
+	{ 104, 714, 953, 631, 962, 840, 987, 579, 562, 734, 658, 825, 214 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_413 = {
+	39,
+	-44,
+	0,
+	{ 837, 662, 223, 200, 364, 227, 446, 202, 749, 109, 970, 936, 132 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_414 = {
+	39,
+	-45,
+	128,
+	{ 989, 14, 700, 511, 27, 835, 159, 290, 10, 921, 930, 956, 402 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_415 = {
+	39,
+	-51,
+	128,
+	{ 252, 610, 481, 167, 882, 107, 488, 906, 232, 663, 776, 678, 175 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_416 = {
+	39,
+	-46,
+	0,
+	{ 439, 654, 173, 370, 111, 139, 156, 571, 682, 636, 431, 450, 701 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_417 = {
+	39,
+	-46,
+	128,
+	{ 937, 791, 869, 433, 466, 399, 910, 297, 948, 499, 773, 78, 404 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_418 = {
+	39,
+	-46,
+	0,
+	{ 469, 370, 403, 679, 178, 133, 513, 634, 719, 433, 267, 740, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_419 = {
+	39,
+	-56,
+	0,
+	{ 786, 649, 717, 958, 981, 212, 802, 424, 639, 535, 468, 427, 396 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_420 = {
+	39,
+	-47,
+	128,
+	{ 618, 595, 525, 578, 510, 962, 509, 137, 927, 698, 382, 49, 178 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_421 = {
+	39,
+	-48,
+	0,
+	{ 819, 704, 426, 678, 771, 1, 806, 464, 316, 487, 625, 802, 974 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_422 = {
+	39,
+	-48,
+	128,
+	{ 614, 654, 360, 925, 697, 244, 825, 159, 76, 765, 386, 53, 264 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_423 = {
+	39,
+	-56,
+	0,
+	{ 773, 526, 44, 486, 463, 612, 582, 9, 376, 340, 516, 487, 579 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_424 = {
+	38,
+	-48,
+	0,
+	{ 423, 104, 215, 842, 499, 487, 366, 836, 543, 553, 749, 647, 37 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_425 = {
+	39,
+	-49,
+	128,
+	{ 488, 393, 921, 570, 528, 858, 385, 794, 782, 675, 129, 395, 198 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_426 = {
+	39,
+	-50,
+	0,
+	{ 86, 702, 622, 219, 554, 598, 465, 862, 813, 674, 365, 523, 518 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_427 = {
+	39,
+	-58,
+	128,
+	{ 362, 569, 809, 816, 828, 798, 843, 524, 940, 826, 255, 916, 574 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_428 = {
+	39,
+	-51,
+	128,
+	{ 497, 990, 963, 212, 510, 974, 335, 440, 281, 843, 163, 625, 692 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_429 = {
+	39,
+	-51,
+	0,
+	{ 854, 722, 696, 467, 987, 340, 879, 714, 80, 537, 574, 281, 354 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_430 = {
+	39,
+	-52,
+	128,
+	{ 489, 966, 541, 533, 749, 259, 655, 422, 37, 500, 217, 250, 900 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_431 = {
+	39,
+	-60,
+	0,
+	{ 322, 879, 652, 232, 344, 759, 943, 134, 407, 626, 360, 871, 401 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_432 = {
+	39,
+	-52,
+	0,
+	{ 782, 98, 834, 293, 133, 781, 225, 176, 456, 311, 667, 175, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_433 = {
+	39,
+	-53,
+	128,
+	{ 16, 156, 801, 107, 276, 348, 506, 569, 38, 287, 126, 199, 570 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_434 = {
+	39,
+	-53,
+	0,
+	{ 923, 290, 610, 551, 244, 163, 236, 198, 16, 643, 759, 631, 141 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_435 = {
+	39,
+	-62,
+	128,
+	{ 464, 261, 354, 24, 221, 967, 304, 533, 524, 491, 562, 632, 240 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_436 = {
+	39,
+	-54,
+	128,
+	{ 291, 141, 895, 766, 690, 148, 52, 729, 5, 657, 207, 191, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_437 = {
+	39,
+	-55,
+	0,
+	{ 435, 671, 353, 245, 468, 392, 740, 495, 255, 456, 165, 177, 843 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_438 = {
+	39,
+	-55,
+	128,
+	{ 119, 313, 215, 913, 885, 262, 817, 742, 845, 684, 114, 538, 205 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_439 = {
+	38,
+	-63,
+	0,
+	{ 892, 644, 664, 498, 483, 679, 28, 989, 300, 248, 504, 300, 13 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_440 = {
+	39,
+	-41,
+	0,
+	{ 881, 21, 733, 307, 631, 785, 908, 495, 83, 73, 766, 972, 157 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_441 = {
+	39,
+	-42,
+	0,
+	{ 106, 998, 270, 980, 123, 635, 898, 816, 915, 783, 262, 516, 162 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_442 = {
+	39,
+	-41,
+	128,
+	{ 104, 817, 276, 690, 467, 284, 645, 762, 432, 355, 210, 334, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_443 = {
+	39,
+	-41,
+	0,
+	{ 119, 947, 693, 797, 922, 61, 541, 981, 890, 856, 861, 896, 213 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_444 = {
+	39,
+	-41,
+	128,
+	{ 574, 375, 479, 712, 801, 85, 708, 31, 630, 912, 593, 85, 101 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_445 = {
+	39,
+	-45,
+	128,
+	{ 875, 469, 409, 914, 531, 234, 99, 9, 192, 299, 55, 127, 399 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_446 = {
+	39,
+	-42,
+	0,
+	{ 893, 423, 293, 410, 306, 488, 649, 911, 646, 847, 250, 350, 362 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_447 = {
+	39,
+	-42,
+	128,
+	{ 637, 999, 724, 97, 977, 521, 682, 540, 121, 637, 14, 439, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_448 = {
+	38,
+	-41,
+	0,
+	{ 535, 820, 294, 849, 509, 611, 230, 887, 495, 336, 513, 449, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_449 = {
+	39,
+	-47,
+	0,
+	{ 323, 599, 522, 198, 488, 347, 787, 974, 302, 918, 184, 114, 212 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_450 = {
+	37,
+	-41,
+	128,
+	{ 458, 520, 726, 121, 899, 861, 177, 784, 194, 725, 941, 577, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_451 = {
+	39,
+	-43,
+	0,
+	{ 699, 696, 191, 505, 403, 927, 446, 625, 404, 560, 189, 818, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_452 = {
+	39,
+	-44,
+	128,
+	{ 247, 267, 490, 762, 608, 547, 669, 815, 42, 729, 738, 137, 564 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_453 = {
+	39,
+	-49,
+	128,
+	{ 433, 837, 760, 112, 581, 24, 436, 742, 761, 57, 201, 243, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_454 = {
+	39,
+	-44,
+	0,
+	{ 503, 655, 796, 878, 349, 449, 839, 746, 951, 188, 244, 232, 112 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_455 = {
+	39,
+	-45,
+	128,
+	{ 701, 131, 551, 298, 398, 900, 240, 350, 267, 795, 963, 933, 686 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_456 = {
+	39,
+	-45,
+	0,
+	{ 561, 885, 69, 398, 936, 6, 951, 872, 148, 754, 369, 532, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_457 = {
+	39,
+	-52,
+	0,
+	{ 401, 26, 131, 351, 765, 13, 93, 69, 385, 98, 724, 147, 467 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_458 = {
+	39,
+	-46,
+	128,
+	{ 855, 897, 13, 860, 739, 500, 75, 554, 490, 649, 861, 98, 356 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_459 = {
+	39,
+	-46,
+	0,
+	{ 92, 118, 901, 996, 75, 661, 537, 633, 59, 459, 553, 708, 204 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_460 = {
+	39,
+	-47,
+	128,
+	{ 575, 720, 81, 116, 616, 751, 723, 575, 833, 332, 386, 917, 580 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_461 = {
+	39,
+	-54,
+	128,
+	{ 158, 241, 790, 601, 866, 0, 204, 482, 286, 758, 128, 282, 133 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_462 = {
+	39,
+	-48,
+	0,
+	{ 3, 425, 886, 330, 147, 950, 484, 329, 351, 913, 43, 546, 903 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_463 = {
+	39,
+	-48,
+	128,
+	{ 342, 36, 840, 506, 115, 389, 355, 340, 308, 173, 825, 987, 495 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_464 = {
+	39,
+	-48,
+	0,
+	{ 231, 841, 679, 461, 188, 375, 694, 489, 997, 293, 71, 816, 134 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_465 = {
+	39,
+	-59,
+	128,
+	{ 139, 579, 742, 147, 885, 123, 995, 510, 939, 865, 849, 37, 167 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_466 = {
+	39,
+	-49,
+	128,
+	{ 818, 25, 633, 539, 859, 325, 736, 788, 255, 39, 49, 935, 193 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_467 = {
+	39,
+	-49,
+	0,
+	{ 767, 574, 373, 101, 7, 380, 916, 96, 199, 664, 656, 741, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_468 = {
+	39,
+	-50,
+	128,
+	{ 413, 944, 245, 465, 898, 256, 205, 490, 618, 12, 63, 75, 270 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_469 = {
+	39,
+	-59,
+	0,
+	{ 634, 645, 155, 401, 463, 460, 84, 242, 859, 165, 961, 606, 332 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_470 = {
+	39,
+	-51,
+	0,
+	{ 633, 714, 709, 609, 597, 191, 912, 796, 497, 253, 137, 362, 365 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_471 = {
+	39,
+	-51,
+	128,
+	{ 711, 97, 989, 920, 371, 336, 288, 329, 481, 699, 711, 165, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_472 = {
+	39,
+	-52,
+	0,
+	{ 69, 937, 662, 905, 867, 362, 796, 803, 38, 452, 981, 547, 481 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_473 = {
+	39,
+	-61,
+	128,
+	{ 25, 43, 451, 904, 609, 792, 481, 226, 177, 281, 812, 442, 299 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_474 = {
+	39,
+	-53,
+	128,
+	{ 96, 864, 39, 146, 322, 365, 564, 789, 210, 666, 348, 888, 619 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_475 = {
+	39,
+	-53,
+	0,
+	{ 97, 891, 634, 752, 410, 32, 666, 225, 819, 231, 551, 975, 311 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_476 = {
+	38,
+	-53,
+	128,
+	{ 911, 893, 327, 228, 959, 788, 54, 163, 177, 500, 483, 104, 78 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_477 = {
+	39,
+	-63,
+	0,
+	{ 677, 855, 253, 928, 627, 307, 890, 77, 254, 398, 977, 809, 193 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_478 = {
+	39,
+	-55,
+	0,
+	{ 111, 17, 654, 16, 292, 693, 620, 163, 600, 597, 2, 16, 965 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_479 = {
+	39,
+	-55,
+	128,
+	{ 359, 803, 378, 929, 475, 575, 316, 605, 917, 885, 65, 446, 476 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_480 = {
+	39,
+	-41,
+	128,
+	{ 939, 600, 544, 914, 97, 281, 727, 664, 401, 951, 211, 251, 407 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_481 = {
+	38,
+	-40,
+	0,
+	{ 304, 958, 657, 902, 380, 236, 948, 697, 80, 338, 628, 33, 64 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_482 = {
+	39,
+	-41,
+	128,
+	{ 596, 878, 94, 518, 858, 974, 473, 177, 766, 816, 610, 101, 404 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_483 = {
+	38,
+	-43,
+	128,
+	{ 157, 721, 84, 938, 447, 214, 817, 329, 662, 28, 328, 837, 21 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_484 = {
+	37,
+	-39,
+	0,
+	{ 252, 993, 477, 136, 842, 906, 862, 463, 125, 180, 44, 174, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_485 = {
+	39,
+	-41,
+	128,
+	{ 75, 626, 667, 987, 126, 528, 373, 915, 188, 184, 405, 4, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_486 = {
+	39,
+	-42,
+	0,
+	{ 762, 943, 55, 612, 376, 244, 672, 577, 624, 479, 697, 954, 835 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_487 = {
+	39,
+	-46,
+	0,
+	{ 633, 190, 391, 659, 823, 728, 896, 547, 96, 671, 475, 454, 194 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_488 = {
+	39,
+	-42,
+	128,
+	{ 589, 748, 419, 185, 873, 353, 473, 963, 216, 204, 871, 793, 257 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_489 = {
+	39,
+	-42,
+	0,
+	{ 229, 29, 533, 339, 812, 989, 128, 35, 393, 681, 873, 99, 190 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_490 = {
+	39,
+	-43,
+	128,
+	{ 624, 922, 872, 329, 766, 64, 177, 648, 389, 374, 999, 964, 676 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_491 = {
+	39,
+	-48,
+	128,
+	{ 46, 79, 392, 418, 886, 423, 971, 723, 265, 664, 296, 406, 144 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_492 = {
+	39,
+	-43,
+	0,
+	{ 252, 21, 274, 42, 363, 665, 233, 690, 422, 187, 125, 125, 157 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_493 = {
+	39,
+	-43,
+	128,
+	{ 528, 644, 972, 449, 796, 641, 500, 931, 768, 447, 87, 40, 103 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_494 = {
+	39,
+	-44,
+	0,
+	{ 457, 75, 919, 337, 713, 499, 970, 704, 138, 740, 776, 451, 330 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_495 = {
+	39,
+	-51,
+	0,
+	{ 381, 244, 655, 704, 317, 213, 89, 109, 257, 423, 602, 297, 798 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_496 = {
+	39,
+	-45,
+	128,
+	{ 582, 987, 775, 613, 252, 920, 68, 36, 130, 493, 941, 977, 640 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_497 = {
+	39,
+	-45,
+	0,
+	{ 672, 200, 286, 407, 427, 672, 266, 557, 0, 613, 247, 946, 388 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_498 = {
+	39,
+	-45,
+	128,
+	{ 507, 464, 695, 455, 102, 94, 227, 693, 488, 449, 476, 183, 116 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_499 = {
+	39,
+	-53,
+	128,
+	{ 429, 486, 474, 220, 268, 530, 168, 225, 644, 59, 863, 680, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_500 = {
+	39,
+	-46,
+	0,
+	{ 899, 985, 187, 295, 191, 177, 89, 928, 970, 112, 129, 780, 198 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_501 = {
+	39,
+	-46,
+	128,
+	{ 256, 801, 279, 928, 653, 868, 771, 106, 575, 563, 199, 77, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_502 = {
+	39,
+	-47,
+	0,
+	{ 603, 959, 690, 804, 20, 775, 220, 545, 855, 641, 570, 558, 323 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_503 = {
+	39,
+	-58,
+	0,
+	{ 847, 447, 356, 869, 712, 809, 487, 777, 848, 664, 624, 594, 417 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_504 = {
+	39,
+	-48,
+	128,
+	{ 217, 872, 688, 275, 396, 631, 211, 243, 58, 181, 127, 231, 504 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_505 = {
+	39,
+	-48,
+	0,
+	{ 396, 462, 827, 132, 590, 537, 801, 170, 707, 861, 472, 402, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_506 = {
+	39,
+	-49,
+	128,
+	{ 138, 308, 130, 877, 723, 757, 72, 770, 813, 166, 176, 210, 756 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_507 = {
+	39,
+	-58,
+	0,
+	{ 656, 9, 54, 494, 741, 668, 248, 911, 409, 453, 643, 447, 960 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_508 = {
+	39,
+	-49,
+	0,
+	{ 675, 5, 750, 645, 113, 742, 376, 161, 56, 157, 641, 608, 109 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_509 = {
+	39,
+	-50,
+	128,
+	{ 805, 34, 972, 506, 708, 78, 326, 261, 871, 190, 706, 313, 583 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_510 = {
+	39,
+	-50,
+	0,
+	{ 271, 372, 815, 399, 25, 957, 20, 760, 889, 48, 354, 95, 154 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_511 = {
+	39,
+	-60,
+	128,
+	{ 141, 778, 470, 992, 230, 570, 695, 821, 434, 308, 528, 59, 986 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_512 = {
+	39,
+	-51,
+	128,
+	{ 967, 428, 26, 458, 786, 600, 899, 535, 185, 535, 38, 762, 210 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_513 = {
+	39,
+	-51,
+	0,
+	{ 789, 966, 202, 700, 487, 248, 582, 156, 529, 926, 442, 191, 109 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_514 = {
+	39,
+	-52,
+	128,
+	{ 587, 749, 676, 536, 244, 52, 719, 505, 291, 591, 140, 176, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_515 = {
+	39,
+	-62,
+	0,
+	{ 678, 199, 215, 992, 254, 321, 566, 608, 383, 911, 950, 992, 715 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_516 = {
+	39,
+	-53,
+	0,
+	{ 713, 170, 127, 274, 393, 411, 228, 428, 291, 980, 80, 706, 366 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_517 = {
+	38,
+	-52,
+	128,
+	{ 475, 697, 656, 44, 514, 72, 488, 971, 274, 569, 396, 581, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_518 = {
+	39,
+	-54,
+	0,
+	{ 129, 760, 79, 338, 432, 96, 354, 398, 262, 488, 554, 440, 468 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_519 = {
+	39,
+	-64,
+	128,
+	{ 191, 419, 623, 253, 225, 145, 185, 369, 363, 860, 748, 761, 444 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_520 = {
+	39,
+	-41,
+	128,
+	{ 512, 229, 663, 360, 447, 828, 453, 28, 930, 839, 793, 757, 594 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_521 = {
+	39,
+	-42,
+	128,
+	{ 547, 735, 241, 570, 508, 467, 180, 515, 604, 892, 767, 164, 540 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_522 = {
+	38,
+	-40,
+	0,
+	{ 203, 70, 122, 102, 891, 580, 189, 898, 767, 550, 413, 910, 87 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_523 = {
+	39,
+	-41,
+	128,
+	{ 595, 708, 933, 346, 889, 411, 612, 251, 561, 878, 155, 763, 985 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_524 = {
+	39,
+	-41,
+	0,
+	{ 894, 532, 42, 576, 5, 83, 62, 379, 215, 310, 950, 346, 501 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_525 = {
+	39,
+	-44,
+	0,
+	{ 716, 19, 30, 317, 976, 886, 711, 746, 218, 862, 217, 75, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_526 = {
+	39,
+	-41,
+	128,
+	{ 467, 691, 23, 814, 500, 823, 838, 833, 546, 427, 193, 260, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_527 = {
+	39,
+	-41,
+	0,
+	{ 348, 877, 230, 552, 144, 120, 562, 580, 230, 735, 285, 91, 171 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_528 = {
+	39,
+	-42,
+	128,
+	{ 821, 178, 448, 830, 555, 752, 695, 986, 337, 141, 127, 953, 676 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_529 = {
+	39,
+	-47,
+	128,
+	{ 963, 742, 387, 893, 953, 249, 890, 331, 621, 765, 456, 115, 690 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_530 = {
+	39,
+	-42,
+	0,
+	{ 881, 817, 767, 258, 496, 92, 301, 16, 959, 439, 281, 551, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_531 = {
+	39,
+	-42,
+	128,
+	{ 941, 939, 87, 948, 577, 756, 395, 685, 919, 634, 156, 952, 133 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_532 = {
+	39,
+	-43,
+	0,
+	{ 748, 166, 811, 79, 727, 737, 834, 386, 280, 335, 830, 631, 462 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_533 = {
+	39,
+	-49,
+	0,
+	{ 663, 377, 223, 343, 259, 750, 216, 515, 213, 133, 306, 342, 400 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_534 = {
+	38,
+	-42,
+	128,
+	{ 379, 804, 607, 572, 655, 769, 550, 32, 494, 921, 652, 255, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_535 = {
+	39,
+	-44,
+	0,
+	{ 438, 432, 178, 247, 636, 128, 534, 103, 765, 279, 637, 208, 661 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_536 = {
+	39,
+	-44,
+	128,
+	{ 325, 184, 775, 255, 168, 557, 831, 81, 530, 272, 220, 130, 209 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_537 = {
+	39,
+	-51,
+	128,
+	{ 716, 126, 720, 443, 682, 596, 149, 206, 38, 496, 756, 517, 209 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_538 = {
+	39,
+	-45,
+	0,
+	{ 219, 301, 653, 831, 29, 40, 140, 465, 932, 419, 290, 560, 397 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_539 = {
+	39,
+	-45,
+	128,
+	{ 261, 211, 797, 142, 958, 739, 681, 873, 158, 788, 119, 562, 239 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_540 = {
+	39,
+	-46,
+	0,
+	{ 579, 382, 363, 766, 880, 788, 627, 640, 458, 821, 833, 828, 711 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_541 = {
+	39,
+	-54,
+	0,
+	{ 434, 856, 96, 738, 681, 997, 819, 164, 325, 171, 487, 557, 892 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_542 = {
+	39,
+	-46,
+	128,
+	{ 18, 106, 518, 745, 105, 868, 77, 763, 646, 350, 472, 15, 121 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_543 = {
+	39,
+	-47,
+	0,
+	{ 677, 629, 271, 934, 47, 565, 185, 904, 343, 483, 182, 506, 693 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_544 = {
+	39,
+	-47,
+	128,
+	{ 103, 643, 586, 50, 871, 922, 751, 892, 560, 538, 644, 614, 196 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_545 = {
+	39,
+	-56,
+	128,
+	{ 607, 582, 394, 203, 560, 140, 37, 676, 420, 732, 863, 320, 259 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_546 = {
+	39,
+	-48,
+	0,
+	{ 953, 872, 862, 530, 197, 54, 970, 874, 754, 297, 196, 904, 306 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_547 = {
+	39,
+	-48,
+	128,
+	{ 38, 260, 503, 267, 266, 535, 842, 650, 556, 811, 974, 160, 169 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_548 = {
+	39,
+	-49,
+	0,
+	{ 679, 693, 38, 382, 149, 401, 434, 124, 312, 398, 61, 286, 462 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_549 = {
+	38,
+	-60,
+	128,
+	{ 409, 279, 626, 339, 757, 401, 573, 189, 495, 853, 416, 567, 23 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_550 = {
+	39,
+	-50,
+	128,
+	{ 229, 609, 611, 290, 943, 522, 148, 948, 663, 933, 523, 438, 674 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_551 = {
+	39,
+	-50,
+	0,
+	{ 216, 540, 458, 728, 80, 626, 672, 407, 827, 665, 761, 331, 360 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_552 = {
+	39,
+	-51,
+	128,
+	{ 694, 141, 762, 414, 898, 776, 609, 19, 126, 564, 877, 998, 955 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_553 = {
+	39,
+	-61,
+	0,
+	{ 455, 732, 616, 624, 690, 126, 840, 280, 591, 305, 839, 528, 690 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_554 = {
+	39,
+	-51,
+	0,
+	{ 349, 187, 556, 699, 120, 107, 577, 539, 730, 189, 189, 14, 132 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_555 = {
+	39,
+	-52,
+	128,
+	{ 712, 625, 361, 188, 902, 579, 837, 719, 523, 67, 673, 511, 687 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_556 = {
+	39,
+	-52,
+	0,
+	{ 4, 57, 598, 301, 579, 671, 854, 44, 760, 678, 410, 7, 178 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_557 = {
+	39,
+	-63,
+	128,
+	{ 521, 177, 402, 656, 127, 436, 141, 580, 277, 200, 560, 821, 647 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_558 = {
+	39,
+	-53,
+	128,
+	{ 356, 504, 17, 839, 649, 800, 751, 458, 428, 754, 83, 847, 234 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_559 = {
+	39,
+	-53,
+	0,
+	{ 65, 466, 573, 956, 541, 444, 782, 676, 38, 734, 716, 719, 119 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_560 = {
+	39,
+	-40,
+	0,
+	{ 954, 667, 676, 175, 557, 893, 661, 114, 227, 875, 277, 20, 174 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_561 = {
+	39,
+	-40,
+	128,
+	{ 466, 244, 938, 546, 510, 406, 54, 205, 991, 456, 809, 278, 295 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_562 = {
+	39,
+	-40,
+	0,
+	{ 938, 569, 369, 451, 614, 954, 992, 987, 27, 714, 755, 458, 200 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_563 = {
+	39,
+	-44,
+	0,
+	{ 268, 114, 965, 965, 583, 581, 964, 70, 34, 669, 159, 895, 702 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_564 = {
+	39,
+	-40,
+	128,
+	{ 899, 132, 532, 636, 943, 677, 359, 477, 431, 713, 210, 754, 123 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_565 = {
+	39,
+	-40,
+	0,
+	{ 223, 288, 269, 365, 288, 495, 870, 544, 352, 442, 934, 762, 119 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_566 = {
+	39,
+	-41,
+	128,
+	{ 299, 785, 711, 606, 92, 584, 752, 252, 185, 665, 384, 560, 541 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_567 = {
+	39,
+	-46,
+	128,
+	{ 997, 258, 278, 452, 217, 141, 559, 160, 186, 964, 933, 908, 632 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_568 = {
+	39,
+	-41,
+	0,
+	{ 435, 555, 20, 254, 71, 734, 360, 645, 50, 290, 181, 551, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_569 = {
+	39,
+	-41,
+	128,
+	{ 383, 148, 146, 600, 596, 699, 356, 96, 500, 482, 327, 347, 147 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_570 = {
+	39,
+	-42,
+	0,
+	{ 964, 204, 109, 307, 24, 879, 307, 867, 83, 977, 100, 158, 555 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_571 = {
+	39,
+	-48,
+	0,
+	{ 304, 879, 237, 12, 879, 900, 9, 625, 506, 125, 344, 68, 524 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_572 = {
+	39,
+	-42,
+	128,
+	{ 832, 474, 323, 855, 164, 551, 448, 355, 848, 357, 135, 579, 143 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_573 = {
+	39,
+	-43,
+	0,
+	{ 524, 8, 802, 990, 352, 309, 252, 967, 432, 249, 932, 812, 991 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_574 = {
+	39,
+	-43,
+	128,
+	{ 778, 818, 145, 915, 382, 280, 340, 109, 783, 494, 347, 608, 334 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_575 = {
+	39,
+	-50,
+	128,
+	{ 834, 444, 240, 852, 242, 707, 948, 652, 989, 910, 372, 558, 357 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_576 = {
+	39,
+	-44,
+	0,
+	{ 162, 983, 323, 876, 48, 305, 638, 761, 300, 606, 519, 608, 715 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_577 = {
+	39,
+	-44,
+	128,
+	{ 524, 553, 653, 310, 832, 754, 195, 260, 555, 281, 26, 168, 455 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_578 = {
+	39,
+	-44,
+	0,
+	{ 331, 836, 49, 79, 607, 192, 152, 747, 714, 492, 766, 365, 142 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_579 = {
+	39,
+	-52,
+	0,
+	{ 504, 349, 335, 903, 512, 924, 822, 365, 752, 792, 490, 31, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_580 = {
+	39,
+	-45,
+	128,
+	{ 938, 464, 778, 653, 908, 945, 768, 106, 292, 989, 38, 234, 266 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_581 = {
+	39,
+	-45,
+	0,
+	{ 47, 757, 643, 82, 296, 551, 856, 164, 957, 895, 421, 506, 159 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_582 = {
+	39,
+	-46,
+	128,
+	{ 643, 671, 585, 835, 888, 375, 703, 699, 410, 738, 146, 875, 471 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_583 = {
+	39,
+	-55,
+	128,
+	{ 328, 176, 762, 107, 357, 331, 380, 466, 169, 482, 126, 78, 651 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_584 = {
+	39,
+	-47,
+	0,
+	{ 303, 96, 801, 355, 154, 490, 703, 772, 467, 267, 910, 950, 797 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_585 = {
+	39,
+	-47,
+	128,
+	{ 252, 103, 959, 760, 628, 319, 618, 197, 452, 947, 631, 734, 456 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_586 = {
+	39,
+	-47,
+	0,
+	{ 482, 356, 733, 202, 296, 128, 602, 505, 602, 182, 97, 440, 129 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_587 = {
+	39,
+	-60,
+	0,
+	{ 861, 102, 162, 849, 962, 650, 628, 497, 360, 751, 88, 455, 683 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_588 = {
+	39,
+	-48,
+	128,
+	{ 266, 894, 182, 204, 993, 302, 353, 311, 786, 173, 557, 331, 202 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_589 = {
+	39,
+	-48,
+	0,
+	{ 77, 402, 322, 876, 678, 658, 422, 890, 829, 113, 846, 702, 111 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_590 = {
+	39,
+	-49,
+	128,
+	{ 796, 677, 11, 213, 383, 677, 98, 200, 281, 815, 640, 919, 305 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_591 = {
+	37,
+	-57,
+	0,
+	{ 316, 165, 560, 587, 676, 938, 939, 340, 446, 453, 759, 271, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_592 = {
+	39,
+	-50,
+	0,
+	{ 436, 449, 537, 914, 42, 62, 920, 301, 319, 241, 243, 848, 448 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_593 = {
+	39,
+	-50,
+	128,
+	{ 992, 871, 700, 890, 332, 839, 268, 856, 101, 572, 85, 629, 240 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_594 = {
+	39,
+	-51,
+	0,
+	{ 261, 702, 617, 79, 134, 743, 533, 683, 429, 440, 678, 826, 640 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_595 = {
+	39,
+	-61,
+	128,
+	{ 324, 678, 791, 791, 107, 188, 732, 356, 726, 843, 45, 327, 239 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_596 = {
+	39,
+	-52,
+	128,
+	{ 863, 912, 176, 900, 279, 749, 446, 106, 569, 264, 918, 418, 892 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_597 = {
+	39,
+	-52,
+	0,
+	{ 614, 701, 303, 101, 398, 569, 675, 96, 834, 261, 895, 906, 466 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_598 = {
+	39,
+	-52,
+	128,
+	{ 9, 176, 483, 185, 629, 594, 216, 54, 253, 319, 491, 475, 121 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_599 = {
+	39,
+	-63,
+	0,
+	{ 79, 64, 643, 982, 395, 245, 840, 968, 408, 168, 886, 5, 179 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_600 = {
+	39,
+	-40,
+	0,
+	{ 54, 725, 759, 53, 392, 440, 634, 907, 58, 609, 241, 491, 302 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_601 = {
+	39,
+	-41,
+	0,
+	{ 398, 432, 346, 874, 836, 565, 91, 773, 499, 26, 360, 174, 248 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_602 = {
+	39,
+	-40,
+	128,
+	{ 921, 838, 749, 72, 945, 665, 587, 223, 570, 734, 343, 391, 499 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_603 = {
+	39,
+	-40,
+	0,
+	{ 749, 730, 738, 398, 486, 363, 395, 686, 78, 93, 430, 156, 599 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_604 = {
+	38,
+	-39,
+	128,
+	{ 291, 418, 577, 626, 535, 657, 607, 390, 623, 601, 207, 483, 32 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_605 = {
+	39,
+	-44,
+	128,
+	{ 985, 802, 306, 805, 724, 908, 586, 408, 34, 521, 686, 129, 572 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_606 = {
+	39,
+	-40,
+	0,
+	{ 489, 987, 688, 369, 601, 695, 574, 543, 693, 785, 517, 852, 150 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_607 = {
+	39,
+	-40,
+	128,
+	{ 425, 922, 722, 220, 686, 643, 863, 449, 884, 50, 240, 613, 132 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_608 = {
+	39,
+	-41,
+	0,
+	{ 233, 702, 289, 588, 413, 925, 611, 475, 261, 324, 626, 152, 555 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_609 = {
+	39,
+	-46,
+	0,
+	{ 139, 117, 443, 418, 670, 736, 163, 156, 300, 570, 822, 631, 302 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_610 = {
+	39,
+	-41,
+	128,
+	{ 909, 717, 990, 558, 74, 278, 886, 231, 567, 67, 484, 295, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_611 = {
+	39,
+	-41,
+	0,
+	{ 395, 215, 683, 430, 53, 344, 817, 368, 296, 999, 700, 935, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_612 = {
+	39,
+	-42,
+	128,
+	{ 773, 458, 498, 737, 741, 197, 618, 756, 198, 483, 383, 451, 468 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_613 = {
+	39,
+	-48,
+	128,
+	{ 103, 126, 27, 407, 942, 958, 106, 455, 304, 789, 993, 25, 183 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_614 = {
+	39,
+	-42,
+	0,
+	{ 467, 593, 391, 763, 126, 81, 993, 540, 226, 148, 390, 497, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_615 = {
+	39,
+	-43,
+	128,
+	{ 111, 743, 749, 850, 124, 226, 415, 769, 444, 212, 652, 785, 773 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_616 = {
+	39,
+	-43,
+	0,
+	{ 869, 469, 175, 578, 396, 34, 729, 9, 852, 469, 362, 258, 256 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_617 = {
+	39,
+	-50,
+	0,
+	{ 967, 447, 867, 332, 204, 184, 876, 729, 580, 326, 653, 661, 107 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_618 = {
+	39,
+	-44,
+	128,
+	{ 394, 303, 842, 286, 766, 909, 293, 207, 226, 824, 92, 468, 532 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_619 = {
+	39,
+	-44,
+	0,
+	{ 239, 256, 662, 868, 500, 158, 998, 423, 446, 306, 486, 963, 334 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_620 = {
+	39,
+	-44,
+	128,
+	{ 621, 742, 368, 14, 96, 159, 42, 112, 840, 286, 531, 812, 103 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_621 = {
+	39,
+	-53,
+	128,
+	{ 38, 42, 153, 347, 557, 167, 223, 872, 874, 347, 853, 890, 560 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_622 = {
+	39,
+	-45,
+	0,
+	{ 619, 842, 854, 319, 671, 501, 581, 212, 767, 306, 219, 508, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_623 = {
+	39,
+	-45,
+	128,
+	{ 218, 209, 954, 890, 718, 394, 645, 757, 37, 2, 658, 183, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_624 = {
+	39,
+	-46,
+	0,
+	{ 774, 277, 488, 80, 876, 856, 404, 297, 523, 91, 252, 544, 336 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_625 = {
+	39,
+	-55,
+	0,
+	{ 978, 431, 802, 168, 762, 165, 270, 384, 306, 306, 229, 346, 239 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_626 = {
+	39,
+	-47,
+	128,
+	{ 125, 904, 628, 259, 575, 650, 468, 6, 477, 574, 360, 528, 566 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_627 = {
+	39,
+	-47,
+	0,
+	{ 654, 227, 884, 574, 846, 690, 497, 839, 578, 737, 253, 938, 323 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_628 = {
+	38,
+	-47,
+	128,
+	{ 209, 148, 758, 711, 496, 628, 507, 303, 75, 210, 892, 775, 91 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_629 = {
+	39,
+	-58,
+	128,
+	{ 961, 247, 651, 143, 742, 989, 380, 691, 365, 568, 430, 245, 704 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_630 = {
+	39,
+	-48,
+	0,
+	{ 822, 615, 253, 410, 900, 333, 569, 640, 861, 865, 437, 631, 143 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_631 = {
+	39,
+	-49,
+	128,
+	{ 695, 279, 603, 762, 223, 466, 242, 838, 754, 391, 982, 75, 794 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_632 = {
+	39,
+	-49,
+	0,
+	{ 666, 17, 598, 297, 496, 549, 281, 432, 167, 649, 70, 881, 217 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_633 = {
+	39,
+	-63,
+	128,
+	{ 5, 115, 439, 342, 796, 115, 793, 513, 604, 409, 602, 292, 486 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_634 = {
+	39,
+	-50,
+	128,
+	{ 391, 513, 518, 519, 719, 29, 972, 309, 226, 592, 810, 270, 321 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_635 = {
+	39,
+	-50,
+	0,
+	{ 566, 144, 756, 366, 174, 549, 300, 197, 79, 247, 551, 755, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_636 = {
+	39,
+	-51,
+	128,
+	{ 918, 826, 237, 988, 917, 839, 854, 675, 812, 0, 867, 606, 461 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_637 = {
+	39,
+	-62,
+	0,
+	{ 644, 835, 369, 499, 23, 890, 882, 648, 813, 690, 354, 989, 196 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_638 = {
+	39,
+	-52,
+	0,
+	{ 271, 723, 509, 883, 716, 393, 766, 61, 145, 376, 734, 669, 647 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[13];
+} const_igamma_temme_639 = {
+	39,
+	-52,
+	128,
+	{ 216, 522, 829, 3, 331, 47, 17, 271, 733, 489, 522, 250, 340 }
+};
+
+const decNumber *const const_igamma_temme[640] = {
+	(const decNumber *) &const_igamma_temme_0,
+	(const decNumber *) &const_igamma_temme_1,
+	(const decNumber *) &const_igamma_temme_2,
+	(const decNumber *) &const_igamma_temme_3,
+	(const decNumber *) &const_igamma_temme_4,
+	(const decNumber *) &const_igamma_temme_5,
+	(const decNumber *) &const_igamma_temme_6,
+	(const decNumber *) &const_igamma_temme_7,
+	(const decNumber *) &const_igamma_temme_8,
+	(const decNumber *) &const_igamma_temme_9,
+	(const decNumber *) &const_igamma_temme_10,
+	(const decNumber *) &const_igamma_temme_11,
+	(const decNumber *) &const_igamma_temme_12,
+	(const decNumber *) &const_igamma_temme_13,
+	(const decNumber *) &const_igamma_temme_14,
+	(const decNumber *) &const_igamma_temme_15,
+	(const decNumber *) &const_igamma_temme_16,
+	(const decNumber *) &const_igamma_temme_17,
+	(const decNumber *) &const_igamma_temme_18,
+	(const decNumber *) &const_igamma_temme_19,
+	(const decNumber *) &const_igamma_temme_20,
+	(const decNumber *) &const_igamma_temme_21,
+	(const decNumber *) &const_igamma_temme_22,
+	(const decNumber *) &const_igamma_temme_23,
+	(const decNumber *) &const_igamma_temme_24,
+	(const decNumber *) &const_igamma_temme_25,
+	(const decNumber *) &const_igamma_temme_26,
+	(const decNumber *) &const_igamma_temme_27,
+	(const decNumber *) &const_igamma_temme_28,
+	(const decNumber *) &const_igamma_temme_29,
+	(const decNumber *) &const_igamma_temme_30,
+	(const decNumber *) &const_igamma_temme_31,
+	(const decNumber *) &const_igamma_temme_32,
+	(const decNumber *) &const_igamma_temme_33,
+	(const decNumber *) &const_igamma_temme_34,
+	(const decNumber *) &const_igamma_temme_35,
+	(const decNumber *) &const_igamma_temme_36,
+	(const decNumber *) &const_igamma_temme_37,
+	(const decNumber *) &const_igamma_temme_38,
+	(const decNumber *) &const_igamma_temme_39,
+	(const decNumber *) &const_igamma_temme_40,
+	(const decNumber *) &const_igamma_temme_41,
+	(const decNumber *) &const_igamma_temme_42,
+	(const decNumber *) &const_igamma_temme_43,
+	(const decNumber *) &const_igamma_temme_44,
+	(const decNumber *) &const_igamma_temme_45,
+	(const decNumber *) &const_igamma_temme_46,
+	(const decNumber *) &const_igamma_temme_47,
+	(const decNumber *) &const_igamma_temme_48,
+	(const decNumber *) &const_igamma_temme_49,
+	(const decNumber *) &const_igamma_temme_50,
+	(const decNumber *) &const_igamma_temme_51,
+	(const decNumber *) &const_igamma_temme_52,
+	(const decNumber *) &const_igamma_temme_53,
+	(const decNumber *) &const_igamma_temme_54,
+	(const decNumber *) &const_igamma_temme_55,
+	(const decNumber *) &const_igamma_temme_56,
+	(const decNumber *) &const_igamma_temme_57,
+	(const decNumber *) &const_igamma_temme_58,
+	(const decNumber *) &const_igamma_temme_59,
+	(const decNumber *) &const_igamma_temme_60,
+	(const decNumber *) &const_igamma_temme_61,
+	(const decNumber *) &const_igamma_temme_62,
+	(const decNumber *) &const_igamma_temme_63,
+	(const decNumber *) &const_igamma_temme_64,
+	(const decNumber *) &const_igamma_temme_65,
+	(const decNumber *) &const_igamma_temme_66,
+	(const decNumber *) &const_igamma_temme_67,
+	(const decNumber *) &const_igamma_temme_68,
+	(const decNumber *) &const_igamma_temme_69,
+	(const decNumber *) &const_igamma_temme_70,
+	(const decNumber *) &const_igamma_temme_71,
+	(const decNumber *) &const_igamma_temme_72,
+	(const decNumber *) &const_igamma_temme_73,
+	(const decNumber *) &const_igamma_temme_74,
+	(const decNumber *) &const_igamma_temme_75,
+	(const decNumber *) &const_igamma_temme_76,
+	(const decNumber *) &const_igamma_temme_77,
+	(const decNumber *) &const_igamma_temme_78,
+	(const decNumber *) &const_igamma_temme_79,
+	(const decNumber *) &const_igamma_temme_80,
+	(const decNumber *) &const_igamma_temme_81,
+	(const decNumber *) &const_igamma_temme_82,
+	(const decNumber *) &const_igamma_temme_83,
+	(const decNumber *) &const_igamma_temme_84,
+	(const decNumber *) &const_igamma_temme_85,
+	(const decNumber *) &const_igamma_temme_86,
+	(const decNumber *) &const_igamma_temme_87,
+	(const decNumber *) &const_igamma_temme_88,
+	(const decNumber *) &const_igamma_temme_89,
+	(const decNumber *) &const_igamma_temme_90,
+	(const decNumber *) &const_igamma_temme_91,
+	(const decNumber *) &const_igamma_temme_92,
+	(const decNumber *) &const_igamma_temme_93,
+	(const decNumber *) &const_igamma_temme_94,
+	(const decNumber *) &const_igamma_temme_95,
+	(const decNumber *) &const_igamma_temme_96,
+	(const decNumber *) &const_igamma_temme_97,
+	(const decNumber *) &const_igamma_temme_98,
+	(const decNumber *) &const_igamma_temme_99,
+	(const decNumber *) &const_igamma_temme_100,
+	(const decNumber *) &const_igamma_temme_101,
+	(const decNumber *) &const_igamma_temme_102,
+	(const decNumber *) &const_igamma_temme_103,
+	(const decNumber *) &const_igamma_temme_104,
+	(const decNumber *) &const_igamma_temme_105,
+	(const decNumber *) &const_igamma_temme_106,
+	(const decNumber *) &const_igamma_temme_107,
+	(const decNumber *) &const_igamma_temme_108,
+	(const decNumber *) &const_igamma_temme_109,
+	(const decNumber *) &const_igamma_temme_110,
+	(const decNumber *) &const_igamma_temme_111,
+	(const decNumber *) &const_igamma_temme_112,
+	(const decNumber *) &const_igamma_temme_113,
+	(const decNumber *) &const_igamma_temme_114,
+	(const decNumber *) &const_igamma_temme_115,
+	(const decNumber *) &const_igamma_temme_116,
+	(const decNumber *) &const_igamma_temme_117,
+	(const decNumber *) &const_igamma_temme_118,
+	(const decNumber *) &const_igamma_temme_119,
+	(const decNumber *) &const_igamma_temme_120,
+	(const decNumber *) &const_igamma_temme_121,
+	(const decNumber *) &const_igamma_temme_122,
+	(const decNumber *) &const_igamma_temme_123,
+	(const decNumber *) &const_igamma_temme_124,
+	(const decNumber *) &const_igamma_temme_125,
+	(const decNumber *) &const_igamma_temme_126,
+	(const decNumber *) &const_igamma_temme_127,
+	(const decNumber *) &const_igamma_temme_128,
+	(const decNumber *) &const_igamma_temme_129,
+	(const decNumber *) &const_igamma_temme_130,
+	(const decNumber *) &const_igamma_temme_131,
+	(const decNumber *) &const_igamma_temme_132,
+	(const decNumber *) &const_igamma_temme_133,
+	(const decNumber *) &const_igamma_temme_134,
+	(const decNumber *) &const_igamma_temme_135,
+	(const decNumber *) &const_igamma_temme_136,
+	(const decNumber *) &const_igamma_temme_137,
+	(const decNumber *) &const_igamma_temme_138,
+	(const decNumber *) &const_igamma_temme_139,
+	(const decNumber *) &const_igamma_temme_140,
+	(const decNumber *) &const_igamma_temme_141,
+	(const decNumber *) &const_igamma_temme_142,
+	(const decNumber *) &const_igamma_temme_143,
+	(const decNumber *) &const_igamma_temme_144,
+	(const decNumber *) &const_igamma_temme_145,
+	(const decNumber *) &const_igamma_temme_146,
+	(const decNumber *) &const_igamma_temme_147,
+	(const decNumber *) &const_igamma_temme_148,
+	(const decNumber *) &const_igamma_temme_149,
+	(const decNumber *) &const_igamma_temme_150,
+	(const decNumber *) &const_igamma_temme_151,
+	(const decNumber *) &const_igamma_temme_152,
+	(const decNumber *) &const_igamma_temme_153,
+	(const decNumber *) &const_igamma_temme_154,
+	(const decNumber *) &const_igamma_temme_155,
+	(const decNumber *) &const_igamma_temme_156,
+	(const decNumber *) &const_igamma_temme_157,
+	(const decNumber *) &const_igamma_temme_158,
+	(const decNumber *) &const_igamma_temme_159,
+	(const decNumber *) &const_igamma_temme_160,
+	(const decNumber *) &const_igamma_temme_161,
+	(const decNumber *) &const_igamma_temme_162,
+	(const decNumber *) &const_igamma_temme_163,
+	(const decNumber *) &const_igamma_temme_164,
+	(const decNumber *) &const_igamma_temme_165,
+	(const decNumber *) &const_igamma_temme_166,
+	(const decNumber *) &const_igamma_temme_167,
+	(const decNumber *) &const_igamma_temme_168,
+	(const decNumber *) &const_igamma_temme_169,
+	(const decNumber *) &const_igamma_temme_170,
+	(const decNumber *) &const_igamma_temme_171,
+	(const decNumber *) &const_igamma_temme_172,
+	(const decNumber *) &const_igamma_temme_173,
+	(const decNumber *) &const_igamma_temme_174,
+	(const decNumber *) &const_igamma_temme_175,
+	(const decNumber *) &const_igamma_temme_176,
+	(const decNumber *) &const_igamma_temme_177,
+	(const decNumber *) &const_igamma_temme_178,
+	(const decNumber *) &const_igamma_temme_179,
+	(const decNumber *) &const_igamma_temme_180,
+	(const decNumber *) &const_igamma_temme_181,
+	(const decNumber *) &const_igamma_temme_182,
+	(const decNumber *) &const_igamma_temme_183,
+	(const decNumber *) &const_igamma_temme_184,
+	(const decNumber *) &const_igamma_temme_185,
+	(const decNumber *) &const_igamma_temme_186,
+	(const decNumber *) &const_igamma_temme_187,
+	(const decNumber *) &const_igamma_temme_188,
+	(const decNumber *) &const_igamma_temme_189,
+	(const decNumber *) &const_igamma_temme_190,
+	(const decNumber *) &const_igamma_temme_191,
+	(const decNumber *) &const_igamma_temme_192,
+	(const decNumber *) &const_igamma_temme_193,
+	(const decNumber *) &const_igamma_temme_194,
+	(const decNumber *) &const_igamma_temme_195,
+	(const decNumber *) &const_igamma_temme_196,
+	(const decNumber *) &const_igamma_temme_197,
+	(const decNumber *) &const_igamma_temme_198,
+	(const decNumber *) &const_igamma_temme_199,
+	(const decNumber *) &const_igamma_temme_200,
+	(const decNumber *) &const_igamma_temme_201,
+	(const decNumber *) &const_igamma_temme_202,
+	(const decNumber *) &const_igamma_temme_203,
+	(const decNumber *) &const_igamma_temme_204,
+	(const decNumber *) &const_igamma_temme_205,
+	(const decNumber *) &const_igamma_temme_206,
+	(const decNumber *) &const_igamma_temme_207,
+	(const decNumber *) &const_igamma_temme_208,
+	(const decNumber *) &const_igamma_temme_209,
+	(const decNumber *) &const_igamma_temme_210,
+	(const decNumber *) &const_igamma_temme_211,
+	(const decNumber *) &const_igamma_temme_212,
+	(const decNumber *) &const_igamma_temme_213,
+	(const decNumber *) &const_igamma_temme_214,
+	(const decNumber *) &const_igamma_temme_215,
+	(const decNumber *) &const_igamma_temme_216,
+	(const decNumber *) &const_igamma_temme_217,
+	(const decNumber *) &const_igamma_temme_218,
+	(const decNumber *) &const_igamma_temme_219,
+	(const decNumber *) &const_igamma_temme_220,
+	(const decNumber *) &const_igamma_temme_221,
+	(const decNumber *) &const_igamma_temme_222,
+	(const decNumber *) &const_igamma_temme_223,
+	(const decNumber *) &const_igamma_temme_224,
+	(const decNumber *) &const_igamma_temme_225,
+	(const decNumber *) &const_igamma_temme_226,
+	(const decNumber *) &const_igamma_temme_227,
+	(const decNumber *) &const_igamma_temme_228,
+	(const decNumber *) &const_igamma_temme_229,
+	(const decNumber *) &const_igamma_temme_230,
+	(const decNumber *) &const_igamma_temme_231,
+	(const decNumber *) &const_igamma_temme_232,
+	(const decNumber *) &const_igamma_temme_233,
+	(const decNumber *) &const_igamma_temme_234,
+	(const decNumber *) &const_igamma_temme_235,
+	(const decNumber *) &const_igamma_temme_236,
+	(const decNumber *) &const_igamma_temme_237,
+	(const decNumber *) &const_igamma_temme_238,
+	(const decNumber *) &const_igamma_temme_239,
+	(const decNumber *) &const_igamma_temme_240,
+	(const decNumber *) &const_igamma_temme_241,
+	(const decNumber *) &const_igamma_temme_242,
+	(const decNumber *) &const_igamma_temme_243,
+	(const decNumber *) &const_igamma_temme_244,
+	(const decNumber *) &const_igamma_temme_245,
+	(const decNumber *) &const_igamma_temme_246,
+	(const decNumber *) &const_igamma_temme_247,
+	(const decNumber *) &const_igamma_temme_248,
+	(const decNumber *) &const_igamma_temme_249,
+	(const decNumber *) &const_igamma_temme_250,
+	(const decNumber *) &const_igamma_temme_251,
+	(const decNumber *) &const_igamma_temme_252,
+	(const decNumber *) &const_igamma_temme_253,
+	(const decNumber *) &const_igamma_temme_254,
+	(const decNumber *) &const_igamma_temme_255,
+	(const decNumber *) &const_igamma_temme_256,
+	(const decNumber *) &const_igamma_temme_257,
+	(const decNumber *) &const_igamma_temme_258,
+	(const decNumber *) &const_igamma_temme_259,
+	(const decNumber *) &const_igamma_temme_260,
+	(const decNumber *) &const_igamma_temme_261,
+	(const decNumber *) &const_igamma_temme_262,
+	(const decNumber *) &const_igamma_temme_263,
+	(const decNumber *) &const_igamma_temme_264,
+	(const decNumber *) &const_igamma_temme_265,
+	(const decNumber *) &const_igamma_temme_266,
+	(const decNumber *) &const_igamma_temme_267,
+	(const decNumber *) &const_igamma_temme_268,
+	(const decNumber *) &const_igamma_temme_269,
+	(const decNumber *) &const_igamma_temme_270,
+	(const decNumber *) &const_igamma_temme_271,
+	(const decNumber *) &const_igamma_temme_272,
+	(const decNumber *) &const_igamma_temme_273,
+	(const decNumber *) &const_igamma_temme_274,
+	(const decNumber *) &const_igamma_temme_275,
+	(const decNumber *) &const_igamma_temme_276,
+	(const decNumber *) &const_igamma_temme_277,
+	(const decNumber *) &const_igamma_temme_278,
+	(const decNumber *) &const_igamma_temme_279,
+	(const decNumber *) &const_igamma_temme_280,
+	(const decNumber *) &const_igamma_temme_281,
+	(const decNumber *) &const_igamma_temme_282,
+	(const decNumber *) &const_igamma_temme_283,
+	(const decNumber *) &const_igamma_temme_284,
+	(const decNumber *) &const_igamma_temme_285,
+	(const decNumber *) &const_igamma_temme_286,
+	(const decNumber *) &const_igamma_temme_287,
+	(const decNumber *) &const_igamma_temme_288,
+	(const decNumber *) &const_igamma_temme_289,
+	(const decNumber *) &const_igamma_temme_290,
+	(const decNumber *) &const_igamma_temme_291,
+	(const decNumber *) &const_igamma_temme_292,
+	(const decNumber *) &const_igamma_temme_293,
+	(const decNumber *) &const_igamma_temme_294,
+	(const decNumber *) &const_igamma_temme_295,
+	(const decNumber *) &const_igamma_temme_296,
+	(const decNumber *) &const_igamma_temme_297,
+	(const decNumber *) &const_igamma_temme_298,
+	(const decNumber *) &const_igamma_temme_299,
+	(const decNumber *) &const_igamma_temme_300,
+	(const decNumber *) &const_igamma_temme_301,
+	(const decNumber *) &const_igamma_temme_302,
+	(const decNumber *) &const_igamma_temme_303,
+	(const decNumber *) &const_igamma_temme_304,
+	(const decNumber *) &const_igamma_temme_305,
+	(const decNumber *) &const_igamma_temme_306,
+	(const decNumber *) &const_igamma_temme_307,
+	(const decNumber *) &const_igamma_temme_308,
+	(const decNumber *) &const_igamma_temme_309,
+	(const decNumber *) &const_igamma_temme_310,
+	(const decNumber *) &const_igamma_temme_311,
+	(const decNumber *) &const_igamma_temme_312,
+	(const decNumber *) &const_igamma_temme_313,
+	(const decNumber *) &const_igamma_temme_314,
+	(const decNumber *) &const_igamma_temme_315,
+	(const decNumber *) &const_igamma_temme_316,
+	(const decNumber *) &const_igamma_temme_317,
+	(const decNumber *) &const_igamma_temme_318,
+	(const decNumber *) &const_igamma_temme_319,
+	(const decNumber *) &const_igamma_temme_320,
+	(const decNumber *) &const_igamma_temme_321,
+	(const decNumber *) &const_igamma_temme_322,
+	(const decNumber *) &const_igamma_temme_323,
+	(const decNumber *) &const_igamma_temme_324,
+	(const decNumber *) &const_igamma_temme_325,
+	(const decNumber *) &const_igamma_temme_326,
+	(const decNumber *) &const_igamma_temme_327,
+	(const decNumber *) &const_igamma_temme_328,
+	(const decNumber *) &const_igamma_temme_329,
+	(const decNumber *) &const_igamma_temme_330,
+	(const decNumber *) &const_igamma_temme_331,
+	(const decNumber *) &const_igamma_temme_332,
+	(const decNumber *) &const_igamma_temme_333,
+	(const decNumber *) &const_igamma_temme_334,
+	(const decNumber *) &const_igamma_temme_335,
+	(const decNumber *) &const_igamma_temme_336,
+	(const decNumber *) &const_igamma_temme_337,
+	(const decNumber *) &const_igamma_temme_338,
+	(const decNumber *) &const_igamma_temme_339,
+	(const decNumber *) &const_igamma_temme_340,
+	(const decNumber *) &const_igamma_temme_341,
+	(const decNumber *) &const_igamma_temme_342,
+	(const decNumber *) &const_igamma_temme_343,
+	(const decNumber *) &const_igamma_temme_344,
+	(const decNumber *) &const_igamma_temme_345,
+	(const decNumber *) &const_igamma_temme_346,
+	(const decNumber *) &const_igamma_temme_347,
+	(const decNumber *) &const_igamma_temme_348,
+	(const decNumber *) &const_igamma_temme_349,
+	(const decNumber *) &const_igamma_temme_350,
+	(const decNumber *) &const_igamma_temme_351,
+	(const decNumber *) &const_igamma_temme_352,
+	(const decNumber *) &const_igamma_temme_353,
+	(const decNumber *) &const_igamma_temme_354,
+	(const decNumber *) &const_igamma_temme_355,
+	(const decNumber *) &const_igamma_temme_356,
+	(const decNumber *) &const_igamma_temme_357,
+	(const decNumber *) &const_igamma_temme_358,
+	(const decNumber *) &const_igamma_temme_359,
+	(const decNumber *) &const_igamma_temme_360,
+	(const decNumber *) &const_igamma_temme_361,
+	(const decNumber *) &const_igamma_temme_362,
+	(const decNumber *) &const_igamma_temme_363,
+	(const decNumber *) &const_igamma_temme_364,
+	(const decNumber *) &const_igamma_temme_365,
+	(const decNumber *) &const_igamma_temme_366,
+	(const decNumber *) &const_igamma_temme_367,
+	(const decNumber *) &const_igamma_temme_368,
+	(const decNumber *) &const_igamma_temme_369,
+	(const decNumber *) &const_igamma_temme_370,
+	(const decNumber *) &const_igamma_temme_371,
+	(const decNumber *) &const_igamma_temme_372,
+	(const decNumber *) &const_igamma_temme_373,
+	(const decNumber *) &const_igamma_temme_374,
+	(const decNumber *) &const_igamma_temme_375,
+	(const decNumber *) &const_igamma_temme_376,
+	(const decNumber *) &const_igamma_temme_377,
+	(const decNumber *) &const_igamma_temme_378,
+	(const decNumber *) &const_igamma_temme_379,
+	(const decNumber *) &const_igamma_temme_380,
+	(const decNumber *) &const_igamma_temme_381,
+	(const decNumber *) &const_igamma_temme_382,
+	(const decNumber *) &const_igamma_temme_383,
+	(const decNumber *) &const_igamma_temme_384,
+	(const decNumber *) &const_igamma_temme_385,
+	(const decNumber *) &const_igamma_temme_386,
+	(const decNumber *) &const_igamma_temme_387,
+	(const decNumber *) &const_igamma_temme_388,
+	(const decNumber *) &const_igamma_temme_389,
+	(const decNumber *) &const_igamma_temme_390,
+	(const decNumber *) &const_igamma_temme_391,
+	(const decNumber *) &const_igamma_temme_392,
+	(const decNumber *) &const_igamma_temme_393,
+	(const decNumber *) &const_igamma_temme_394,
+	(const decNumber *) &const_igamma_temme_395,
+	(const decNumber *) &const_igamma_temme_396,
+	(const decNumber *) &const_igamma_temme_397,
+	(const decNumber *) &const_igamma_temme_398,
+	(const decNumber *) &const_igamma_temme_399,
+	(const decNumber *) &const_igamma_temme_400,
+	(const decNumber *) &const_igamma_temme_401,
+	(const decNumber *) &const_igamma_temme_402,
+	(const decNumber *) &const_igamma_temme_403,
+	(const decNumber *) &const_igamma_temme_404,
+	(const decNumber *) &const_igamma_temme_405,
+	(const decNumber *) &const_igamma_temme_406,
+	(const decNumber *) &const_igamma_temme_407,
+	(const decNumber *) &const_igamma_temme_408,
+	(const decNumber *) &const_igamma_temme_409,
+	(const decNumber *) &const_igamma_temme_410,
+	(const decNumber *) &const_igamma_temme_411,
+	(const decNumber *) &const_igamma_temme_412,
+	(const decNumber *) &const_igamma_temme_413,
+	(const decNumber *) &const_igamma_temme_414,
+	(const decNumber *) &const_igamma_temme_415,
+	(const decNumber *) &const_igamma_temme_416,
+	(const decNumber *) &const_igamma_temme_417,
+	(const decNumber *) &const_igamma_temme_418,
+	(const decNumber *) &const_igamma_temme_419,
+	(const decNumber *) &const_igamma_temme_420,
+	(const decNumber *) &const_igamma_temme_421,
+	(const decNumber *) &const_igamma_temme_422,
+	(const decNumber *) &const_igamma_temme_423,
+	(const decNumber *) &const_igamma_temme_424,
+	(const decNumber *) &const_igamma_temme_425,
+	(const decNumber *) &const_igamma_temme_426,
+	(const decNumber *) &const_igamma_temme_427,
+	(const decNumber *) &const_igamma_temme_428,
+	(const decNumber *) &const_igamma_temme_429,
+	(const decNumber *) &const_igamma_temme_430,
+	(const decNumber *) &const_igamma_temme_431,
+	(const decNumber *) &const_igamma_temme_432,
+	(const decNumber *) &const_igamma_temme_433,
+	(const decNumber *) &const_igamma_temme_434,
+	(const decNumber *) &const_igamma_temme_435,
+	(const decNumber *) &const_igamma_temme_436,
+	(const decNumber *) &const_igamma_temme_437,
+	(const decNumber *) &const_igamma_temme_438,
+	(const decNumber *) &const_igamma_temme_439,
+	(const decNumber *) &const_igamma_temme_440,
+	(const decNumber *) &const_igamma_temme_441,
+	(const decNumber *) &const_igamma_temme_442,
+	(const decNumber *) &const_igamma_temme_443,
+	(const decNumber *) &const_igamma_temme_444,
+	(const decNumber *) &const_igamma_temme_445,
+	(const decNumber *) &const_igamma_temme_446,
+	(const decNumber *) &const_igamma_temme_447,
+	(const decNumber *) &const_igamma_temme_448,
+	(const decNumber *) &const_igamma_temme_449,
+	(const decNumber *) &const_igamma_temme_450,
+	(const decNumber *) &const_igamma_temme_451,
+	(const decNumber *) &const_igamma_temme_452,
+	(const decNumber *) &const_igamma_temme_453,
+	(const decNumber *) &const_igamma_temme_454,
+	(const decNumber *) &const_igamma_temme_455,
+	(const decNumber *) &const_igamma_temme_456,
+	(const decNumber *) &const_igamma_temme_457,
+	(const decNumber *) &const_igamma_temme_458,
+	(const decNumber *) &const_igamma_temme_459,
+	(const decNumber *) &const_igamma_temme_460,
+	(const decNumber *) &const_igamma_temme_461,
+	(const decNumber *) &const_igamma_temme_462,
+	(const decNumber *) &const_igamma_temme_463,
+	(const decNumber *) &const_igamma_temme_464,
+	(const decNumber *) &const_igamma_temme_465,
+	(const decNumber *) &const_igamma_temme_466,
+	(const decNumber *) &const_igamma_temme_467,
+	(const decNumber *) &const_igamma_temme_468,
+	(const decNumber *) &const_igamma_temme_469,
+	(const decNumber *) &const_igamma_temme_470,
+	(const decNumber *) &const_igamma_temme_471,
+	(const decNumber *) &const_igamma_temme_472,
+	(const decNumber *) &const_igamma_temme_473,
+	(const decNumber *) &const_igamma_temme_474,
+	(const decNumber *) &const_igamma_temme_475,
+	(const decNumber *) &const_igamma_temme_476,
+	(const decNumber *) &const_igamma_temme_477,
+	(const decNumber *) &const_igamma_temme_478,
+	(const decNumber *) &const_igamma_temme_479,
+	(const decNumber *) &const_igamma_temme_480,
+	(const decNumber *) &const_igamma_temme_481,
+	(const decNumber *) &const_igamma_temme_482,
+	(const decNumber *) &const_igamma_temme_483,
+	(const decNumber *) &const_igamma_temme_484,
+	(const decNumber *) &const_igamma_temme_485,
+	(const decNumber *) &const_igamma_temme_486,
+	(const decNumber *) &const_igamma_temme_487,
+	(const decNumber *) &const_igamma_temme_488,
+	(const decNumber *) &const_igamma_temme_489,
+	(const decNumber *) &const_igamma_temme_490,
+	(const decNumber *) &const_igamma_temme_491,
+	(const decNumber *) &const_igamma_temme_492,
+	(const decNumber *) &const_igamma_temme_493,
+	(const decNumber *) &const_igamma_temme_494,
+	(const decNumber *) &const_igamma_temme_495,
+	(const decNumber *) &const_igamma_temme_496,
+	(const decNumber *) &const_igamma_temme_497,
+	(const decNumber *) &const_igamma_temme_498,
+	(const decNumber *) &const_igamma_temme_499,
+	(const decNumber *) &const_igamma_temme_500,
+	(const decNumber *) &const_igamma_temme_501,
+	(const decNumber *) &const_igamma_temme_502,
+	(const decNumber *) &const_igamma_temme_503,
+	(const decNumber *) &const_igamma_temme_504,
+	(const decNumber *) &const_igamma_temme_505,
+	(const decNumber *) &const_igamma_temme_506,
+	(const decNumber *) &const_igamma_temme_507,
+	(const decNumber *) &const_igamma_temme_508,
+	(const decNumber *) &const_igamma_temme_509,
+	(const decNumber *) &const_igamma_temme_510,
+	(const decNumber *) &const_igamma_temme_511,
+	(const decNumber *) &const_igamma_temme_512,
+	(const decNumber *) &const_igamma_temme_513,
+	(const decNumber *) &const_igamma_temme_514,
+	(const decNumber *) &const_igamma_temme_515,
+	(const decNumber *) &const_igamma_temme_516,
+	(const decNumber *) &const_igamma_temme_517,
+	(const decNumber *) &const_igamma_temme_518,
+	(const decNumber *) &const_igamma_temme_519,
+	(const decNumber *) &const_igamma_temme_520,
+	(const decNumber *) &const_igamma_temme_521,
+	(const decNumber *) &const_igamma_temme_522,
+	(const decNumber *) &const_igamma_temme_523,
+	(const decNumber *) &const_igamma_temme_524,
+	(const decNumber *) &const_igamma_temme_525,
+	(const decNumber *) &const_igamma_temme_526,
+	(const decNumber *) &const_igamma_temme_527,
+	(const decNumber *) &const_igamma_temme_528,
+	(const decNumber *) &const_igamma_temme_529,
+	(const decNumber *) &const_igamma_temme_530,
+	(const decNumber *) &const_igamma_temme_531,
+	(const decNumber *) &const_igamma_temme_532,
+	(const decNumber *) &const_igamma_temme_533,
+	(const decNumber *) &const_igamma_temme_534,
+	(const decNumber *) &const_igamma_temme_535,
+	(const decNumber *) &const_igamma_temme_536,
+	(const decNumber *) &const_igamma_temme_537,
+	(const decNumber *) &const_igamma_temme_538,
+	(const decNumber *) &const_igamma_temme_539,
+	(const decNumber *) &const_igamma_temme_540,
+	(const decNumber *) &const_igamma_temme_541,
+	(const decNumber *) &const_igamma_temme_542,
+	(const decNumber *) &const_igamma_temme_543,
+	(const decNumber *) &const_igamma_temme_544,
+	(const decNumber *) &const_igamma_temme_545,
+	(const decNumber *) &const_igamma_temme_546,
+	(const decNumber *) &const_igamma_temme_547,
+	(const decNumber *) &const_igamma_temme_548,
+	(const decNumber *) &const_igamma_temme_549,
+	(const decNumber *) &const_igamma_temme_550,
+	(const decNumber *) &const_igamma_temme_551,
+	(const decNumber *) &const_igamma_temme_552,
+	(const decNumber *) &const_igamma_temme_553,
+	(const decNumber *) &const_igamma_temme_554,
+	(const decNumber *) &const_igamma_temme_555,
+	(const decNumber *) &const_igamma_temme_556,
+	(const decNumber *) &const_igamma_temme_557,
+	(const decNumber *) &const_igamma_temme_558,
+	(const decNumber *) &const_igamma_temme_559,
+	(const decNumber *) &const_igamma_temme_560,
+	(const decNumber *) &const_igamma_temme_561,
+	(const decNumber *) &const_igamma_temme_562,
+	(const decNumber *) &const_igamma_temme_563,
+	(const decNumber *) &const_igamma_temme_564,
+	(const decNumber *) &const_igamma_temme_565,
+	(const decNumber *) &const_igamma_temme_566,
+	(const decNumber *) &const_igamma_temme_567,
+	(const decNumber *) &const_igamma_temme_568,
+	(const decNumber *) &const_igamma_temme_569,
+	(const decNumber *) &const_igamma_temme_570,
+	(const decNumber *) &const_igamma_temme_571,
+	(const decNumber *) &const_igamma_temme_572,
+	(const decNumber *) &const_igamma_temme_573,
+	(const decNumber *) &const_igamma_temme_574,
+	(const decNumber *) &const_igamma_temme_575,
+	(const decNumber *) &const_igamma_temme_576,
+	(const decNumber *) &const_igamma_temme_577,
+	(const decNumber *) &const_igamma_temme_578,
+	(const decNumber *) &const_igamma_temme_579,
+	(const decNumber *) &const_igamma_temme_580,
+	(const decNumber *) &const_igamma_temme_581,
+	(const decNumber *) &const_igamma_temme_582,
+	(const decNumber *) &const_igamma_temme_583,
+	(const decNumber *) &const_igamma_temme_584,
+	(const decNumber *) &const_igamma_temme_585,
+	(const decNumber *) &const_igamma_temme_586,
+	(const decNumber *) &const_igamma_temme_587,
+	(const decNumber *) &const_igamma_temme_588,
+	(const decNumber *) &const_igamma_temme_589,
+	(const decNumber *) &const_igamma_temme_590,
+	(const decNumber *) &const_igamma_temme_591,
+	(const decNumber *) &const_igamma_temme_592,
+	(const decNumber *) &const_igamma_temme_593,
+	(const decNumber *) &const_igamma_temme_594,
+	(const decNumber *) &const_igamma_temme_595,
+	(const decNumber *) &const_igamma_temme_596,
+	(const decNumber *) &const_igamma_temme_597,
+	(const decNumber *) &const_igamma_temme_598,
+	(const decNumber *) &const_igamma_temme_599,
+	(const decNumber *) &const_igamma_temme_600,
+	(const decNumber *) &const_igamma_temme_601,
+	(const decNumber *) &const_igamma_temme_602,
+	(const decNumber *) &const_igamma_temme_603,
+	(const decNumber *) &const_igamma_temme_604,
+	(const decNumber *) &const_igamma_temme_605,
+	(const decNumber *) &const_igamma_temme_606,
+	(const decNumber *) &const_igamma_temme_607,
+	(const decNumber *) &const_igamma_temme_608,
+	(const decNumber *) &const_igamma_temme_609,
+	(const decNumber *) &const_igamma_temme_610,
+	(const decNumber *) &const_igamma_temme_611,
+	(const decNumber *) &const_igamma_temme_612,
+	(const decNumber *) &const_igamma_temme_613,
+	(const decNumber *) &const_igamma_temme_614,
+	(const decNumber *) &const_igamma_temme_615,
+	(const decNumber *) &const_igamma_temme_616,
+	(const decNumber *) &const_igamma_temme_617,
+	(const decNumber *) &const_igamma_temme_618,
+	(const decNumber *) &const_igamma_temme_619,
+	(const decNumber *) &const_igamma_temme_620,
+	(const decNumber *) &const_igamma_temme_621,
+	(const decNumber *) &const_igamma_temme_622,
+	(const decNumber *) &const_igamma_temme_623,
+	(const decNumber *) &const_igamma_temme_624,
+	(const decNumber *) &const_igamma_temme_625,
+	(const decNumber *) &const_igamma_temme_626,
+	(const decNumber *) &const_igamma_temme_627,
+	(const decNumber *) &const_igamma_temme_628,
+	(const decNumber *) &const_igamma_temme_629,
+	(const decNumber *) &const_igamma_temme_630,
+	(const decNumber *) &const_igamma_temme_631,
+	(const decNumber *) &const_igamma_temme_632,
+	(const decNumber *) &const_igamma_temme_633,
+	(const decNumber *) &const_igamma_temme_634,
+	(const decNumber *) &const_igamma_temme_635,
+	(const decNumber *) &const_igamma_temme_636,
+	(const decNumber *) &const_igamma_temme_637,
+	(const decNumber *) &const_igamma_temme_638,
+	(const decNumber *) &const_igamma_temme_639,
+};
+
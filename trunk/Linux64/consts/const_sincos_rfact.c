@@ -0,0 +1,298 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_rfact_0 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_rfact_1 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_rfact_2 = {
+	1,
+	-1,
+	128,
+	{ 5 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_3 = {
+	51,
+	-51,
+	128,
+	{ 667, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 166 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_4 = {
+	51,
+	-52,
+	0,
+	{ 667, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 666, 416 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_5 = {
+	51,
+	-53,
+	0,
+	{ 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 833 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_6 = {
+	51,
+	-53,
+	128,
+	{ 889, 888, 888, 888, 888, 888, 888, 888, 888, 888, 888, 888, 888, 888, 888, 888, 138 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_7 = {
+	51,
+	-54,
+	128,
+	{ 698, 412, 698, 412, 698, 412, 698, 412, 698, 412, 698, 412, 698, 412, 698, 412, 198 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_8 = {
+	51,
+	-55,
+	0,
+	{ 873, 15, 873, 15, 873, 15, 873, 15, 873, 15, 873, 15, 873, 15, 873, 15, 248 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_9 = {
+	51,
+	-56,
+	0,
+	{ 859, 239, 192, 573, 525, 906, 858, 239, 192, 573, 525, 906, 858, 239, 192, 573, 275 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_10 = {
+	51,
+	-57,
+	128,
+	{ 859, 239, 192, 573, 525, 906, 858, 239, 192, 573, 525, 906, 858, 239, 192, 573, 275 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_11 = {
+	51,
+	-58,
+	128,
+	{ 417, 854, 83, 521, 750, 187, 417, 854, 83, 521, 750, 187, 417, 854, 83, 521, 250 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_12 = {
+	51,
+	-59,
+	0,
+	{ 348, 545, 236, 434, 125, 323, 14, 212, 903, 100, 792, 989, 680, 878, 569, 767, 208 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_13 = {
+	51,
+	-60,
+	0,
+	{ 883, 34, 105, 257, 327, 479, 549, 701, 771, 923, 993, 145, 216, 368, 438, 590, 160 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_14 = {
+	51,
+	-61,
+	128,
+	{ 345, 596, 503, 326, 662, 56, 821, 786, 979, 516, 138, 247, 297, 977, 455, 707, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_15 = {
+	51,
+	-63,
+	128,
+	{ 632, 975, 23, 510, 415, 44, 807, 578, 198, 113, 590, 647, 981, 181, 373, 716, 764 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_16 = {
+	50,
+	-63,
+	0,
+	{ 477, 498, 376, 969, 275, 440, 175, 911, 74, 382, 974, 852, 873, 323, 773, 794, 47 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_17 = {
+	51,
+	-65,
+	0,
+	{ 453, 520, 273, 349, 623, 1, 32, 301, 558, 894, 319, 76, 552, 434, 725, 145, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_18 = {
+	51,
+	-66,
+	128,
+	{ 696, 844, 40, 194, 235, 334, 573, 500, 643, 163, 622, 264, 862, 685, 69, 192, 156 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_19 = {
+	51,
+	-68,
+	128,
+	{ 611, 182, 899, 73, 922, 74, 228, 687, 123, 598, 695, 971, 432, 662, 524, 63, 822 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_rfact_20 = {
+	51,
+	-69,
+	0,
+	{ 306, 591, 949, 36, 461, 37, 614, 843, 61, 799, 847, 485, 216, 331, 762, 31, 411 }
+};
+
+const decNumber *const const_sincos_rfact[21] = {
+	(const decNumber *) &const_sincos_rfact_0,
+	(const decNumber *) &const_sincos_rfact_1,
+	(const decNumber *) &const_sincos_rfact_2,
+	(const decNumber *) &const_sincos_rfact_3,
+	(const decNumber *) &const_sincos_rfact_4,
+	(const decNumber *) &const_sincos_rfact_5,
+	(const decNumber *) &const_sincos_rfact_6,
+	(const decNumber *) &const_sincos_rfact_7,
+	(const decNumber *) &const_sincos_rfact_8,
+	(const decNumber *) &const_sincos_rfact_9,
+	(const decNumber *) &const_sincos_rfact_10,
+	(const decNumber *) &const_sincos_rfact_11,
+	(const decNumber *) &const_sincos_rfact_12,
+	(const decNumber *) &const_sincos_rfact_13,
+	(const decNumber *) &const_sincos_rfact_14,
+	(const decNumber *) &const_sincos_rfact_15,
+	(const decNumber *) &const_sincos_rfact_16,
+	(const decNumber *) &const_sincos_rfact_17,
+	(const decNumber *) &const_sincos_rfact_18,
+	(const decNumber *) &const_sincos_rfact_19,
+	(const decNumber *) &const_sincos_rfact_20,
+};
+
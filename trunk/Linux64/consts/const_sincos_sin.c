@@ -0,0 +1,454 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_sin_0 = {
+	1,
+	0,
+	0,
+	{ 0 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_1 = {
+	51,
+	-52,
+	0,
+	{ 529, 257, 630, 453, 147, 583, 826, 426, 769, 549, 549, 142, 180, 274, 743, 676, 490 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_2 = {
+	51,
+	-52,
+	0,
+	{ 6, 675, 731, 366, 611, 458, 418, 886, 638, 955, 941, 19, 606, 295, 403, 171, 980 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_3 = {
+	51,
+	-51,
+	0,
+	{ 392, 529, 316, 215, 706, 819, 717, 646, 129, 850, 658, 751, 361, 455, 474, 730, 146 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_4 = {
+	51,
+	-51,
+	0,
+	{ 955, 751, 617, 691, 927, 240, 22, 477, 868, 284, 848, 267, 128, 16, 322, 90, 195 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_5 = {
+	51,
+	-51,
+	0,
+	{ 832, 283, 783, 990, 320, 118, 471, 77, 162, 274, 948, 889, 263, 903, 179, 980, 242 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_6 = {
+	51,
+	-51,
+	0,
+	{ 151, 324, 278, 476, 691, 274, 395, 817, 375, 192, 636, 367, 462, 254, 677, 284, 290 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_7 = {
+	51,
+	-51,
+	0,
+	{ 222, 671, 779, 766, 477, 570, 147, 619, 212, 253, 689, 50, 220, 392, 853, 889, 336 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_8 = {
+	51,
+	-51,
+	0,
+	{ 627, 485, 562, 344, 761, 866, 398, 30, 984, 459, 728, 771, 89, 365, 432, 683, 382 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_9 = {
+	51,
+	-51,
+	0,
+	{ 459, 342, 629, 578, 304, 534, 798, 888, 856, 966, 320, 94, 282, 430, 93, 555, 427 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_10 = {
+	51,
+	-51,
+	0,
+	{ 481, 932, 318, 460, 657, 377, 254, 905, 625, 387, 556, 648, 997, 825, 736, 396, 471 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_11 = {
+	51,
+	-51,
+	0,
+	{ 218, 416, 120, 49, 608, 772, 815, 968, 838, 693, 593, 726, 221, 193, 744, 102, 514 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_12 = {
+	51,
+	-51,
+	0,
+	{ 804, 754, 190, 937, 374, 874, 532, 948, 813, 830, 742, 224, 602, 19, 233, 570, 555 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_13 = {
+	51,
+	-51,
+	0,
+	{ 505, 437, 338, 926, 511, 889, 969, 829, 528, 36, 467, 343, 433, 492, 304, 699, 595 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_14 = {
+	51,
+	-51,
+	0,
+	{ 722, 841, 94, 687, 675, 370, 493, 225, 613, 171, 215, 498, 645, 163, 284, 393, 634 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_15 = {
+	51,
+	-51,
+	0,
+	{ 794, 199, 632, 750, 228, 803, 421, 427, 850, 376, 625, 400, 18, 847, 954, 558, 671 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_16 = {
+	51,
+	-51,
+	0,
+	{ 474, 688, 937, 835, 284, 39, 849, 104, 362, 844, 400, 524, 547, 186, 781, 106, 707 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_17 = {
+	50,
+	-50,
+	0,
+	{ 909, 930, 530, 895, 972, 272, 516, 749, 689, 561, 117, 909, 495, 535, 112, 95, 74 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_18 = {
+	50,
+	-50,
+	0,
+	{ 81, 290, 129, 104, 97, 980, 846, 975, 660, 90, 81, 696, 273, 336, 45, 301, 77 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_19 = {
+	51,
+	-51,
+	0,
+	{ 461, 170, 427, 569, 879, 923, 141, 963, 512, 676, 806, 909, 644, 480, 531, 207, 803 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_20 = {
+	50,
+	-50,
+	0,
+	{ 725, 198, 81, 856, 673, 575, 790, 761, 837, 878, 707, 523, 254, 230, 961, 146, 83 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_21 = {
+	51,
+	-51,
+	0,
+	{ 734, 433, 799, 490, 42, 137, 770, 284, 984, 269, 902, 69, 272, 0, 610, 728, 857 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_22 = {
+	51,
+	-51,
+	0,
+	{ 728, 674, 620, 442, 508, 349, 388, 660, 863, 756, 712, 29, 355, 348, 264, 921, 881 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_23 = {
+	51,
+	-51,
+	0,
+	{ 608, 50, 25, 132, 710, 48, 537, 230, 297, 200, 586, 331, 443, 123, 293, 989, 903 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_24 = {
+	51,
+	-51,
+	0,
+	{ 642, 863, 625, 416, 822, 286, 788, 396, 189, 183, 128, 756, 286, 511, 532, 879, 923 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_25 = {
+	51,
+	-51,
+	0,
+	{ 183, 825, 795, 589, 185, 357, 502, 599, 402, 509, 412, 778, 20, 183, 65, 544, 941 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_26 = {
+	51,
+	-51,
+	0,
+	{ 37, 630, 205, 849, 482, 969, 269, 980, 886, 797, 935, 864, 208, 732, 335, 940, 956 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_27 = {
+	51,
+	-51,
+	0,
+	{ 74, 248, 962, 865, 456, 251, 100, 286, 207, 984, 603, 992, 543, 194, 253, 31, 970 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_28 = {
+	51,
+	-51,
+	0,
+	{ 336, 893, 730, 933, 973, 36, 239, 134, 236, 182, 126, 449, 230, 403, 280, 785, 980 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_29 = {
+	51,
+	-51,
+	0,
+	{ 907, 336, 533, 689, 983, 63, 243, 16, 738, 673, 451, 973, 780, 964, 509, 176, 989 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_30 = {
+	51,
+	-51,
+	0,
+	{ 857, 729, 868, 474, 575, 921, 479, 109, 953, 836, 244, 886, 196, 672, 726, 184, 995 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[17];
+} const_sincos_sin_31 = {
+	51,
+	-51,
+	0,
+	{ 612, 704, 614, 203, 443, 694, 100, 759, 604, 771, 714, 392, 172, 205, 456, 795, 998 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_sin_32 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+const decNumber *const const_sincos_sin[33] = {
+	(const decNumber *) &const_sincos_sin_0,
+	(const decNumber *) &const_sincos_sin_1,
+	(const decNumber *) &const_sincos_sin_2,
+	(const decNumber *) &const_sincos_sin_3,
+	(const decNumber *) &const_sincos_sin_4,
+	(const decNumber *) &const_sincos_sin_5,
+	(const decNumber *) &const_sincos_sin_6,
+	(const decNumber *) &const_sincos_sin_7,
+	(const decNumber *) &const_sincos_sin_8,
+	(const decNumber *) &const_sincos_sin_9,
+	(const decNumber *) &const_sincos_sin_10,
+	(const decNumber *) &const_sincos_sin_11,
+	(const decNumber *) &const_sincos_sin_12,
+	(const decNumber *) &const_sincos_sin_13,
+	(const decNumber *) &const_sincos_sin_14,
+	(const decNumber *) &const_sincos_sin_15,
+	(const decNumber *) &const_sincos_sin_16,
+	(const decNumber *) &const_sincos_sin_17,
+	(const decNumber *) &const_sincos_sin_18,
+	(const decNumber *) &const_sincos_sin_19,
+	(const decNumber *) &const_sincos_sin_20,
+	(const decNumber *) &const_sincos_sin_21,
+	(const decNumber *) &const_sincos_sin_22,
+	(const decNumber *) &const_sincos_sin_23,
+	(const decNumber *) &const_sincos_sin_24,
+	(const decNumber *) &const_sincos_sin_25,
+	(const decNumber *) &const_sincos_sin_26,
+	(const decNumber *) &const_sincos_sin_27,
+	(const decNumber *) &const_sincos_sin_28,
+	(const decNumber *) &const_sincos_sin_29,
+	(const decNumber *) &const_sincos_sin_30,
+	(const decNumber *) &const_sincos_sin_31,
+	(const decNumber *) &const_sincos_sin_32,
+};
+
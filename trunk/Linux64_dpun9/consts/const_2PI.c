@@ -0,0 +1,34 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[51];
+} const_2PI = {
+	451,
+	-450,
+	0,
+	{ 210237096, 865223586, 372234763, 183906184, 540731519, 218866114, 903883023, 42768293, 97640933, 22661061, 785180720, 430728735, 658508183, 41841925, 176349763, 13212631, 547449174, 520498282, 426787214, 908653296, 920697220, 297133846, 403818291, 566330542, 296467573, 892256951, 951331866, 928857621, 909860763, 289245897, 42211119, 205403877, 234900568, 816256962, 463450718, 219101164, 294187689, 26564613, 964296173, 684234135, 256069650, 572417997, 615632812, 949889184, 750211641, 394338798, 559005768, 925286766, 179586476, 283185307, 6 }
+};
+
@@ -0,0 +1,311 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_0 = {
+	16,
+	4,
+	0,
+	{ 217170944, 5109094 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_1 = {
+	17,
+	4,
+	0,
+	{ 78017024, 18624481 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_2 = {
+	18,
+	3,
+	0,
+	{ 863216384, 298631902 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[3];
+} const_gamma_den_3 = {
+	19,
+	2,
+	0,
+	{ 18114688, 840933159, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[3];
+} const_gamma_den_4 = {
+	21,
+	0,
+	0,
+	{ 697076096, 664979520, 181 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[3];
+} const_gamma_den_5 = {
+	20,
+	0,
+	0,
+	{ 544802976, 637381699, 83 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[3];
+} const_gamma_den_6 = {
+	19,
+	1,
+	0,
+	{ 733544776, 893958339, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_7 = {
+	17,
+	2,
+	0,
+	{ 101695768, 77446543 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[3];
+} const_gamma_den_8 = {
+	19,
+	0,
+	0,
+	{ 246583456, 634980697, 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_9 = {
+	18,
+	0,
+	0,
+	{ 275035346, 276019109 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_10 = {
+	17,
+	0,
+	0,
+	{ 86859745, 37600535 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_11 = {
+	16,
+	0,
+	0,
+	{ 851430525, 4154823 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_12 = {
+	15,
+	0,
+	0,
+	{ 999802531, 373100 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_13 = {
+	14,
+	0,
+	0,
+	{ 611869881, 27188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_14 = {
+	12,
+	1,
+	0,
+	{ 971838873, 159 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_15 = {
+	10,
+	1,
+	0,
+	{ 528966885, 7 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_den_16 = {
+	10,
+	0,
+	0,
+	{ 792167686, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_den_17 = {
+	8,
+	0,
+	0,
+	{ 79721796 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_den_18 = {
+	7,
+	0,
+	0,
+	{ 1689765 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_den_19 = {
+	5,
+	0,
+	0,
+	{ 25025 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_den_20 = {
+	3,
+	0,
+	0,
+	{ 231 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_den_21 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+const decNumber *const const_gamma_den[22] = {
+	(const decNumber *) &const_gamma_den_0,
+	(const decNumber *) &const_gamma_den_1,
+	(const decNumber *) &const_gamma_den_2,
+	(const decNumber *) &const_gamma_den_3,
+	(const decNumber *) &const_gamma_den_4,
+	(const decNumber *) &const_gamma_den_5,
+	(const decNumber *) &const_gamma_den_6,
+	(const decNumber *) &const_gamma_den_7,
+	(const decNumber *) &const_gamma_den_8,
+	(const decNumber *) &const_gamma_den_9,
+	(const decNumber *) &const_gamma_den_10,
+	(const decNumber *) &const_gamma_den_11,
+	(const decNumber *) &const_gamma_den_12,
+	(const decNumber *) &const_gamma_den_13,
+	(const decNumber *) &const_gamma_den_14,
+	(const decNumber *) &const_gamma_den_15,
+	(const decNumber *) &const_gamma_den_16,
+	(const decNumber *) &const_gamma_den_17,
+	(const decNumber *) &const_gamma_den_18,
+	(const decNumber *) &const_gamma_den_19,
+	(const decNumber *) &const_gamma_den_20,
+	(const decNumber *) &const_gamma_den_21,
+};
+
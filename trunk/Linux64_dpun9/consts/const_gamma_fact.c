@@ -0,0 +1,441 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_fact_0 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_gamma_fact_1 = {
+	4,
+	1,
+	0,
+	{ 4032 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[2];
+} const_gamma_fact_2 = {
+	11,
+	3,
+	0,
+	{ 922789888, 20 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[3];
+} const_gamma_fact_3 = {
+	20,
+	4,
+	0,
+	{ 323943936, 44840173, 62 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[4];
+} const_gamma_fact_4 = {
+	29,
+	7,
+	0,
+	{ 721801216, 369353016, 313083693, 26 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_5 = {
+	39,
+	9,
+	0,
+	{ 115894272, 611269596, 897734345, 915283247, 815 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_6 = {
+	39,
+	23,
+	0,
+	{ 733750385, 622890473, 360726708, 139155925, 124 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_7 = {
+	39,
+	36,
+	0,
+	{ 724949736, 45647463, 863451854, 998587804, 710 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_8 = {
+	39,
+	51,
+	0,
+	{ 161480803, 433389335, 884164103, 886932185, 126 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_9 = {
+	39,
+	65,
+	0,
+	{ 746727408, 240703852, 860868615, 344583768, 612 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_10 = {
+	39,
+	80,
+	0,
+	{ 865321656, 115337231, 638022948, 694570462, 715 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_11 = {
+	38,
+	97,
+	0,
+	{ 554628438, 479684564, 739843911, 548264225, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_12 = {
+	39,
+	111,
+	0,
+	{ 893801158, 571401541, 949689209, 677934870, 991 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_13 = {
+	39,
+	128,
+	0,
+	{ 650442831, 485838647, 456276238, 990167451, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_14 = {
+	39,
+	144,
+	0,
+	{ 992488341, 682037275, 107402353, 450685722, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_15 = {
+	39,
+	160,
+	0,
+	{ 37258675, 811805409, 912705758, 950291344, 668 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_16 = {
+	39,
+	177,
+	0,
+	{ 463640617, 677065923, 580421735, 620482362, 385 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_17 = {
+	39,
+	194,
+	0,
+	{ 989334543, 972722051, 254865768, 904288195, 365 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_18 = {
+	37,
+	213,
+	0,
+	{ 550388118, 551054660, 739304789, 550293832, 5 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_19 = {
+	39,
+	229,
+	0,
+	{ 471711481, 672467123, 345254560, 133588568, 131 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_20 = {
+	39,
+	246,
+	0,
+	{ 194377951, 694321176, 206132240, 472363599, 471 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_21 = {
+	39,
+	264,
+	0,
+	{ 134114679, 801886917, 319838753, 607574497, 252 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_22 = {
+	39,
+	282,
+	0,
+	{ 27948917, 523349201, 89593781, 903110431, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_23 = {
+	39,
+	300,
+	0,
+	{ 360168028, 605724535, 982745247, 838537954, 222 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_24 = {
+	39,
+	318,
+	0,
+	{ 973425965, 355363383, 960497053, 996793146, 354 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_25 = {
+	39,
+	336,
+	0,
+	{ 185062295, 363213932, 790503552, 657867364, 788 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_26 = {
+	39,
+	355,
+	0,
+	{ 292670443, 717895291, 527600328, 111005450, 241 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_27 = {
+	39,
+	374,
+	0,
+	{ 313572928, 455305804, 461077939, 204337031, 100 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_28 = {
+	39,
+	392,
+	0,
+	{ 645931765, 45731013, 377604046, 715935375, 559 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_29 = {
+	39,
+	411,
+	0,
+	{ 261943062, 571637026, 770977015, 798210832, 415 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_30 = {
+	39,
+	430,
+	0,
+	{ 688531017, 357592148, 705812049, 788536364, 406 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_fact_31 = {
+	39,
+	449,
+	0,
+	{ 107384899, 150932052, 864695955, 334339101, 519 }
+};
+
+const decNumber *const const_gamma_fact[32] = {
+	(const decNumber *) &const_gamma_fact_0,
+	(const decNumber *) &const_gamma_fact_1,
+	(const decNumber *) &const_gamma_fact_2,
+	(const decNumber *) &const_gamma_fact_3,
+	(const decNumber *) &const_gamma_fact_4,
+	(const decNumber *) &const_gamma_fact_5,
+	(const decNumber *) &const_gamma_fact_6,
+	(const decNumber *) &const_gamma_fact_7,
+	(const decNumber *) &const_gamma_fact_8,
+	(const decNumber *) &const_gamma_fact_9,
+	(const decNumber *) &const_gamma_fact_10,
+	(const decNumber *) &const_gamma_fact_11,
+	(const decNumber *) &const_gamma_fact_12,
+	(const decNumber *) &const_gamma_fact_13,
+	(const decNumber *) &const_gamma_fact_14,
+	(const decNumber *) &const_gamma_fact_15,
+	(const decNumber *) &const_gamma_fact_16,
+	(const decNumber *) &const_gamma_fact_17,
+	(const decNumber *) &const_gamma_fact_18,
+	(const decNumber *) &const_gamma_fact_19,
+	(const decNumber *) &const_gamma_fact_20,
+	(const decNumber *) &const_gamma_fact_21,
+	(const decNumber *) &const_gamma_fact_22,
+	(const decNumber *) &const_gamma_fact_23,
+	(const decNumber *) &const_gamma_fact_24,
+	(const decNumber *) &const_gamma_fact_25,
+	(const decNumber *) &const_gamma_fact_26,
+	(const decNumber *) &const_gamma_fact_27,
+	(const decNumber *) &const_gamma_fact_28,
+	(const decNumber *) &const_gamma_fact_29,
+	(const decNumber *) &const_gamma_fact_30,
+	(const decNumber *) &const_gamma_fact_31,
+};
+
@@ -0,0 +1,441 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_0 = {
+	38,
+	-37,
+	0,
+	{ 411451828, 981674833, 55160272, 724538509, 17 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_1 = {
+	39,
+	-34,
+	0,
+	{ 296281803, 705779020, 834125985, 344072934, 140 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_2 = {
+	39,
+	-26,
+	0,
+	{ 766693345, 248177437, 12508307, 999845304, 518 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_3 = {
+	39,
+	-15,
+	0,
+	{ 854165937, 546212061, 293746235, 990634307, 125 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_4 = {
+	38,
+	-3,
+	0,
+	{ 323500268, 988971821, 513904384, 334060788, 46 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_5 = {
+	39,
+	9,
+	0,
+	{ 198775276, 871394876, 499153583, 605024825, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_6 = {
+	37,
+	24,
+	0,
+	{ 893236561, 244196686, 646447906, 787134400, 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_7 = {
+	39,
+	35,
+	0,
+	{ 185364841, 916197193, 672904328, 993435843, 947 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_8 = {
+	39,
+	50,
+	0,
+	{ 950218986, 679490338, 127684000, 299188153, 158 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_9 = {
+	38,
+	65,
+	0,
+	{ 862084737, 670767346, 695915418, 40323637, 72 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_10 = {
+	39,
+	79,
+	0,
+	{ 261773146, 814092043, 712509416, 921572768, 798 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_11 = {
+	39,
+	95,
+	0,
+	{ 719295458, 171121031, 45140060, 444502289, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_12 = {
+	39,
+	111,
+	0,
+	{ 236009844, 225548085, 504933819, 81004380, 101 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_13 = {
+	39,
+	127,
+	0,
+	{ 890507273, 186502832, 596053029, 868858959, 100 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_14 = {
+	39,
+	143,
+	0,
+	{ 857186646, 571350399, 181060820, 365248585, 186 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_15 = {
+	38,
+	160,
+	0,
+	{ 745281968, 614555791, 240058743, 2949740, 61 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_16 = {
+	39,
+	176,
+	0,
+	{ 33821277, 933600841, 78039975, 510880822, 340 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_17 = {
+	39,
+	193,
+	0,
+	{ 583439052, 738814172, 394177614, 472089088, 313 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_18 = {
+	39,
+	210,
+	0,
+	{ 88061136, 942467343, 371012050, 123164128, 462 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_19 = {
+	39,
+	228,
+	0,
+	{ 609980828, 976563461, 290539573, 275951702, 106 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_20 = {
+	39,
+	245,
+	0,
+	{ 985326318, 882946057, 281963490, 440548305, 372 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_21 = {
+	39,
+	263,
+	0,
+	{ 221768254, 446755052, 887025400, 746020834, 194 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_22 = {
+	39,
+	281,
+	0,
+	{ 483327015, 997599419, 794482289, 69171850, 149 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_23 = {
+	38,
+	300,
+	0,
+	{ 664298841, 172765307, 950913373, 416718533, 16 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_24 = {
+	39,
+	317,
+	0,
+	{ 826092641, 3914910, 197151715, 30127242, 256 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_25 = {
+	39,
+	335,
+	0,
+	{ 659149418, 320296290, 137913364, 316894480, 557 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_26 = {
+	39,
+	354,
+	0,
+	{ 314333921, 16138411, 77991042, 79963832, 167 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_27 = {
+	38,
+	373,
+	0,
+	{ 137468646, 176240726, 393353634, 140970674, 68 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_28 = {
+	39,
+	391,
+	0,
+	{ 244173124, 521033470, 829256667, 767306476, 373 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_29 = {
+	39,
+	410,
+	0,
+	{ 39201283, 948073267, 627666887, 837856618, 272 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_30 = {
+	39,
+	429,
+	0,
+	{ 137184128, 681582642, 225755199, 444145965, 262 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_half_31 = {
+	39,
+	448,
+	0,
+	{ 770555969, 698726802, 673819710, 611458536, 329 }
+};
+
+const decNumber *const const_gamma_half[32] = {
+	(const decNumber *) &const_gamma_half_0,
+	(const decNumber *) &const_gamma_half_1,
+	(const decNumber *) &const_gamma_half_2,
+	(const decNumber *) &const_gamma_half_3,
+	(const decNumber *) &const_gamma_half_4,
+	(const decNumber *) &const_gamma_half_5,
+	(const decNumber *) &const_gamma_half_6,
+	(const decNumber *) &const_gamma_half_7,
+	(const decNumber *) &const_gamma_half_8,
+	(const decNumber *) &const_gamma_half_9,
+	(const decNumber *) &const_gamma_half_10,
+	(const decNumber *) &const_gamma_half_11,
+	(const decNumber *) &const_gamma_half_12,
+	(const decNumber *) &const_gamma_half_13,
+	(const decNumber *) &const_gamma_half_14,
+	(const decNumber *) &const_gamma_half_15,
+	(const decNumber *) &const_gamma_half_16,
+	(const decNumber *) &const_gamma_half_17,
+	(const decNumber *) &const_gamma_half_18,
+	(const decNumber *) &const_gamma_half_19,
+	(const decNumber *) &const_gamma_half_20,
+	(const decNumber *) &const_gamma_half_21,
+	(const decNumber *) &const_gamma_half_22,
+	(const decNumber *) &const_gamma_half_23,
+	(const decNumber *) &const_gamma_half_24,
+	(const decNumber *) &const_gamma_half_25,
+	(const decNumber *) &const_gamma_half_26,
+	(const decNumber *) &const_gamma_half_27,
+	(const decNumber *) &const_gamma_half_28,
+	(const decNumber *) &const_gamma_half_29,
+	(const decNumber *) &const_gamma_half_30,
+	(const decNumber *) &const_gamma_half_31,
+};
+
@@ -0,0 +1,311 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_0 = {
+	39,
+	-9,
+	0,
+	{ 445469345, 229770193, 257030728, 620600963, 116 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_1 = {
+	39,
+	-9,
+	0,
+	{ 736026123, 582447717, 61763417, 642500317, 105 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_2 = {
+	39,
+	-10,
+	0,
+	{ 266451287, 401992657, 389104066, 706977427, 455 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_3 = {
+	39,
+	-10,
+	0,
+	{ 66627366, 699553268, 38704321, 499589505, 124 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_4 = {
+	39,
+	-11,
+	0,
+	{ 328674261, 541414362, 529450865, 675819448, 241 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_5 = {
+	39,
+	-12,
+	0,
+	{ 989291013, 173774813, 340869278, 460412319, 354 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_6 = {
+	39,
+	-13,
+	0,
+	{ 188391856, 277884447, 802517687, 750902098, 407 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_7 = {
+	38,
+	-13,
+	0,
+	{ 365639054, 702962867, 210155637, 692021633, 37 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_8 = {
+	39,
+	-15,
+	0,
+	{ 170651683, 652544384, 369960141, 545399649, 284 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_9 = {
+	39,
+	-16,
+	0,
+	{ 491941106, 865452234, 140416012, 304308782, 177 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_10 = {
+	39,
+	-18,
+	0,
+	{ 713976045, 83488466, 553202376, 846779573, 917 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_11 = {
+	39,
+	-19,
+	0,
+	{ 972187105, 102119104, 39611565, 952053549, 395 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_12 = {
+	39,
+	-20,
+	0,
+	{ 412830689, 381724091, 698334597, 343128917, 142 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_13 = {
+	39,
+	-22,
+	0,
+	{ 60652482, 567393893, 910987730, 121967785, 425 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_14 = {
+	39,
+	-23,
+	0,
+	{ 427892551, 531945897, 457865840, 798747759, 104 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_15 = {
+	39,
+	-25,
+	0,
+	{ 726258158, 489516769, 926123572, 982369922, 210 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_16 = {
+	39,
+	-27,
+	0,
+	{ 741976626, 879425262, 199587560, 321313860, 341 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_17 = {
+	39,
+	-29,
+	0,
+	{ 572341381, 526782359, 168853566, 84991908, 433 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_18 = {
+	39,
+	-31,
+	0,
+	{ 588427637, 965206740, 978786199, 194809460, 415 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_19 = {
+	39,
+	-33,
+	0,
+	{ 226321576, 784861536, 674479830, 822204538, 282 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_20 = {
+	39,
+	-35,
+	0,
+	{ 589400863, 693005723, 968675062, 14111323, 122 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_num_21 = {
+	39,
+	-38,
+	0,
+	{ 24621819, 576528481, 100050241, 662827463, 250 }
+};
+
+const decNumber *const const_gamma_num[22] = {
+	(const decNumber *) &const_gamma_num_0,
+	(const decNumber *) &const_gamma_num_1,
+	(const decNumber *) &const_gamma_num_2,
+	(const decNumber *) &const_gamma_num_3,
+	(const decNumber *) &const_gamma_num_4,
+	(const decNumber *) &const_gamma_num_5,
+	(const decNumber *) &const_gamma_num_6,
+	(const decNumber *) &const_gamma_num_7,
+	(const decNumber *) &const_gamma_num_8,
+	(const decNumber *) &const_gamma_num_9,
+	(const decNumber *) &const_gamma_num_10,
+	(const decNumber *) &const_gamma_num_11,
+	(const decNumber *) &const_gamma_num_12,
+	(const decNumber *) &const_gamma_num_13,
+	(const decNumber *) &const_gamma_num_14,
+	(const decNumber *) &const_gamma_num_15,
+	(const decNumber *) &const_gamma_num_16,
+	(const decNumber *) &const_gamma_num_17,
+	(const decNumber *) &const_gamma_num_18,
+	(const decNumber *) &const_gamma_num_19,
+	(const decNumber *) &const_gamma_num_20,
+	(const decNumber *) &const_gamma_num_21,
+};
+
@@ -0,0 +1,337 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_0 = {
+	39,
+	-40,
+	0,
+	{ 333333333, 333333333, 333333333, 333333333, 833 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_1 = {
+	39,
+	-41,
+	128,
+	{ 777777778, 777777777, 777777777, 777777777, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_2 = {
+	39,
+	-42,
+	0,
+	{ 793650794, 650793650, 793650793, 650793650, 793 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_3 = {
+	39,
+	-42,
+	128,
+	{ 95238095, 238095238, 95238095, 238095238, 595 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_4 = {
+	39,
+	-42,
+	0,
+	{ 841750842, 750841750, 841750841, 750841750, 841 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_5 = {
+	39,
+	-41,
+	128,
+	{ 691752692, 752691752, 691752691, 752691752, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_6 = {
+	39,
+	-41,
+	0,
+	{ 641025641, 25641025, 641025641, 25641025, 641 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_7 = {
+	39,
+	-40,
+	128,
+	{ 241830065, 653594771, 712418300, 506535947, 295 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_8 = {
+	39,
+	-39,
+	0,
+	{ 889396694, 938490015, 830573164, 644372368, 179 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_9 = {
+	39,
+	-38,
+	128,
+	{ 590111643, 743221690, 590111642, 243221690, 139 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_10 = {
+	39,
+	-37,
+	0,
+	{ 901311249, 789510006, 683919944, 28640441, 134 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_11 = {
+	39,
+	-36,
+	128,
+	{ 88973828, 365132452, 2017306, 848284626, 156 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_12 = {
+	39,
+	-35,
+	0,
+	{ 333333333, 333333333, 333333333, 310333333, 219 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_13 = {
+	39,
+	-34,
+	128,
+	{ 422307365, 732652192, 249893571, 87712537, 361 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_14 = {
+	39,
+	-33,
+	0,
+	{ 673467553, 395250775, 313067108, 472268851, 691 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_15 = {
+	39,
+	-31,
+	128,
+	{ 867805187, 833649588, 74161922, 382215394, 152 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_16 = {
+	39,
+	-30,
+	0,
+	{ 414141414, 141414141, 414141414, 900751391, 382 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_17 = {
+	39,
+	-28,
+	128,
+	{ 251053747, 151491655, 843910890, 822660357, 108 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_18 = {
+	39,
+	-27,
+	0,
+	{ 252252252, 252252252, 2252252, 320283765, 347 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_19 = {
+	39,
+	-25,
+	128,
+	{ 713248811, 517103492, 692744542, 696021422, 123 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_20 = {
+	39,
+	-24,
+	0,
+	{ 22902108, 815162518, 79335075, 788064793, 488 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_21 = {
+	39,
+	-22,
+	128,
+	{ 368385575, 750589821, 193738969, 203339609, 213 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_22 = {
+	39,
+	-20,
+	0,
+	{ 358550039, 528762805, 570007756, 177529652, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_gamma_stirling_23 = {
+	39,
+	-19,
+	128,
+	{ 692044848, 277091919, 2036108, 754721733, 535 }
+};
+
+const decNumber *const const_gamma_stirling[24] = {
+	(const decNumber *) &const_gamma_stirling_0,
+	(const decNumber *) &const_gamma_stirling_1,
+	(const decNumber *) &const_gamma_stirling_2,
+	(const decNumber *) &const_gamma_stirling_3,
+	(const decNumber *) &const_gamma_stirling_4,
+	(const decNumber *) &const_gamma_stirling_5,
+	(const decNumber *) &const_gamma_stirling_6,
+	(const decNumber *) &const_gamma_stirling_7,
+	(const decNumber *) &const_gamma_stirling_8,
+	(const decNumber *) &const_gamma_stirling_9,
+	(const decNumber *) &const_gamma_stirling_10,
+	(const decNumber *) &const_gamma_stirling_11,
+	(const decNumber *) &const_gamma_stirling_12,
+	(const decNumber *) &const_gamma_stirling_13,
+	(const decNumber *) &const_gamma_stirling_14,
+	(const decNumber *) &const_gamma_stirling_15,
+	(const decNumber *) &const_gamma_stirling_16,
+	(const decNumber *) &const_gamma_stirling_17,
+	(const decNumber *) &const_gamma_stirling_18,
+	(const decNumber *) &const_gamma_stirling_19,
+	(const decNumber *) &const_gamma_stirling_20,
+	(const decNumber *) &const_gamma_stirling_21,
+	(const decNumber *) &const_gamma_stirling_22,
+	(const decNumber *) &const_gamma_stirling_23,
+};
+
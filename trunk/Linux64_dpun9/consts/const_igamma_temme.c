@@ -0,0 +1,8345 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_0 = {
+	39,
+	-39,
+	128,
+	{ 333333333, 333333333, 333333333, 333333333, 333 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_1 = {
+	39,
+	-40,
+	0,
+	{ 333333333, 333333333, 333333333, 333333333, 833 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_2 = {
+	39,
+	-40,
+	128,
+	{ 148148148, 148148148, 148148148, 148148148, 148 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_3 = {
+	39,
+	-41,
+	0,
+	{ 740740741, 740740740, 740740740, 740740740, 115 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_4 = {
+	39,
+	-42,
+	0,
+	{ 19400353, 733686067, 19400352, 733686067, 352 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_5 = {
+	39,
+	-42,
+	128,
+	{ 255144033, 588477366, 921810699, 755144032, 178 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_6 = {
+	39,
+	-43,
+	0,
+	{ 21555947, 704095630, 243778169, 926317852, 391 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_7 = {
+	39,
+	-44,
+	128,
+	{ 443660592, 364295512, 999216147, 544851067, 218 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_8 = {
+	39,
+	-44,
+	128,
+	{ 956325288, 179883622, 515996070, 406221071, 185 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_9 = {
+	39,
+	-45,
+	0,
+	{ 443227192, 624213166, 308600501, 671134095, 829 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_10 = {
+	39,
+	-45,
+	128,
+	{ 424030355, 600542457, 260793043, 659527368, 176 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_11 = {
+	39,
+	-47,
+	0,
+	{ 613572192, 939710029, 149858036, 785354340, 670 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_12 = {
+	39,
+	-46,
+	0,
+	{ 252950872, 739573227, 403080425, 618097842, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_13 = {
+	39,
+	-47,
+	128,
+	{ 719123389, 297462244, 335318655, 203601845, 438 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_14 = {
+	39,
+	-48,
+	0,
+	{ 113680785, 248817633, 679023418, 769958223, 914 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_15 = {
+	39,
+	-49,
+	128,
+	{ 887013144, 779537993, 462497668, 141939949, 255 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_16 = {
+	39,
+	-49,
+	128,
+	{ 35797531, 408945040, 42506746, 77213255, 583 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_17 = {
+	39,
+	-49,
+	0,
+	{ 789942867, 940696707, 674162436, 619480206, 243 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_18 = {
+	39,
+	-50,
+	128,
+	{ 744365524, 54985925, 417558909, 766928011, 502 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_19 = {
+	39,
+	-51,
+	0,
+	{ 293411334, 374174497, 561347708, 43920319, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_20 = {
+	39,
+	-51,
+	0,
+	{ 200184827, 769884169, 98537882, 176326240, 337 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_21 = {
+	39,
+	-51,
+	128,
+	{ 579979895, 936618489, 816206591, 238872241, 139 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_22 = {
+	39,
+	-52,
+	0,
+	{ 828298924, 669099052, 474432039, 348938070, 285 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_23 = {
+	39,
+	-54,
+	128,
+	{ 494205454, 64580300, 257261899, 911183424, 513 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_24 = {
+	39,
+	-53,
+	128,
+	{ 710912202, 962401580, 494428353, 522882943, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_25 = {
+	39,
+	-54,
+	0,
+	{ 575255316, 115668702, 456133407, 952115670, 809 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_26 = {
+	39,
+	-54,
+	128,
+	{ 351161648, 514820265, 981618191, 225312163, 165 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_27 = {
+	39,
+	-56,
+	0,
+	{ 267384909, 61090060, 788842327, 54300974, 253 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_28 = {
+	38,
+	-54,
+	0,
+	{ 779347462, 823087650, 559576588, 686939738, 11 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_29 = {
+	39,
+	-56,
+	128,
+	{ 816597403, 167804084, 48475822, 3704982, 477 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_30 = {
+	39,
+	-57,
+	0,
+	{ 585354423, 709685898, 623712420, 912605905, 969 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_31 = {
+	38,
+	-57,
+	128,
+	{ 496291198, 443256774, 38175010, 932565538, 12 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_32 = {
+	39,
+	-58,
+	128,
+	{ 519451968, 54631585, 569338053, 923025318, 696 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_33 = {
+	39,
+	-58,
+	0,
+	{ 168750839, 319618713, 693659992, 514543217, 283 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_34 = {
+	39,
+	-59,
+	128,
+	{ 84234598, 266613952, 704750016, 98215900, 575 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_35 = {
+	39,
+	-61,
+	0,
+	{ 43142088, 496566437, 891456461, 295378348, 679 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_36 = {
+	38,
+	-59,
+	0,
+	{ 482268659, 79726093, 113358578, 821254261, 41 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_37 = {
+	39,
+	-60,
+	128,
+	{ 824731674, 950569505, 476037321, 715396200, 169 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_38 = {
+	39,
+	-61,
+	0,
+	{ 942858307, 42564246, 431988296, 621593839, 343 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_39 = {
+	39,
+	-63,
+	128,
+	{ 545728611, 939686784, 802101196, 399577962, 364 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_40 = {
+	39,
+	-41,
+	128,
+	{ 185185185, 185185185, 185185185, 185185185, 185 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_41 = {
+	39,
+	-41,
+	128,
+	{ 222222222, 222222222, 222222222, 222222222, 347 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_42 = {
+	39,
+	-41,
+	0,
+	{ 264550265, 550264550, 264550264, 550264550, 264 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_43 = {
+	39,
+	-42,
+	128,
+	{ 226337449, 893004115, 559670781, 226337448, 990 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_44 = {
+	39,
+	-42,
+	0,
+	{ 761316872, 94650205, 427983539, 761316872, 205 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_45 = {
+	39,
+	-45,
+	128,
+	{ 127572016, 794238683, 460905349, 877572016, 401 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_46 = {
+	39,
+	-43,
+	128,
+	{ 533523226, 285914867, 899778370, 985503344, 180 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_47 = {
+	39,
+	-44,
+	0,
+	{ 169209522, 742149809, 111008463, 916091608, 764 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_48 = {
+	39,
+	-44,
+	128,
+	{ 177669914, 752218822, 634460037, 209008945, 161 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_49 = {
+	39,
+	-47,
+	0,
+	{ 722400847, 135033938, 743434226, 712780280, 464 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_50 = {
+	38,
+	-44,
+	0,
+	{ 748887691, 118753307, 157209593, 786334469, 13 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_51 = {
+	38,
+	-45,
+	128,
+	{ 504830684, 219453183, 177049640, 525456035, 57 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_52 = {
+	39,
+	-46,
+	0,
+	{ 698169404, 76536699, 781473243, 516285997, 119 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_53 = {
+	38,
+	-48,
+	128,
+	{ 231250225, 754755120, 747647623, 543241719, 17 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_54 = {
+	39,
+	-47,
+	128,
+	{ 681674945, 577504686, 4126274, 915437106, 100 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_55 = {
+	39,
+	-48,
+	0,
+	{ 858627984, 372347219, 258263623, 279299184, 416 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_56 = {
+	39,
+	-49,
+	128,
+	{ 670208149, 431562579, 298063807, 390702649, 856 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_57 = {
+	39,
+	-52,
+	0,
+	{ 919581217, 701762169, 475861512, 721510160, 606 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_58 = {
+	39,
+	-50,
+	0,
+	{ 545733447, 961017165, 148539007, 249896481, 716 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_59 = {
+	39,
+	-50,
+	128,
+	{ 595402874, 636683615, 143711740, 318664377, 293 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_60 = {
+	39,
+	-51,
+	0,
+	{ 788908897, 374527568, 368872330, 669636568, 599 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_61 = {
+	39,
+	-54,
+	128,
+	{ 701734206, 100472779, 233141017, 717865273, 216 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_62 = {
+	39,
+	-52,
+	128,
+	{ 108547528, 815522048, 926164052, 833997236, 497 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_63 = {
+	39,
+	-52,
+	0,
+	{ 894225667, 694804325, 134247736, 916288237, 202 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_64 = {
+	39,
+	-53,
+	128,
+	{ 187110935, 108332558, 61004935, 125571381, 413 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_65 = {
+	39,
+	-57,
+	0,
+	{ 589315699, 188591057, 309644380, 651623988, 828 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_66 = {
+	39,
+	-54,
+	0,
+	{ 600992407, 339355910, 333279336, 3088693, 341 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_67 = {
+	39,
+	-54,
+	128,
+	{ 313702734, 34547426, 939715357, 541953028, 138 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_68 = {
+	39,
+	-55,
+	0,
+	{ 259483442, 860332727, 887466568, 234665322, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_69 = {
+	39,
+	-59,
+	128,
+	{ 452930386, 778993870, 302880526, 644419414, 340 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_70 = {
+	39,
+	-56,
+	128,
+	{ 854435917, 816729489, 155719113, 97973151, 231 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_71 = {
+	39,
+	-57,
+	0,
+	{ 664902034, 858346484, 225592558, 675706413, 936 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_72 = {
+	39,
+	-57,
+	128,
+	{ 495977663, 755193480, 584870521, 725701528, 189 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_73 = {
+	39,
+	-61,
+	0,
+	{ 114069867, 411599199, 395976792, 126307403, 149 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_74 = {
+	39,
+	-58,
+	0,
+	{ 470202461, 889235719, 513963797, 349000472, 155 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_75 = {
+	39,
+	-59,
+	128,
+	{ 249043144, 268354310, 718747638, 513045423, 628 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_76 = {
+	39,
+	-59,
+	0,
+	{ 48097102, 322863906, 224709004, 91101137, 127 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_77 = {
+	39,
+	-64,
+	128,
+	{ 557763494, 3257785, 788365181, 338571762, 686 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_78 = {
+	39,
+	-60,
+	128,
+	{ 307162013, 382779712, 132617604, 764939825, 103 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_79 = {
+	39,
+	-61,
+	0,
+	{ 825900702, 931441297, 916500116, 211965048, 419 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_80 = {
+	39,
+	-41,
+	0,
+	{ 788359788, 359788359, 788359788, 359788359, 413 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_81 = {
+	39,
+	-41,
+	128,
+	{ 382716049, 382716049, 382716049, 132716049, 268 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_82 = {
+	39,
+	-42,
+	0,
+	{ 604938272, 604938271, 604938271, 604938271, 771 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_83 = {
+	39,
+	-44,
+	0,
+	{ 563786008, 897119341, 230452674, 938786008, 200 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_84 = {
+	39,
+	-42,
+	128,
+	{ 676296573, 391223621, 651605215, 366532263, 107 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_85 = {
+	39,
+	-43,
+	0,
+	{ 90143053, 217127180, 201254164, 234488291, 529 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_86 = {
+	38,
+	-42,
+	128,
+	{ 236011664, 377919139, 618727713, 760635188, 12 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_87 = {
+	39,
+	-46,
+	0,
+	{ 473889724, 20039047, 613807419, 357873409, 342 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_88 = {
+	39,
+	-44,
+	0,
+	{ 20278558, 943852926, 629332055, 219573090, 137 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_89 = {
+	39,
+	-45,
+	128,
+	{ 391876319, 672234278, 5502290, 899213838, 629 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_90 = {
+	39,
+	-45,
+	0,
+	{ 771747624, 846008822, 642417915, 806142060, 142 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_91 = {
+	39,
+	-48,
+	128,
+	{ 200226113, 195854409, 908660149, 770984219, 204 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_92 = {
+	39,
+	-46,
+	128,
+	{ 315272177, 930244154, 675210532, 925299108, 140 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_93 = {
+	39,
+	-47,
+	0,
+	{ 327111686, 394293530, 202203356, 897408492, 622 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_94 = {
+	39,
+	-47,
+	128,
+	{ 402402165, 724380284, 171134992, 704883966, 136 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_95 = {
+	39,
+	-51,
+	0,
+	{ 208075171, 711211663, 467819547, 835615901, 942 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_96 = {
+	39,
+	-48,
+	0,
+	{ 770441813, 479368872, 893180595, 722524000, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_97 = {
+	39,
+	-49,
+	128,
+	{ 951439269, 414765894, 633211465, 459561343, 556 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_98 = {
+	39,
+	-49,
+	0,
+	{ 311342764, 898150310, 669810035, 759355463, 119 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_99 = {
+	39,
+	-53,
+	128,
+	{ 480096231, 836626692, 386350403, 897822518, 416 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_100 = {
+	38,
+	-49,
+	128,
+	{ 80290817, 929900864, 884594409, 940640427, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_101 = {
+	39,
+	-51,
+	0,
+	{ 467899659, 620492246, 13574632, 223994639, 466 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_102 = {
+	39,
+	-52,
+	128,
+	{ 382301318, 122258212, 690597844, 510576390, 990 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_103 = {
+	39,
+	-55,
+	0,
+	{ 630169013, 885183170, 735145056, 318767683, 189 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_104 = {
+	39,
+	-53,
+	0,
+	{ 740667368, 31067028, 112726176, 922187259, 885 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_105 = {
+	38,
+	-52,
+	128,
+	{ 719193653, 656025177, 464054530, 378203980, 37 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_106 = {
+	39,
+	-54,
+	0,
+	{ 960750993, 88394065, 515525774, 883363903, 786 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_107 = {
+	39,
+	-58,
+	128,
+	{ 609545025, 540648175, 121116608, 2739574, 900 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_108 = {
+	39,
+	-55,
+	128,
+	{ 800135963, 227164592, 767172043, 888122934, 692 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_109 = {
+	39,
+	-55,
+	0,
+	{ 716669423, 30056922, 647833528, 203842701, 290 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_110 = {
+	39,
+	-56,
+	128,
+	{ 316786386, 248317163, 87688547, 785469681, 606 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_111 = {
+	39,
+	-60,
+	0,
+	{ 75419456, 474746890, 685282406, 212072979, 447 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_112 = {
+	39,
+	-57,
+	0,
+	{ 564827445, 999424143, 978529225, 944614444, 527 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_113 = {
+	39,
+	-57,
+	128,
+	{ 978425951, 229924140, 573195819, 881123348, 219 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_114 = {
+	39,
+	-58,
+	0,
+	{ 484231429, 362217487, 487874377, 328277213, 457 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_115 = {
+	39,
+	-62,
+	128,
+	{ 925707837, 835907934, 672963989, 358626470, 230 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_116 = {
+	39,
+	-59,
+	128,
+	{ 942624437, 480674968, 97303290, 161558647, 394 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_117 = {
+	39,
+	-59,
+	0,
+	{ 73689909, 977584825, 63380865, 433737412, 163 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_118 = {
+	39,
+	-60,
+	128,
+	{ 428129733, 730820305, 294038128, 496214687, 338 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_119 = {
+	39,
+	-64,
+	0,
+	{ 570784909, 399861025, 96120482, 970726764, 121 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_120 = {
+	39,
+	-42,
+	0,
+	{ 934156379, 267489711, 600823045, 434156378, 649 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_121 = {
+	39,
+	-42,
+	0,
+	{ 65843621, 732510288, 399176954, 472093621, 229 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_122 = {
+	39,
+	-42,
+	128,
+	{ 206329412, 140111679, 255712128, 189494395, 469 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_123 = {
+	39,
+	-42,
+	0,
+	{ 209223333, 309752433, 838852962, 720632062, 267 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_124 = {
+	39,
+	-43,
+	128,
+	{ 755665764, 538191879, 397641072, 180167188, 756 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_125 = {
+	39,
+	-45,
+	128,
+	{ 231722806, 314027333, 729665193, 650511386, 239 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_126 = {
+	39,
+	-43,
+	0,
+	{ 861226633, 770299726, 473023614, 826541153, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_127 = {
+	39,
+	-44,
+	128,
+	{ 560205447, 963105701, 159656749, 495282699, 567 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_128 = {
+	39,
+	-44,
+	0,
+	{ 804330008, 518944705, 358839145, 309007324, 142 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_129 = {
+	39,
+	-49,
+	128,
+	{ 174451924, 802158211, 281422405, 610802915, 278 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_130 = {
+	39,
+	-45,
+	128,
+	{ 202669595, 641687958, 302772898, 584040919, 169 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_131 = {
+	39,
+	-46,
+	0,
+	{ 724080621, 278504852, 808236335, 946490538, 809 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_132 = {
+	39,
+	-46,
+	128,
+	{ 727634632, 728140872, 736540606, 111684859, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_133 = {
+	38,
+	-49,
+	0,
+	{ 228205583, 641351402, 808117968, 928620439, 23 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_134 = {
+	39,
+	-47,
+	0,
+	{ 654548725, 925818486, 887984369, 201318154, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_135 = {
+	39,
+	-48,
+	128,
+	{ 192813839, 417988510, 513217375, 49666185, 946 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_136 = {
+	39,
+	-48,
+	0,
+	{ 744512314, 130268468, 749078380, 410497757, 215 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_137 = {
+	39,
+	-52,
+	128,
+	{ 735291277, 424682490, 390304603, 882333681, 138 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_138 = {
+	39,
+	-49,
+	128,
+	{ 489455357, 123400466, 639394064, 947616819, 218 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_139 = {
+	39,
+	-50,
+	0,
+	{ 883368189, 262802255, 168512568, 99895117, 979 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_140 = {
+	39,
+	-50,
+	128,
+	{ 393244358, 859472011, 809621153, 821918801, 217 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_141 = {
+	39,
+	-55,
+	0,
+	{ 722049841, 663616849, 790142581, 881957340, 620 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_142 = {
+	38,
+	-50,
+	0,
+	{ 461447146, 670253711, 797369769, 269783632, 21 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_143 = {
+	39,
+	-52,
+	128,
+	{ 749472632, 396765626, 743333127, 468879151, 934 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_144 = {
+	39,
+	-52,
+	0,
+	{ 207436429, 215913063, 828493249, 536712267, 204 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_145 = {
+	39,
+	-57,
+	128,
+	{ 842521395, 467968637, 495021332, 260790403, 258 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_146 = {
+	39,
+	-53,
+	128,
+	{ 251175052, 438136487, 445443675, 52976733, 194 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_147 = {
+	39,
+	-54,
+	0,
+	{ 840991243, 138141443, 481552040, 597929048, 841 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_148 = {
+	39,
+	-54,
+	128,
+	{ 178324317, 922828305, 382252143, 4304395, 182 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_149 = {
+	38,
+	-58,
+	0,
+	{ 514608737, 516961721, 247309962, 735443641, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_150 = {
+	39,
+	-55,
+	0,
+	{ 953843425, 769367933, 528330296, 968283152, 168 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_151 = {
+	39,
+	-56,
+	128,
+	{ 637090716, 847738115, 214747025, 611174694, 725 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_152 = {
+	39,
+	-56,
+	0,
+	{ 596801648, 931746809, 220275216, 472927466, 155 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_153 = {
+	39,
+	-62,
+	128,
+	{ 654333212, 155890158, 523890313, 599475227, 460 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_154 = {
+	38,
+	-56,
+	128,
+	{ 983387792, 85627235, 761749021, 191358137, 14 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_155 = {
+	39,
+	-58,
+	0,
+	{ 75406308, 242992634, 782474017, 706649837, 604 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_156 = {
+	39,
+	-58,
+	128,
+	{ 86234755, 774283703, 678110343, 617347934, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_157 = {
+	39,
+	-64,
+	0,
+	{ 716301528, 737874497, 675938830, 233329936, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_158 = {
+	39,
+	-59,
+	0,
+	{ 725323552, 282511016, 630603632, 816640884, 115 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_159 = {
+	39,
+	-60,
+	128,
+	{ 64710634, 270931817, 800339468, 410908506, 490 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_160 = {
+	39,
+	-42,
+	128,
+	{ 57377617, 702719929, 711698604, 888290916, 861 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_161 = {
+	39,
+	-42,
+	0,
+	{ 288849696, 34881442, 66627474, 39221720, 784 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_162 = {
+	39,
+	-42,
+	128,
+	{ 819809363, 389609932, 190179733, 72480303, 299 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_163 = {
+	39,
+	-44,
+	128,
+	{ 697556267, 232535690, 434181781, 384525788, 146 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_164 = {
+	39,
+	-43,
+	0,
+	{ 862012905, 853782451, 512218665, 149821546, 664 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_165 = {
+	39,
+	-43,
+	128,
+	{ 386882081, 123507595, 943466443, 836504717, 396 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_166 = {
+	39,
+	-43,
+	0,
+	{ 831758796, 552042885, 784190980, 757269706, 113 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_167 = {
+	39,
+	-48,
+	0,
+	{ 57006731, 221942390, 753280165, 749722623, 250 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_168 = {
+	38,
+	-43,
+	128,
+	{ 152575181, 716435678, 558306014, 954149536, 16 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_169 = {
+	39,
+	-45,
+	0,
+	{ 515923851, 898422505, 530968882, 750753220, 890 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_170 = {
+	39,
+	-45,
+	128,
+	{ 158518297, 216364891, 80487057, 293483400, 229 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_171 = {
+	38,
+	-48,
+	0,
+	{ 458773, 657285250, 440490469, 567941375, 29 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_172 = {
+	39,
+	-46,
+	0,
+	{ 184503569, 341274604, 87836297, 658297427, 288 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_173 = {
+	38,
+	-45,
+	128,
+	{ 398271682, 477430390, 803219389, 189739437, 14 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_174 = {
+	39,
+	-47,
+	0,
+	{ 194356441, 527720474, 648970659, 635804994, 344 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_175 = {
+	39,
+	-51,
+	128,
+	{ 147087004, 192735850, 280671320, 245171745, 230 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_176 = {
+	39,
+	-48,
+	128,
+	{ 291798786, 697640085, 464052750, 92330280, 394 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_177 = {
+	38,
+	-47,
+	0,
+	{ 518563879, 425853304, 504501913, 602338968, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_178 = {
+	39,
+	-49,
+	128,
+	{ 262424285, 678327446, 661804380, 632300505, 435 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_179 = {
+	39,
+	-53,
+	0,
+	{ 930726006, 550463349, 962312660, 860010162, 127 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_180 = {
+	39,
+	-50,
+	0,
+	{ 760062307, 382739991, 791946200, 927502665, 467 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_181 = {
+	39,
+	-50,
+	128,
+	{ 721085698, 535341910, 348285410, 924647061, 214 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_182 = {
+	39,
+	-51,
+	0,
+	{ 984082121, 649688463, 965216323, 881561480, 490 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_183 = {
+	39,
+	-56,
+	128,
+	{ 49534612, 560567679, 156032604, 859148489, 633 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_184 = {
+	39,
+	-52,
+	128,
+	{ 118479761, 729251296, 9435733, 533206908, 504 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_185 = {
+	39,
+	-52,
+	0,
+	{ 846659768, 384818351, 12859238, 229582229, 227 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_186 = {
+	39,
+	-53,
+	128,
+	{ 287747053, 570847183, 240154193, 608260847, 509 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_187 = {
+	39,
+	-58,
+	0,
+	{ 936389808, 749224895, 713541889, 520975571, 305 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_188 = {
+	39,
+	-54,
+	0,
+	{ 898199592, 728412289, 55156496, 902167631, 506 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_189 = {
+	39,
+	-54,
+	128,
+	{ 806070853, 4253058, 818097629, 938369564, 224 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_190 = {
+	39,
+	-55,
+	0,
+	{ 171474008, 893715943, 141811188, 511142213, 497 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_191 = {
+	39,
+	-60,
+	128,
+	{ 946488138, 544673393, 173307088, 30163935, 149 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_192 = {
+	39,
+	-56,
+	128,
+	{ 585602353, 990301821, 42338601, 504577440, 482 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_193 = {
+	39,
+	-56,
+	0,
+	{ 653190934, 809033024, 465823117, 646676856, 211 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_194 = {
+	38,
+	-56,
+	128,
+	{ 634286442, 601552025, 492479057, 302113287, 46 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_195 = {
+	39,
+	-63,
+	0,
+	{ 614887972, 810859204, 994914097, 475387499, 747 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_196 = {
+	39,
+	-58,
+	0,
+	{ 596763737, 285517673, 518976748, 102275680, 440 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_197 = {
+	39,
+	-58,
+	128,
+	{ 68480517, 711702046, 179273307, 259864868, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_198 = {
+	38,
+	-58,
+	0,
+	{ 619288324, 254236082, 767277139, 473922063, 41 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_199 = {
+	38,
+	-64,
+	128,
+	{ 72556243, 521588683, 166084772, 639847311, 38 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_200 = {
+	39,
+	-42,
+	128,
+	{ 210002161, 767592718, 358150308, 798553366, 336 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_201 = {
+	39,
+	-43,
+	128,
+	{ 783308294, 398828575, 585777429, 281375836, 697 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_202 = {
+	39,
+	-42,
+	0,
+	{ 75010343, 364251965, 939207873, 275324495, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_203 = {
+	38,
+	-41,
+	128,
+	{ 84423832, 336040528, 188847700, 932570516, 19 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_204 = {
+	39,
+	-43,
+	0,
+	{ 435742019, 640176604, 720783881, 778047793, 679 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_205 = {
+	39,
+	-45,
+	0,
+	{ 575756696, 392727105, 396701483, 906292064, 141 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_206 = {
+	38,
+	-42,
+	128,
+	{ 750446931, 458393883, 768693278, 594048189, 13 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_207 = {
+	39,
+	-44,
+	0,
+	{ 196839815, 925719804, 420153971, 847025633, 801 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_208 = {
+	39,
+	-44,
+	128,
+	{ 781806396, 48790128, 809517038, 148117650, 229 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_209 = {
+	39,
+	-48,
+	128,
+	{ 5046503, 230137750, 845395166, 247355129, 325 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_210 = {
+	38,
+	-44,
+	0,
+	{ 757981524, 919549682, 85264955, 652846491, 34 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_211 = {
+	39,
+	-45,
+	128,
+	{ 920978154, 322367374, 713432765, 471871911, 184 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_212 = {
+	39,
+	-46,
+	0,
+	{ 989002398, 762631738, 941807563, 409670378, 482 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_213 = {
+	39,
+	-52,
+	128,
+	{ 644314314, 754291716, 435153025, 894667217, 179 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_214 = {
+	39,
+	-47,
+	128,
+	{ 944697973, 516981425, 352343517, 619450001, 630 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_215 = {
+	39,
+	-47,
+	0,
+	{ 969623138, 762181540, 456793773, 241762877, 316 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_216 = {
+	39,
+	-48,
+	128,
+	{ 267544997, 839303523, 742929000, 92425369, 784 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_217 = {
+	39,
+	-53,
+	0,
+	{ 746786363, 621764440, 404072377, 267916525, 519 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_218 = {
+	39,
+	-49,
+	0,
+	{ 645784584, 590623923, 678358459, 894424230, 935 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_219 = {
+	39,
+	-49,
+	128,
+	{ 328634436, 171193130, 327823101, 342621616, 451 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_220 = {
+	39,
+	-49,
+	0,
+	{ 321882773, 835885076, 168270409, 991299931, 107 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_221 = {
+	39,
+	-55,
+	128,
+	{ 385932806, 792727943, 525201090, 188671268, 366 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_222 = {
+	39,
+	-50,
+	128,
+	{ 709591312, 737885344, 515498798, 90206905, 121 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_223 = {
+	39,
+	-51,
+	0,
+	{ 254279211, 30838310, 56433289, 74358499, 568 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_224 = {
+	39,
+	-51,
+	128,
+	{ 708664043, 380474751, 408290878, 496599163, 132 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_225 = {
+	39,
+	-57,
+	0,
+	{ 867573282, 851115812, 840755204, 872407642, 189 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_226 = {
+	39,
+	-52,
+	0,
+	{ 16044736, 138840017, 947018851, 933902367, 141 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_227 = {
+	39,
+	-53,
+	128,
+	{ 921168462, 53982186, 469672313, 321470142, 652 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_228 = {
+	39,
+	-53,
+	0,
+	{ 531963699, 730732026, 28852399, 252426362, 149 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_229 = {
+	38,
+	-59,
+	128,
+	{ 836591407, 595571600, 323696867, 3894587, 88 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_230 = {
+	39,
+	-54,
+	128,
+	{ 307875687, 550981059, 338219079, 402225230, 154 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_231 = {
+	39,
+	-55,
+	0,
+	{ 95077614, 824359098, 723409160, 434135022, 698 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_232 = {
+	39,
+	-55,
+	128,
+	{ 899156375, 452185140, 488059230, 426638762, 157 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_233 = {
+	39,
+	-62,
+	0,
+	{ 68347875, 104775314, 774883626, 298638142, 393 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_234 = {
+	39,
+	-56,
+	0,
+	{ 759025499, 781130070, 544439016, 437270144, 158 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_235 = {
+	39,
+	-57,
+	128,
+	{ 652260585, 838885971, 685287108, 661553271, 707 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_236 = {
+	39,
+	-57,
+	0,
+	{ 925259418, 788449260, 279230725, 600575947, 157 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_237 = {
+	39,
+	-64,
+	128,
+	{ 629942625, 687314425, 137455092, 318773626, 176 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_238 = {
+	39,
+	-58,
+	128,
+	{ 533188859, 181678003, 155885592, 117914648, 155 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_239 = {
+	39,
+	-59,
+	0,
+	{ 984409447, 688268392, 330885317, 706989477, 685 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_240 = {
+	39,
+	-42,
+	0,
+	{ 623910409, 748542977, 992223165, 307936463, 531 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_241 = {
+	39,
+	-42,
+	128,
+	{ 401187392, 836225604, 693882864, 166437353, 592 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_242 = {
+	39,
+	-42,
+	0,
+	{ 328691906, 279183488, 804482771, 878209671, 270 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_243 = {
+	39,
+	-45,
+	0,
+	{ 816666384, 32944390, 32787212, 235323266, 790 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_244 = {
+	39,
+	-43,
+	128,
+	{ 682624216, 890088464, 196875092, 396936756, 815 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_245 = {
+	39,
+	-43,
+	0,
+	{ 471694918, 775619041, 624965003, 168275310, 561 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_246 = {
+	39,
+	-43,
+	128,
+	{ 98312712, 259749374, 433755673, 291165828, 183 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_247 = {
+	39,
+	-47,
+	128,
+	{ 677005854, 414192546, 330478256, 961345060, 307 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_248 = {
+	39,
+	-44,
+	0,
+	{ 376912536, 728529745, 360908673, 515536880, 346 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_249 = {
+	39,
+	-44,
+	128,
+	{ 695285053, 527254582, 586037269, 913273960, 202 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_250 = {
+	38,
+	-44,
+	0,
+	{ 318768708, 999758620, 490037088, 887928631, 57 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_251 = {
+	39,
+	-51,
+	0,
+	{ 637608608, 480579231, 665698933, 863067382, 233 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_252 = {
+	39,
+	-46,
+	128,
+	{ 262459567, 85243179, 48352505, 860074633, 882 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_253 = {
+	39,
+	-46,
+	0,
+	{ 852426018, 150770595, 81278032, 359588804, 474 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_254 = {
+	39,
+	-46,
+	128,
+	{ 783073335, 130611214, 103824457, 454150207, 125 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_255 = {
+	39,
+	-52,
+	0,
+	{ 900442562, 668303018, 29247134, 964885801, 864 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_256 = {
+	38,
+	-46,
+	0,
+	{ 634371599, 435777238, 264062708, 846058979, 16 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_257 = {
+	39,
+	-48,
+	128,
+	{ 584595577, 861200448, 759472855, 549282357, 857 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_258 = {
+	39,
+	-48,
+	0,
+	{ 929902514, 759258680, 321251884, 982249292, 215 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_259 = {
+	39,
+	-54,
+	128,
+	{ 425804644, 777999455, 615386834, 323052047, 761 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_260 = {
+	39,
+	-49,
+	128,
+	{ 544076591, 815699009, 361437135, 398220085, 266 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_261 = {
+	39,
+	-49,
+	0,
+	{ 177515197, 279880289, 110572948, 657005366, 130 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_262 = {
+	38,
+	-49,
+	128,
+	{ 834363179, 899107009, 367976681, 799163902, 31 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_263 = {
+	39,
+	-56,
+	0,
+	{ 30747939, 674194492, 743147023, 97612136, 471 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_264 = {
+	39,
+	-51,
+	0,
+	{ 923651295, 284089174, 634670964, 28008427, 369 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_265 = {
+	39,
+	-51,
+	128,
+	{ 272891569, 612580385, 14253879, 126740462, 176 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_266 = {
+	39,
+	-52,
+	0,
+	{ 153328109, 771614650, 147797988, 906678605, 417 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_267 = {
+	39,
+	-58,
+	128,
+	{ 826365138, 773976061, 788058581, 446793791, 253 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_268 = {
+	39,
+	-53,
+	128,
+	{ 216991002, 756440920, 160455017, 206594200, 463 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_269 = {
+	39,
+	-53,
+	0,
+	{ 804548466, 692860615, 464287936, 514548596, 216 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_270 = {
+	39,
+	-54,
+	128,
+	{ 140582296, 295604506, 762160825, 765176409, 503 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_271 = {
+	39,
+	-60,
+	0,
+	{ 393991691, 757692690, 969704209, 886786877, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_272 = {
+	39,
+	-55,
+	0,
+	{ 811752212, 282640734, 306498024, 686669896, 538 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_273 = {
+	39,
+	-55,
+	128,
+	{ 852630173, 634198235, 148774036, 681523876, 247 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_274 = {
+	39,
+	-56,
+	0,
+	{ 831403222, 912456546, 677708171, 362033309, 567 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_275 = {
+	39,
+	-63,
+	128,
+	{ 676181958, 68764011, 563092676, 642862256, 647 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_276 = {
+	39,
+	-57,
+	128,
+	{ 872287162, 492167115, 810654849, 448046501, 589 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_277 = {
+	39,
+	-57,
+	0,
+	{ 794263716, 979061621, 220548941, 425714062, 267 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_278 = {
+	39,
+	-58,
+	128,
+	{ 785012677, 994732761, 573879622, 850856470, 604 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_279 = {
+	39,
+	-65,
+	0,
+	{ 357365543, 493030760, 525477563, 229418087, 329 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_280 = {
+	39,
+	-42,
+	0,
+	{ 523654682, 279625108, 377671254, 367606892, 344 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_281 = {
+	39,
+	-43,
+	0,
+	{ 58822818, 57843002, 59219337, 179090826, 517 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_282 = {
+	39,
+	-42,
+	128,
+	{ 12326537, 635090580, 422363116, 931610811, 334 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_283 = {
+	39,
+	-42,
+	0,
+	{ 777978463, 722110707, 323702273, 269515476, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_284 = {
+	39,
+	-42,
+	128,
+	{ 789004845, 396824500, 847310235, 765822446, 109 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_285 = {
+	39,
+	-45,
+	128,
+	{ 107623238, 579954588, 844853794, 410090954, 127 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_286 = {
+	39,
+	-43,
+	0,
+	{ 712622009, 715073933, 636441570, 444515115, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_287 = {
+	39,
+	-43,
+	128,
+	{ 892722712, 324442681, 113326614, 634888057, 182 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_288 = {
+	39,
+	-44,
+	0,
+	{ 843382624, 178121070, 505239894, 769494973, 578 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_289 = {
+	39,
+	-48,
+	0,
+	{ 565501623, 813418398, 627039981, 875893393, 493 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_290 = {
+	39,
+	-44,
+	128,
+	{ 633944524, 98566209, 260427338, 953670140, 105 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_291 = {
+	38,
+	-44,
+	0,
+	{ 489076512, 883625400, 104074785, 667143761, 61 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_292 = {
+	39,
+	-45,
+	128,
+	{ 265387865, 669693914, 604619378, 629733590, 175 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_293 = {
+	39,
+	-50,
+	128,
+	{ 835066384, 200245452, 154387070, 744732870, 129 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_294 = {
+	39,
+	-46,
+	0,
+	{ 341930537, 920250428, 896598368, 542360628, 269 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_295 = {
+	39,
+	-46,
+	128,
+	{ 511486759, 807136110, 312709768, 783529087, 145 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_296 = {
+	39,
+	-47,
+	0,
+	{ 832195936, 195968089, 617499807, 764595938, 388 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_297 = {
+	39,
+	-55,
+	128,
+	{ 961492295, 711779714, 941212553, 100225101, 388 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_298 = {
+	39,
+	-48,
+	128,
+	{ 759816728, 812625984, 728672093, 799417387, 532 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_299 = {
+	37,
+	-46,
+	0,
+	{ 876250648, 597938874, 331484512, 743797764, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_300 = {
+	39,
+	-49,
+	128,
+	{ 523246898, 162905110, 56790942, 579609207, 699 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_301 = {
+	39,
+	-55,
+	0,
+	{ 223662468, 132068653, 684809801, 998638748, 258 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_302 = {
+	39,
+	-50,
+	0,
+	{ 647523731, 13794352, 963808841, 668909966, 885 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_303 = {
+	39,
+	-50,
+	128,
+	{ 536053497, 343857276, 131095155, 316881587, 440 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_304 = {
+	38,
+	-49,
+	0,
+	{ 27412406, 727722915, 91653899, 865561947, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_305 = {
+	39,
+	-57,
+	128,
+	{ 245510036, 228786212, 166774760, 679884474, 204 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_306 = {
+	39,
+	-51,
+	128,
+	{ 689967715, 908588254, 929392201, 697944216, 129 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_307 = {
+	39,
+	-52,
+	0,
+	{ 886258877, 418683344, 772821543, 892205914, 627 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_308 = {
+	39,
+	-52,
+	128,
+	{ 117956291, 237923647, 793962746, 129483716, 151 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_309 = {
+	39,
+	-59,
+	0,
+	{ 485709398, 341543637, 973995605, 83454737, 117 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_310 = {
+	39,
+	-53,
+	0,
+	{ 743105191, 821211954, 787317724, 379791801, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_311 = {
+	39,
+	-54,
+	128,
+	{ 626785338, 116240647, 522214824, 349036449, 817 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_312 = {
+	39,
+	-54,
+	0,
+	{ 999400314, 909661709, 847919512, 903050055, 192 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_313 = {
+	39,
+	-62,
+	128,
+	{ 933187164, 662222756, 155528021, 872047946, 587 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_314 = {
+	39,
+	-55,
+	128,
+	{ 559302033, 397041828, 37999584, 201330796, 212 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_315 = {
+	38,
+	-55,
+	0,
+	{ 966347724, 224869452, 277527216, 947514605, 98 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_316 = {
+	39,
+	-56,
+	128,
+	{ 859479342, 250990273, 674932790, 843300693, 229 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_317 = {
+	39,
+	-64,
+	0,
+	{ 14834169, 533487968, 284060608, 997115220, 278 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_318 = {
+	39,
+	-57,
+	0,
+	{ 800408989, 480986641, 808421592, 475718061, 245 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_319 = {
+	39,
+	-57,
+	128,
+	{ 495308297, 100643643, 358937862, 899540130, 112 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_320 = {
+	39,
+	-42,
+	128,
+	{ 622692313, 34919726, 309418922, 623918595, 652 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_321 = {
+	39,
+	-42,
+	0,
+	{ 983445198, 357516764, 87279993, 498720672, 839 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_322 = {
+	39,
+	-42,
+	128,
+	{ 560376679, 87953050, 721005061, 297098541, 438 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_323 = {
+	39,
+	-45,
+	128,
+	{ 72702166, 911097362, 55197136, 909145842, 696 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_324 = {
+	39,
+	-42,
+	0,
+	{ 261010284, 845726623, 675478373, 448466420, 166 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_325 = {
+	39,
+	-42,
+	128,
+	{ 664246668, 344001461, 692185853, 835176797, 127 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_326 = {
+	39,
+	-43,
+	0,
+	{ 489636187, 361032704, 130429061, 995326369, 462 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_327 = {
+	39,
+	-47,
+	0,
+	{ 219615678, 749294232, 270771162, 790986792, 455 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_328 = {
+	38,
+	-42,
+	128,
+	{ 287232758, 823850031, 805195471, 595271125, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_329 = {
+	39,
+	-44,
+	0,
+	{ 269431847, 73740749, 516662273, 334290486, 678 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_330 = {
+	39,
+	-44,
+	128,
+	{ 376444804, 972680229, 588042469, 754766662, 210 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_331 = {
+	39,
+	-49,
+	128,
+	{ 107559679, 181614912, 171449993, 137314328, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_332 = {
+	39,
+	-45,
+	0,
+	{ 544002009, 344937298, 109793380, 358774161, 377 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_333 = {
+	39,
+	-45,
+	128,
+	{ 389071872, 244606114, 228665578, 675067001, 218 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_334 = {
+	39,
+	-46,
+	0,
+	{ 808262909, 22202159, 892690577, 22880401, 622 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_335 = {
+	39,
+	-54,
+	0,
+	{ 434536902, 310025515, 300061341, 770382673, 659 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_336 = {
+	39,
+	-47,
+	128,
+	{ 319968308, 733581658, 568577133, 38649742, 959 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_337 = {
+	39,
+	-47,
+	0,
+	{ 241993936, 735495752, 80776588, 321449228, 521 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_338 = {
+	39,
+	-47,
+	128,
+	{ 224802916, 862702201, 357085552, 915895839, 139 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_339 = {
+	39,
+	-54,
+	0,
+	{ 271670806, 481665704, 57496390, 205899906, 538 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_340 = {
+	39,
+	-48,
+	0,
+	{ 143925785, 533418220, 677452652, 847142754, 194 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_341 = {
+	39,
+	-48,
+	128,
+	{ 922253618, 897109381, 896816518, 272875563, 101 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_342 = {
+	39,
+	-49,
+	0,
+	{ 909656906, 520984790, 549257646, 773471972, 260 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_343 = {
+	39,
+	-56,
+	128,
+	{ 713006867, 343211671, 329921644, 41869999, 509 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_344 = {
+	39,
+	-50,
+	128,
+	{ 140093144, 105493294, 545917919, 214644748, 337 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_345 = {
+	39,
+	-50,
+	0,
+	{ 658799465, 826491187, 85673865, 530891408, 169 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_346 = {
+	39,
+	-51,
+	128,
+	{ 387952882, 482540820, 915423047, 162545861, 423 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_347 = {
+	38,
+	-57,
+	0,
+	{ 307516249, 819065771, 704693480, 823327480, 33 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_348 = {
+	39,
+	-52,
+	0,
+	{ 637951846, 279587997, 121084647, 139369361, 517 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_349 = {
+	39,
+	-52,
+	128,
+	{ 254707385, 699982401, 388461962, 378198832, 253 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_350 = {
+	39,
+	-53,
+	0,
+	{ 645131561, 267442154, 528145411, 289755162, 617 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_351 = {
+	39,
+	-60,
+	128,
+	{ 656320944, 194639877, 530223374, 328930573, 193 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_352 = {
+	39,
+	-54,
+	128,
+	{ 510113656, 906536328, 189032486, 484521102, 721 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_353 = {
+	38,
+	-53,
+	0,
+	{ 830382157, 386423093, 219340828, 631629965, 34 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_354 = {
+	38,
+	-54,
+	128,
+	{ 428248448, 275160257, 294203369, 743587952, 82 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_355 = {
+	39,
+	-62,
+	0,
+	{ 869552966, 257702512, 328278829, 877615265, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_356 = {
+	39,
+	-56,
+	0,
+	{ 154404272, 621566950, 964176454, 807726471, 932 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_357 = {
+	39,
+	-56,
+	128,
+	{ 460294878, 726287771, 667314600, 308205630, 440 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_358 = {
+	39,
+	-56,
+	0,
+	{ 582539551, 333877346, 347546344, 531988997, 103 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_359 = {
+	39,
+	-65,
+	128,
+	{ 229661351, 976247639, 277817169, 420417370, 532 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_360 = {
+	39,
+	-42,
+	128,
+	{ 459604959, 390067179, 746250124, 761290192, 596 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_361 = {
+	39,
+	-43,
+	128,
+	{ 15052063, 571930225, 1055908, 489541602, 720 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_362 = {
+	38,
+	-41,
+	0,
+	{ 67342551, 195116600, 673283616, 823088376, 67 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_363 = {
+	39,
+	-42,
+	128,
+	{ 354778992, 45652582, 275845100, 147526026, 640 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_364 = {
+	39,
+	-42,
+	0,
+	{ 845463037, 374518205, 287044992, 501076343, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_365 = {
+	39,
+	-45,
+	0,
+	{ 325201907, 686554030, 651510461, 970083804, 181 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_366 = {
+	39,
+	-43,
+	128,
+	{ 810085838, 732559632, 850318239, 950711706, 847 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_367 = {
+	38,
+	-42,
+	0,
+	{ 85945806, 470912274, 15310176, 51920825, 61 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_368 = {
+	39,
+	-43,
+	128,
+	{ 773306468, 975255893, 48624082, 739201834, 210 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_369 = {
+	39,
+	-48,
+	128,
+	{ 492545525, 724802750, 559938921, 858901412, 885 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_370 = {
+	39,
+	-44,
+	0,
+	{ 889080403, 975938163, 53771108, 845359538, 452 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_371 = {
+	37,
+	-42,
+	128,
+	{ 931374904, 802726759, 250440793, 842781502, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_372 = {
+	39,
+	-45,
+	0,
+	{ 454562651, 231237189, 464116761, 823417786, 870 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_373 = {
+	38,
+	-49,
+	0,
+	{ 615380235, 144994073, 706965492, 886101871, 36 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_374 = {
+	39,
+	-45,
+	128,
+	{ 960570271, 664265724, 20610378, 446951907, 153 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_375 = {
+	39,
+	-46,
+	0,
+	{ 28959303, 134256585, 69497569, 246677879, 886 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_376 = {
+	39,
+	-46,
+	128,
+	{ 146657779, 156622072, 268173341, 848123018, 251 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_377 = {
+	39,
+	-52,
+	128,
+	{ 811617453, 191516483, 150924314, 259120982, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_378 = {
+	38,
+	-46,
+	0,
+	{ 636016684, 551004392, 154776712, 969470758, 38 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_379 = {
+	39,
+	-47,
+	128,
+	{ 517217613, 970074705, 356347290, 673047922, 212 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_380 = {
+	39,
+	-48,
+	0,
+	{ 408267288, 290959222, 513847345, 701355280, 573 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_381 = {
+	39,
+	-57,
+	128,
+	{ 389357041, 720467599, 971154667, 774985016, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_382 = {
+	39,
+	-49,
+	128,
+	{ 317903772, 800310713, 578658307, 315386946, 809 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_383 = {
+	39,
+	-49,
+	0,
+	{ 606869756, 989805376, 491994901, 827232834, 423 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_384 = {
+	39,
+	-49,
+	128,
+	{ 34401327, 743254191, 77256539, 22245342, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_385 = {
+	39,
+	-57,
+	0,
+	{ 148643005, 869787346, 28343824, 276077068, 233 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_386 = {
+	39,
+	-50,
+	0,
+	{ 260611325, 121206004, 757722132, 799037291, 144 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_387 = {
+	39,
+	-51,
+	128,
+	{ 797442713, 875571329, 314158980, 796778738, 734 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_388 = {
+	38,
+	-50,
+	0,
+	{ 265850394, 83750225, 758748453, 518691673, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_389 = {
+	39,
+	-59,
+	128,
+	{ 237806498, 203644636, 668251401, 875684689, 198 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_390 = {
+	39,
+	-52,
+	128,
+	{ 261558006, 824816757, 104408610, 875054895, 230 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_391 = {
+	39,
+	-52,
+	0,
+	{ 630360358, 584916491, 792546975, 284378993, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_392 = {
+	39,
+	-53,
+	128,
+	{ 398487745, 939025096, 140409836, 328193187, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_393 = {
+	39,
+	-61,
+	0,
+	{ 174215096, 995489837, 463948796, 61557105, 122 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_394 = {
+	39,
+	-54,
+	0,
+	{ 186854092, 78568005, 849268618, 810786357, 335 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_395 = {
+	39,
+	-54,
+	128,
+	{ 933032968, 504313901, 373666510, 914036140, 162 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_396 = {
+	39,
+	-55,
+	0,
+	{ 889643138, 794401570, 31731197, 421554679, 393 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_397 = {
+	39,
+	-64,
+	128,
+	{ 862849707, 680626209, 522929684, 681047857, 651 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_398 = {
+	39,
+	-56,
+	128,
+	{ 92949612, 892073322, 414487799, 134757071, 453 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_399 = {
+	39,
+	-56,
+	0,
+	{ 352030146, 609087198, 265041987, 199273225, 216 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_400 = {
+	39,
+	-41,
+	0,
+	{ 717968262, 694993432, 6563712, 244544948, 133 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_401 = {
+	39,
+	-41,
+	128,
+	{ 852254488, 89885832, 547752650, 443849856, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_402 = {
+	39,
+	-41,
+	0,
+	{ 675220022, 74463292, 966373396, 893691345, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_403 = {
+	39,
+	-45,
+	0,
+	{ 817566488, 295262075, 229896742, 240412264, 993 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_404 = {
+	39,
+	-42,
+	128,
+	{ 956774076, 393025305, 931989848, 745012930, 508 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_405 = {
+	39,
+	-42,
+	0,
+	{ 404439946, 322711600, 928843284, 350566653, 427 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_406 = {
+	39,
+	-42,
+	128,
+	{ 382058793, 552814662, 107988033, 588537679, 168 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_407 = {
+	39,
+	-47,
+	128,
+	{ 345863399, 221463642, 849979643, 18939227, 813 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_408 = {
+	39,
+	-43,
+	0,
+	{ 325308058, 685539839, 621471350, 844023705, 452 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_409 = {
+	38,
+	-42,
+	128,
+	{ 670033116, 705733258, 817340257, 270536747, 31 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_410 = {
+	39,
+	-43,
+	0,
+	{ 728024014, 968988180, 33800826, 498682853, 104 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_411 = {
+	39,
+	-49,
+	0,
+	{ 797422534, 775179359, 809255604, 352262656, 484 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_412 = {
+	39,
+	-44,
+	128,
+	{ 953714104, 840962631, 562579987, 825658734, 214 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_413 = {
+	39,
+	-44,
+	0,
+	{ 223662837, 227364200, 749202446, 936970109, 132 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_414 = {
+	39,
+	-45,
+	128,
+	{ 700014989, 835027511, 10290159, 956930921, 402 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_415 = {
+	39,
+	-51,
+	128,
+	{ 481610252, 107882167, 232906488, 678776663, 175 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_416 = {
+	39,
+	-46,
+	0,
+	{ 173654439, 139111370, 682571156, 450431636, 701 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_417 = {
+	39,
+	-46,
+	128,
+	{ 869791937, 399466433, 948297910, 78773499, 404 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_418 = {
+	39,
+	-46,
+	0,
+	{ 403370469, 133178679, 719634513, 740267433, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_419 = {
+	39,
+	-56,
+	0,
+	{ 717649786, 212981958, 639424802, 427468535, 396 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_420 = {
+	39,
+	-47,
+	128,
+	{ 525595618, 962510578, 927137509, 49382698, 178 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_421 = {
+	39,
+	-48,
+	0,
+	{ 426704819, 1771678, 316464806, 802625487, 974 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_422 = {
+	39,
+	-48,
+	128,
+	{ 360654614, 244697925, 76159825, 53386765, 264 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_423 = {
+	39,
+	-56,
+	0,
+	{ 44526773, 612463486, 376009582, 487516340, 579 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_424 = {
+	38,
+	-48,
+	0,
+	{ 215104423, 487499842, 543836366, 647749553, 37 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_425 = {
+	39,
+	-49,
+	128,
+	{ 921393488, 858528570, 782794385, 395129675, 198 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_426 = {
+	39,
+	-50,
+	0,
+	{ 622702086, 598554219, 813862465, 523365674, 518 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_427 = {
+	39,
+	-58,
+	128,
+	{ 809569362, 798828816, 940524843, 916255826, 574 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_428 = {
+	39,
+	-51,
+	128,
+	{ 963990497, 974510212, 281440335, 625163843, 692 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_429 = {
+	39,
+	-51,
+	0,
+	{ 696722854, 340987467, 80714879, 281574537, 354 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_430 = {
+	39,
+	-52,
+	128,
+	{ 541966489, 259749533, 37422655, 250217500, 900 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_431 = {
+	39,
+	-60,
+	0,
+	{ 652879322, 759344232, 407134943, 871360626, 401 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_432 = {
+	39,
+	-52,
+	0,
+	{ 834098782, 781133293, 456176225, 175667311, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_433 = {
+	39,
+	-53,
+	128,
+	{ 801156016, 348276107, 38569506, 199126287, 570 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_434 = {
+	39,
+	-53,
+	0,
+	{ 610290923, 163244551, 16198236, 631759643, 141 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_435 = {
+	39,
+	-62,
+	128,
+	{ 354261464, 967221024, 524533304, 632562491, 240 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_436 = {
+	39,
+	-54,
+	128,
+	{ 895141291, 148690766, 5729052, 191207657, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_437 = {
+	39,
+	-55,
+	0,
+	{ 353671435, 392468245, 255495740, 177165456, 843 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_438 = {
+	39,
+	-55,
+	128,
+	{ 215313119, 262885913, 845742817, 538114684, 205 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_439 = {
+	38,
+	-63,
+	0,
+	{ 664644892, 679483498, 300989028, 300504248, 13 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_440 = {
+	39,
+	-41,
+	0,
+	{ 733021881, 785631307, 83495908, 972766073, 157 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_441 = {
+	39,
+	-42,
+	0,
+	{ 270998106, 635123980, 915816898, 516262783, 162 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_442 = {
+	39,
+	-41,
+	128,
+	{ 276817104, 284467690, 432762645, 334210355, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_443 = {
+	39,
+	-41,
+	0,
+	{ 693947119, 61922797, 890981541, 896861856, 213 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_444 = {
+	39,
+	-41,
+	128,
+	{ 479375574, 85801712, 630031708, 85593912, 101 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_445 = {
+	39,
+	-45,
+	128,
+	{ 409469875, 234531914, 192009099, 127055299, 399 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_446 = {
+	39,
+	-42,
+	0,
+	{ 293423893, 488306410, 646911649, 350250847, 362 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_447 = {
+	39,
+	-42,
+	128,
+	{ 724999637, 521977097, 121540682, 439014637, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_448 = {
+	38,
+	-41,
+	0,
+	{ 294820535, 611509849, 495887230, 449513336, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_449 = {
+	39,
+	-47,
+	0,
+	{ 522599323, 347488198, 302974787, 114184918, 212 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_450 = {
+	37,
+	-41,
+	128,
+	{ 726520458, 861899121, 194784177, 577941725, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_451 = {
+	39,
+	-43,
+	0,
+	{ 191696699, 927403505, 404625446, 818189560, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_452 = {
+	39,
+	-44,
+	128,
+	{ 490267247, 547608762, 42815669, 137738729, 564 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_453 = {
+	39,
+	-49,
+	128,
+	{ 760837433, 24581112, 761742436, 243201057, 110 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_454 = {
+	39,
+	-44,
+	0,
+	{ 796655503, 449349878, 951746839, 232244188, 112 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_455 = {
+	39,
+	-45,
+	128,
+	{ 551131701, 900398298, 267350240, 933963795, 686 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_456 = {
+	39,
+	-45,
+	0,
+	{ 69885561, 6936398, 148872951, 532369754, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_457 = {
+	39,
+	-52,
+	0,
+	{ 131026401, 13765351, 385069093, 147724098, 467 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_458 = {
+	39,
+	-46,
+	128,
+	{ 13897855, 500739860, 490554075, 98861649, 356 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_459 = {
+	39,
+	-46,
+	0,
+	{ 901118092, 661075996, 59633537, 708553459, 204 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_460 = {
+	39,
+	-47,
+	128,
+	{ 81720575, 751616116, 833575723, 917386332, 580 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_461 = {
+	39,
+	-54,
+	128,
+	{ 790241158, 866601, 286482204, 282128758, 133 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_462 = {
+	39,
+	-48,
+	0,
+	{ 886425003, 950147330, 351329484, 546043913, 903 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_463 = {
+	39,
+	-48,
+	128,
+	{ 840036342, 389115506, 308340355, 987825173, 495 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_464 = {
+	39,
+	-48,
+	0,
+	{ 679841231, 375188461, 997489694, 816071293, 134 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_465 = {
+	39,
+	-59,
+	128,
+	{ 742579139, 123885147, 939510995, 37849865, 167 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_466 = {
+	39,
+	-49,
+	128,
+	{ 633025818, 325859539, 255788736, 935049039, 193 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_467 = {
+	39,
+	-49,
+	0,
+	{ 373574767, 380007101, 199096916, 741656664, 102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_468 = {
+	39,
+	-50,
+	128,
+	{ 245944413, 256898465, 618490205, 75063012, 270 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_469 = {
+	39,
+	-59,
+	0,
+	{ 155645634, 460463401, 859242084, 606961165, 332 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_470 = {
+	39,
+	-51,
+	0,
+	{ 709714633, 191597609, 497796912, 362137253, 365 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_471 = {
+	39,
+	-51,
+	128,
+	{ 989097711, 336371920, 481329288, 165711699, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_472 = {
+	39,
+	-52,
+	0,
+	{ 662937069, 362867905, 38803796, 547981452, 481 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_473 = {
+	39,
+	-61,
+	128,
+	{ 451043025, 792609904, 177226481, 442812281, 299 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_474 = {
+	39,
+	-53,
+	128,
+	{ 39864096, 365322146, 210789564, 888348666, 619 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_475 = {
+	39,
+	-53,
+	0,
+	{ 634891097, 32410752, 819225666, 975551231, 311 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_476 = {
+	38,
+	-53,
+	128,
+	{ 327893911, 788959228, 177163054, 104483500, 78 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_477 = {
+	39,
+	-63,
+	0,
+	{ 253855677, 307627928, 254077890, 809977398, 193 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_478 = {
+	39,
+	-55,
+	0,
+	{ 654017111, 693292016, 600163620, 16002597, 965 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_479 = {
+	39,
+	-55,
+	128,
+	{ 378803359, 575475929, 917605316, 446065885, 476 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_480 = {
+	39,
+	-41,
+	128,
+	{ 544600939, 281097914, 401664727, 251211951, 407 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_481 = {
+	38,
+	-40,
+	0,
+	{ 657958304, 236380902, 80697948, 33628338, 64 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_482 = {
+	39,
+	-41,
+	128,
+	{ 94878596, 974858518, 766177473, 101610816, 404 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_483 = {
+	38,
+	-43,
+	128,
+	{ 84721157, 214447938, 662329817, 837328028, 21 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_484 = {
+	37,
+	-39,
+	0,
+	{ 477993252, 906842136, 125463862, 174044180, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_485 = {
+	39,
+	-41,
+	128,
+	{ 667626075, 528126987, 188915373, 4405184, 197 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_486 = {
+	39,
+	-42,
+	0,
+	{ 55943762, 244376612, 624577672, 954697479, 835 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_487 = {
+	39,
+	-46,
+	0,
+	{ 391190633, 728823659, 96547896, 454475671, 194 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_488 = {
+	39,
+	-42,
+	128,
+	{ 419748589, 353873185, 216963473, 793871204, 257 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_489 = {
+	39,
+	-42,
+	0,
+	{ 533029229, 989812339, 393035128, 99873681, 190 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_490 = {
+	39,
+	-43,
+	128,
+	{ 872922624, 64766329, 389648177, 964999374, 676 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_491 = {
+	39,
+	-48,
+	128,
+	{ 392079046, 423886418, 265723971, 406296664, 144 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_492 = {
+	39,
+	-43,
+	0,
+	{ 274021252, 665363042, 422690233, 125125187, 157 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_493 = {
+	39,
+	-43,
+	128,
+	{ 972644528, 641796449, 768931500, 40087447, 103 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_494 = {
+	39,
+	-44,
+	0,
+	{ 919075457, 499713337, 138704970, 451776740, 330 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_495 = {
+	39,
+	-51,
+	0,
+	{ 655244381, 213317704, 257109089, 297602423, 798 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_496 = {
+	39,
+	-45,
+	128,
+	{ 775987582, 920252613, 130036068, 977941493, 640 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_497 = {
+	39,
+	-45,
+	0,
+	{ 286200672, 672427407, 557266, 946247613, 388 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_498 = {
+	39,
+	-45,
+	128,
+	{ 695464507, 94102455, 488693227, 183476449, 116 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_499 = {
+	39,
+	-53,
+	128,
+	{ 474486429, 530268220, 644225168, 680863059, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_500 = {
+	39,
+	-46,
+	0,
+	{ 187985899, 177191295, 970928089, 780129112, 198 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_501 = {
+	39,
+	-46,
+	128,
+	{ 279801256, 868653928, 575106771, 77199563, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_502 = {
+	39,
+	-47,
+	0,
+	{ 690959603, 775020804, 855545220, 558570641, 323 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_503 = {
+	39,
+	-58,
+	0,
+	{ 356447847, 809712869, 848777487, 594624664, 417 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_504 = {
+	39,
+	-48,
+	128,
+	{ 688872217, 631396275, 58243211, 231127181, 504 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_505 = {
+	39,
+	-48,
+	0,
+	{ 827462396, 537590132, 707170801, 402472861, 277 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_506 = {
+	39,
+	-49,
+	128,
+	{ 130308138, 757723877, 813770072, 210176166, 756 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_507 = {
+	39,
+	-58,
+	0,
+	{ 54009656, 668741494, 409911248, 447643453, 960 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_508 = {
+	39,
+	-49,
+	0,
+	{ 750005675, 742113645, 56161376, 608641157, 109 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_509 = {
+	39,
+	-50,
+	128,
+	{ 972034805, 78708506, 871261326, 313706190, 583 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_510 = {
+	39,
+	-50,
+	0,
+	{ 815372271, 957025399, 889760020, 95354048, 154 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_511 = {
+	39,
+	-60,
+	128,
+	{ 470778141, 570230992, 434821695, 59528308, 986 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_512 = {
+	39,
+	-51,
+	128,
+	{ 26428967, 600786458, 185535899, 762038535, 210 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_513 = {
+	39,
+	-51,
+	0,
+	{ 202966789, 248487700, 529156582, 191442926, 109 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_514 = {
+	39,
+	-52,
+	128,
+	{ 676749587, 52244536, 291505719, 176140591, 281 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_515 = {
+	39,
+	-62,
+	0,
+	{ 215199678, 321254992, 383608566, 992950911, 715 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_516 = {
+	39,
+	-53,
+	0,
+	{ 127170713, 411393274, 291428228, 706080980, 366 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_517 = {
+	38,
+	-52,
+	128,
+	{ 656697475, 72514044, 274971488, 581396569, 18 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_518 = {
+	39,
+	-54,
+	0,
+	{ 79760129, 96432338, 262398354, 440554488, 468 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_519 = {
+	39,
+	-64,
+	128,
+	{ 623419191, 145225253, 363369185, 761748860, 444 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_520 = {
+	39,
+	-41,
+	128,
+	{ 663229512, 828447360, 930028453, 757793839, 594 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_521 = {
+	39,
+	-42,
+	128,
+	{ 241735547, 467508570, 604515180, 164767892, 540 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_522 = {
+	38,
+	-40,
+	0,
+	{ 122070203, 580891102, 767898189, 910413550, 87 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_523 = {
+	39,
+	-41,
+	128,
+	{ 933708595, 411889346, 561251612, 763155878, 985 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_524 = {
+	39,
+	-41,
+	0,
+	{ 42532894, 83005576, 215379062, 346950310, 501 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_525 = {
+	39,
+	-44,
+	0,
+	{ 30019716, 886976317, 218746711, 75217862, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_526 = {
+	39,
+	-41,
+	128,
+	{ 23691467, 823500814, 546833838, 260193427, 206 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_527 = {
+	39,
+	-41,
+	0,
+	{ 230877348, 120144552, 230580562, 91285735, 171 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_528 = {
+	39,
+	-42,
+	128,
+	{ 448178821, 752555830, 337986695, 953127141, 676 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_529 = {
+	39,
+	-47,
+	128,
+	{ 387742963, 249953893, 621331890, 115456765, 690 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_530 = {
+	39,
+	-42,
+	0,
+	{ 767817881, 92496258, 959016301, 551281439, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_531 = {
+	39,
+	-42,
+	128,
+	{ 87939941, 756577948, 919685395, 952156634, 133 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_532 = {
+	39,
+	-43,
+	0,
+	{ 811166748, 737727079, 280386834, 631830335, 462 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_533 = {
+	39,
+	-49,
+	0,
+	{ 223377663, 750259343, 213515216, 342306133, 400 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_534 = {
+	38,
+	-42,
+	128,
+	{ 607804379, 769655572, 494032550, 255652921, 10 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_535 = {
+	39,
+	-44,
+	0,
+	{ 178432438, 128636247, 765103534, 208637279, 661 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_536 = {
+	39,
+	-44,
+	128,
+	{ 775184325, 557168255, 530081831, 130220272, 209 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_537 = {
+	39,
+	-51,
+	128,
+	{ 720126716, 596682443, 38206149, 517756496, 209 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_538 = {
+	39,
+	-45,
+	0,
+	{ 653301219, 40029831, 932465140, 560290419, 397 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_539 = {
+	39,
+	-45,
+	128,
+	{ 797211261, 739958142, 158873681, 562119788, 239 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_540 = {
+	39,
+	-46,
+	0,
+	{ 363382579, 788880766, 458640627, 828833821, 711 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_541 = {
+	39,
+	-54,
+	0,
+	{ 96856434, 997681738, 325164819, 557487171, 892 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_542 = {
+	39,
+	-46,
+	128,
+	{ 518106018, 868105745, 646763077, 15472350, 121 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_543 = {
+	39,
+	-47,
+	0,
+	{ 271629677, 565047934, 343904185, 506182483, 693 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_544 = {
+	39,
+	-47,
+	128,
+	{ 586643103, 922871050, 560892751, 614644538, 196 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_545 = {
+	39,
+	-56,
+	128,
+	{ 394582607, 140560203, 420676037, 320863732, 259 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_546 = {
+	39,
+	-48,
+	0,
+	{ 862872953, 54197530, 754874970, 904196297, 306 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_547 = {
+	39,
+	-48,
+	128,
+	{ 503260038, 535266267, 556650842, 160974811, 169 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_548 = {
+	39,
+	-49,
+	0,
+	{ 38693679, 401149382, 312124434, 286061398, 462 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_549 = {
+	38,
+	-60,
+	128,
+	{ 626279409, 401757339, 495189573, 567416853, 23 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_550 = {
+	39,
+	-50,
+	128,
+	{ 611609229, 522943290, 663948148, 438523933, 674 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_551 = {
+	39,
+	-50,
+	0,
+	{ 458540216, 626080728, 827407672, 331761665, 360 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_552 = {
+	39,
+	-51,
+	128,
+	{ 762141694, 776898414, 126019609, 998877564, 955 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_553 = {
+	39,
+	-61,
+	0,
+	{ 616732455, 126690624, 591280840, 528839305, 690 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_554 = {
+	39,
+	-51,
+	0,
+	{ 556187349, 107120699, 730539577, 14189189, 132 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_555 = {
+	39,
+	-52,
+	128,
+	{ 361625712, 579902188, 523719837, 511673067, 687 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_556 = {
+	39,
+	-52,
+	0,
+	{ 598057004, 671579301, 760044854, 7410678, 178 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_557 = {
+	39,
+	-63,
+	128,
+	{ 402177521, 436127656, 277580141, 821560200, 647 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_558 = {
+	39,
+	-53,
+	128,
+	{ 17504356, 800649839, 428458751, 847083754, 234 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_559 = {
+	39,
+	-53,
+	0,
+	{ 573466065, 444541956, 38676782, 719716734, 119 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_560 = {
+	39,
+	-40,
+	0,
+	{ 676667954, 893557175, 227114661, 20277875, 174 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_561 = {
+	39,
+	-40,
+	128,
+	{ 938244466, 406510546, 991205054, 278809456, 295 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_562 = {
+	39,
+	-40,
+	0,
+	{ 369569938, 954614451, 27987992, 458755714, 200 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_563 = {
+	39,
+	-44,
+	0,
+	{ 965114268, 581583965, 34070964, 895159669, 702 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_564 = {
+	39,
+	-40,
+	128,
+	{ 532132899, 677943636, 431477359, 754210713, 123 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_565 = {
+	39,
+	-40,
+	0,
+	{ 269288223, 495288365, 352544870, 762934442, 119 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_566 = {
+	39,
+	-41,
+	128,
+	{ 711785299, 584092606, 185252752, 560384665, 541 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_567 = {
+	39,
+	-46,
+	128,
+	{ 278258997, 141217452, 186160559, 908933964, 632 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_568 = {
+	39,
+	-41,
+	0,
+	{ 20555435, 734071254, 50645360, 551181290, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_569 = {
+	39,
+	-41,
+	128,
+	{ 146148383, 699596600, 500096356, 347327482, 147 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_570 = {
+	39,
+	-42,
+	0,
+	{ 109204964, 879024307, 83867307, 158100977, 555 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_571 = {
+	39,
+	-48,
+	0,
+	{ 237879304, 900879012, 506625009, 68344125, 524 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_572 = {
+	39,
+	-42,
+	128,
+	{ 323474832, 551164855, 848355448, 579135357, 143 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_573 = {
+	39,
+	-43,
+	0,
+	{ 802008524, 309352990, 432967252, 812932249, 991 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_574 = {
+	39,
+	-43,
+	128,
+	{ 145818778, 280382915, 783109340, 608347494, 334 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_575 = {
+	39,
+	-50,
+	128,
+	{ 240444834, 707242852, 989652948, 558372910, 357 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_576 = {
+	39,
+	-44,
+	0,
+	{ 323983162, 305048876, 300761638, 608519606, 715 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_577 = {
+	39,
+	-44,
+	128,
+	{ 653553524, 754832310, 555260195, 168026281, 455 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_578 = {
+	39,
+	-44,
+	0,
+	{ 49836331, 192607079, 714747152, 365766492, 142 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_579 = {
+	39,
+	-52,
+	0,
+	{ 335349504, 924512903, 752365822, 31490792, 188 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_580 = {
+	39,
+	-45,
+	128,
+	{ 778464938, 945908653, 292106768, 234038989, 266 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_581 = {
+	39,
+	-45,
+	0,
+	{ 643757047, 551296082, 957164856, 506421895, 159 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_582 = {
+	39,
+	-46,
+	128,
+	{ 585671643, 375888835, 410699703, 875146738, 471 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_583 = {
+	39,
+	-55,
+	128,
+	{ 762176328, 331357107, 169466380, 78126482, 651 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_584 = {
+	39,
+	-47,
+	0,
+	{ 801096303, 490154355, 467772703, 950910267, 797 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_585 = {
+	39,
+	-47,
+	128,
+	{ 959103252, 319628760, 452197618, 734631947, 456 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_586 = {
+	39,
+	-47,
+	0,
+	{ 733356482, 128296202, 602505602, 440097182, 129 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_587 = {
+	39,
+	-60,
+	0,
+	{ 162102861, 650962849, 360497628, 455088751, 683 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_588 = {
+	39,
+	-48,
+	128,
+	{ 182894266, 302993204, 786311353, 331557173, 202 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_589 = {
+	39,
+	-48,
+	0,
+	{ 322402077, 658678876, 829890422, 702846113, 111 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_590 = {
+	39,
+	-49,
+	128,
+	{ 11677796, 677383213, 281200098, 919640815, 305 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_591 = {
+	37,
+	-57,
+	0,
+	{ 560165316, 938676587, 446340939, 271759453, 2 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_592 = {
+	39,
+	-50,
+	0,
+	{ 537449436, 62042914, 319301920, 848243241, 448 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_593 = {
+	39,
+	-50,
+	128,
+	{ 700871992, 839332890, 101856268, 629085572, 240 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_594 = {
+	39,
+	-51,
+	0,
+	{ 617702261, 743134079, 429683533, 826678440, 640 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_595 = {
+	39,
+	-61,
+	128,
+	{ 791678324, 188107791, 726356732, 327045843, 239 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_596 = {
+	39,
+	-52,
+	128,
+	{ 176912863, 749279900, 569106446, 418918264, 892 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_597 = {
+	39,
+	-52,
+	0,
+	{ 303701614, 569398101, 834096675, 906895261, 466 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_598 = {
+	39,
+	-52,
+	128,
+	{ 483176009, 594629185, 253054216, 475491319, 121 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_599 = {
+	39,
+	-63,
+	0,
+	{ 643064079, 245395982, 408968840, 5886168, 179 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_600 = {
+	39,
+	-40,
+	0,
+	{ 759725054, 440392053, 58907634, 491241609, 302 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_601 = {
+	39,
+	-41,
+	0,
+	{ 346432398, 565836874, 499773091, 174360026, 248 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_602 = {
+	39,
+	-40,
+	128,
+	{ 749838921, 665945072, 570223587, 391343734, 499 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_603 = {
+	39,
+	-40,
+	0,
+	{ 738730749, 363486398, 78686395, 156430093, 599 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_604 = {
+	38,
+	-39,
+	128,
+	{ 577418291, 657535626, 623390607, 483207601, 32 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_605 = {
+	39,
+	-44,
+	128,
+	{ 306802985, 908724805, 34408586, 129686521, 572 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_606 = {
+	39,
+	-40,
+	0,
+	{ 688987489, 695601369, 693543574, 852517785, 150 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_607 = {
+	39,
+	-40,
+	128,
+	{ 722922425, 643686220, 884449863, 613240050, 132 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_608 = {
+	39,
+	-41,
+	0,
+	{ 289702233, 925413588, 261475611, 152626324, 555 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_609 = {
+	39,
+	-46,
+	0,
+	{ 443117139, 736670418, 300156163, 631822570, 302 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_610 = {
+	39,
+	-41,
+	128,
+	{ 990717909, 278074558, 567231886, 295484067, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_611 = {
+	39,
+	-41,
+	0,
+	{ 683215395, 344053430, 296368817, 935700999, 128 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_612 = {
+	39,
+	-42,
+	128,
+	{ 498458773, 197741737, 198756618, 451383483, 468 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_613 = {
+	39,
+	-48,
+	128,
+	{ 27126103, 958942407, 304455106, 25993789, 183 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_614 = {
+	39,
+	-42,
+	0,
+	{ 391593467, 81126763, 226540993, 497390148, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_615 = {
+	39,
+	-43,
+	128,
+	{ 749743111, 226124850, 444769415, 785652212, 773 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_616 = {
+	39,
+	-43,
+	0,
+	{ 175469869, 34396578, 852009729, 258362469, 256 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_617 = {
+	39,
+	-50,
+	0,
+	{ 867447967, 184204332, 580729876, 661653326, 107 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_618 = {
+	39,
+	-44,
+	128,
+	{ 842303394, 909766286, 226207293, 468092824, 532 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_619 = {
+	39,
+	-44,
+	0,
+	{ 662256239, 158500868, 446423998, 963486306, 334 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_620 = {
+	39,
+	-44,
+	128,
+	{ 368742621, 159096014, 840112042, 812531286, 103 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_621 = {
+	39,
+	-53,
+	128,
+	{ 153042038, 167557347, 874872223, 890853347, 560 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_622 = {
+	39,
+	-45,
+	0,
+	{ 854842619, 501671319, 767212581, 508219306, 191 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_623 = {
+	39,
+	-45,
+	128,
+	{ 954209218, 394718890, 37757645, 183658002, 114 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_624 = {
+	39,
+	-46,
+	0,
+	{ 488277774, 856876080, 523297404, 544252091, 336 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_625 = {
+	39,
+	-55,
+	0,
+	{ 802431978, 165762168, 306384270, 346229306, 239 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_626 = {
+	39,
+	-47,
+	128,
+	{ 628904125, 650575259, 477006468, 528360574, 566 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_627 = {
+	39,
+	-47,
+	0,
+	{ 884227654, 690846574, 578839497, 938253737, 323 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_628 = {
+	38,
+	-47,
+	128,
+	{ 758148209, 628496711, 75303507, 775892210, 91 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_629 = {
+	39,
+	-58,
+	128,
+	{ 651247961, 989742143, 365691380, 245430568, 704 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_630 = {
+	39,
+	-48,
+	0,
+	{ 253615822, 333900410, 861640569, 631437865, 143 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_631 = {
+	39,
+	-49,
+	128,
+	{ 603279695, 466223762, 754838242, 75982391, 794 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_632 = {
+	39,
+	-49,
+	0,
+	{ 598017666, 549496297, 167432281, 881070649, 217 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_633 = {
+	39,
+	-63,
+	128,
+	{ 439115005, 115796342, 604513793, 292602409, 486 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_634 = {
+	39,
+	-50,
+	128,
+	{ 518513391, 29719519, 226309972, 270810592, 321 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_635 = {
+	39,
+	-50,
+	0,
+	{ 756144566, 549174366, 79197300, 755551247, 172 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_636 = {
+	39,
+	-51,
+	128,
+	{ 237826918, 839917988, 812675854, 606867000, 461 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_637 = {
+	39,
+	-62,
+	0,
+	{ 369835644, 890023499, 813648882, 989354690, 196 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_638 = {
+	39,
+	-52,
+	0,
+	{ 509723271, 393716883, 145061766, 669734376, 647 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[5];
+} const_igamma_temme_639 = {
+	39,
+	-52,
+	128,
+	{ 829522216, 47331003, 733271017, 250522489, 340 }
+};
+
+const decNumber *const const_igamma_temme[640] = {
+	(const decNumber *) &const_igamma_temme_0,
+	(const decNumber *) &const_igamma_temme_1,
+	(const decNumber *) &const_igamma_temme_2,
+	(const decNumber *) &const_igamma_temme_3,
+	(const decNumber *) &const_igamma_temme_4,
+	(const decNumber *) &const_igamma_temme_5,
+	(const decNumber *) &const_igamma_temme_6,
+	(const decNumber *) &const_igamma_temme_7,
+	(const decNumber *) &const_igamma_temme_8,
+	(const decNumber *) &const_igamma_temme_9,
+	(const decNumber *) &const_igamma_temme_10,
+	(const decNumber *) &const_igamma_temme_11,
+	(const decNumber *) &const_igamma_temme_12,
+	(const decNumber *) &const_igamma_temme_13,
+	(const decNumber *) &const_igamma_temme_14,
+	(const decNumber *) &const_igamma_temme_15,
+	(const decNumber *) &const_igamma_temme_16,
+	(const decNumber *) &const_igamma_temme_17,
+	(const decNumber *) &const_igamma_temme_18,
+	(const decNumber *) &const_igamma_temme_19,
+	(const decNumber *) &const_igamma_temme_20,
+	(const decNumber *) &const_igamma_temme_21,
+	(const decNumber *) &const_igamma_temme_22,
+	(const decNumber *) &const_igamma_temme_23,
+	(const decNumber *) &const_igamma_temme_24,
+	(const decNumber *) &const_igamma_temme_25,
+	(const decNumber *) &const_igamma_temme_26,
+	(const decNumber *) &const_igamma_temme_27,
+	(const decNumber *) &const_igamma_temme_28,
+	(const decNumber *) &const_igamma_temme_29,
+	(const decNumber *) &const_igamma_temme_30,
+	(const decNumber *) &const_igamma_temme_31,
+	(const decNumber *) &const_igamma_temme_32,
+	(const decNumber *) &const_igamma_temme_33,
+	(const decNumber *) &const_igamma_temme_34,
+	(const decNumber *) &const_igamma_temme_35,
+	(const decNumber *) &const_igamma_temme_36,
+	(const decNumber *) &const_igamma_temme_37,
+	(const decNumber *) &const_igamma_temme_38,
+	(const decNumber *) &const_igamma_temme_39,
+	(const decNumber *) &const_igamma_temme_40,
+	(const decNumber *) &const_igamma_temme_41,
+	(const decNumber *) &const_igamma_temme_42,
+	(const decNumber *) &const_igamma_temme_43,
+	(const decNumber *) &const_igamma_temme_44,
+	(const decNumber *) &const_igamma_temme_45,
+	(const decNumber *) &const_igamma_temme_46,
+	(const decNumber *) &const_igamma_temme_47,
+	(const decNumber *) &const_igamma_temme_48,
+	(const decNumber *) &const_igamma_temme_49,
+	(const decNumber *) &const_igamma_temme_50,
+	(const decNumber *) &const_igamma_temme_51,
+	(const decNumber *) &const_igamma_temme_52,
+	(const decNumber *) &const_igamma_temme_53,
+	(const decNumber *) &const_igamma_temme_54,
+	(const decNumber *) &const_igamma_temme_55,
+	(const decNumber *) &const_igamma_temme_56,
+	(const decNumber *) &const_igamma_temme_57,
+	(const decNumber *) &const_igamma_temme_58,
+	(const decNumber *) &const_igamma_temme_59,
+	(const decNumber *) &const_igamma_temme_60,
+	(const decNumber *) &const_igamma_temme_61,
+	(const decNumber *) &const_igamma_temme_62,
+	(const decNumber *) &const_igamma_temme_63,
+	(const decNumber *) &const_igamma_temme_64,
+	(const decNumber *) &const_igamma_temme_65,
+	(const decNumber *) &const_igamma_temme_66,
+	(const decNumber *) &const_igamma_temme_67,
+	(const decNumber *) &const_igamma_temme_68,
+	(const decNumber *) &const_igamma_temme_69,
+	(const decNumber *) &const_igamma_temme_70,
+	(const decNumber *) &const_igamma_temme_71,
+	(const decNumber *) &const_igamma_temme_72,
+	(const decNumber *) &const_igamma_temme_73,
+	(const decNumber *) &const_igamma_temme_74,
+	(const decNumber *) &const_igamma_temme_75,
+	(const decNumber *) &const_igamma_temme_76,
+	(const decNumber *) &const_igamma_temme_77,
+	(const decNumber *) &const_igamma_temme_78,
+	(const decNumber *) &const_igamma_temme_79,
+	(const decNumber *) &const_igamma_temme_80,
+	(const decNumber *) &const_igamma_temme_81,
+	(const decNumber *) &const_igamma_temme_82,
+	(const decNumber *) &const_igamma_temme_83,
+	(const decNumber *) &const_igamma_temme_84,
+	(const decNumber *) &const_igamma_temme_85,
+	(const decNumber *) &const_igamma_temme_86,
+	(const decNumber *) &const_igamma_temme_87,
+	(const decNumber *) &const_igamma_temme_88,
+	(const decNumber *) &const_igamma_temme_89,
+	(const decNumber *) &const_igamma_temme_90,
+	(const decNumber *) &const_igamma_temme_91,
+	(const decNumber *) &const_igamma_temme_92,
+	(const decNumber *) &const_igamma_temme_93,
+	(const decNumber *) &const_igamma_temme_94,
+	(const decNumber *) &const_igamma_temme_95,
+	(const decNumber *) &const_igamma_temme_96,
+	(const decNumber *) &const_igamma_temme_97,
+	(const decNumber *) &const_igamma_temme_98,
+	(const decNumber *) &const_igamma_temme_99,
+	(const decNumber *) &const_igamma_temme_100,
+	(const decNumber *) &const_igamma_temme_101,
+	(const decNumber *) &const_igamma_temme_102,
+	(const decNumber *) &const_igamma_temme_103,
+	(const decNumber *) &const_igamma_temme_104,
+	(const decNumber *) &const_igamma_temme_105,
+	(const decNumber *) &const_igamma_temme_106,
+	(const decNumber *) &const_igamma_temme_107,
+	(const decNumber *) &const_igamma_temme_108,
+	(const decNumber *) &const_igamma_temme_109,
+	(const decNumber *) &const_igamma_temme_110,
+	(const decNumber *) &const_igamma_temme_111,
+	(const decNumber *) &const_igamma_temme_112,
+	(const decNumber *) &const_igamma_temme_113,
+	(const decNumber *) &const_igamma_temme_114,
+	(const decNumber *) &const_igamma_temme_115,
+	(const decNumber *) &const_igamma_temme_116,
+	(const decNumber *) &const_igamma_temme_117,
+	(const decNumber *) &const_igamma_temme_118,
+	(const decNumber *) &const_igamma_temme_119,
+	(const decNumber *) &const_igamma_temme_120,
+	(const decNumber *) &const_igamma_temme_121,
+	(const decNumber *) &const_igamma_temme_122,
+	(const decNumber *) &const_igamma_temme_123,
+	(const decNumber *) &const_igamma_temme_124,
+	(const decNumber *) &const_igamma_temme_125,
+	(const decNumber *) &const_igamma_temme_126,
+	(const decNumber *) &const_igamma_temme_127,
+	(const decNumber *) &const_igamma_temme_128,
+	(const decNumber *) &const_igamma_temme_129,
+	(const decNumber *) &const_igamma_temme_130,
+	(const decNumber *) &const_igamma_temme_131,
+	(const decNumber *) &const_igamma_temme_132,
+	(const decNumber *) &const_igamma_temme_133,
+	(const decNumber *) &const_igamma_temme_134,
+	(const decNumber *) &const_igamma_temme_135,
+	(const decNumber *) &const_igamma_temme_136,
+	(const decNumber *) &const_igamma_temme_137,
+	(const decNumber *) &const_igamma_temme_138,
+	(const decNumber *) &const_igamma_temme_139,
+	(const decNumber *) &const_igamma_temme_140,
+	(const decNumber *) &const_igamma_temme_141,
+	(const decNumber *) &const_igamma_temme_142,
+	(const decNumber *) &const_igamma_temme_143,
+	(const decNumber *) &const_igamma_temme_144,
+	(const decNumber *) &const_igamma_temme_145,
+	(const decNumber *) &const_igamma_temme_146,
+	(const decNumber *) &const_igamma_temme_147,
+	(const decNumber *) &const_igamma_temme_148,
+	(const decNumber *) &const_igamma_temme_149,
+	(const decNumber *) &const_igamma_temme_150,
+	(const decNumber *) &const_igamma_temme_151,
+	(const decNumber *) &const_igamma_temme_152,
+	(const decNumber *) &const_igamma_temme_153,
+	(const decNumber *) &const_igamma_temme_154,
+	(const decNumber *) &const_igamma_temme_155,
+	(const decNumber *) &const_igamma_temme_156,
+	(const decNumber *) &const_igamma_temme_157,
+	(const decNumber *) &const_igamma_temme_158,
+	(const decNumber *) &const_igamma_temme_159,
+	(const decNumber *) &const_igamma_temme_160,
+	(const decNumber *) &const_igamma_temme_161,
+	(const decNumber *) &const_igamma_temme_162,
+	(const decNumber *) &const_igamma_temme_163,
+	(const decNumber *) &const_igamma_temme_164,
+	(const decNumber *) &const_igamma_temme_165,
+	(const decNumber *) &const_igamma_temme_166,
+	(const decNumber *) &const_igamma_temme_167,
+	(const decNumber *) &const_igamma_temme_168,
+	(const decNumber *) &const_igamma_temme_169,
+	(const decNumber *) &const_igamma_temme_170,
+	(const decNumber *) &const_igamma_temme_171,
+	(const decNumber *) &const_igamma_temme_172,
+	(const decNumber *) &const_igamma_temme_173,
+	(const decNumber *) &const_igamma_temme_174,
+	(const decNumber *) &const_igamma_temme_175,
+	(const decNumber *) &const_igamma_temme_176,
+	(const decNumber *) &const_igamma_temme_177,
+	(const decNumber *) &const_igamma_temme_178,
+	(const decNumber *) &const_igamma_temme_179,
+	(const decNumber *) &const_igamma_temme_180,
+	(const decNumber *) &const_igamma_temme_181,
+	(const decNumber *) &const_igamma_temme_182,
+	(const decNumber *) &const_igamma_temme_183,
+	(const decNumber *) &const_igamma_temme_184,
+	(const decNumber *) &const_igamma_temme_185,
+	(const decNumber *) &const_igamma_temme_186,
+	(const decNumber *) &const_igamma_temme_187,
+	(const decNumber *) &const_igamma_temme_188,
+	(const decNumber *) &const_igamma_temme_189,
+	(const decNumber *) &const_igamma_temme_190,
+	(const decNumber *) &const_igamma_temme_191,
+	(const decNumber *) &const_igamma_temme_192,
+	(const decNumber *) &const_igamma_temme_193,
+	(const decNumber *) &const_igamma_temme_194,
+	(const decNumber *) &const_igamma_temme_195,
+	(const decNumber *) &const_igamma_temme_196,
+	(const decNumber *) &const_igamma_temme_197,
+	(const decNumber *) &const_igamma_temme_198,
+	(const decNumber *) &const_igamma_temme_199,
+	(const decNumber *) &const_igamma_temme_200,
+	(const decNumber *) &const_igamma_temme_201,
+	(const decNumber *) &const_igamma_temme_202,
+	(const decNumber *) &const_igamma_temme_203,
+	(const decNumber *) &const_igamma_temme_204,
+	(const decNumber *) &const_igamma_temme_205,
+	(const decNumber *) &const_igamma_temme_206,
+	(const decNumber *) &const_igamma_temme_207,
+	(const decNumber *) &const_igamma_temme_208,
+	(const decNumber *) &const_igamma_temme_209,
+	(const decNumber *) &const_igamma_temme_210,
+	(const decNumber *) &const_igamma_temme_211,
+	(const decNumber *) &const_igamma_temme_212,
+	(const decNumber *) &const_igamma_temme_213,
+	(const decNumber *) &const_igamma_temme_214,
+	(const decNumber *) &const_igamma_temme_215,
+	(const decNumber *) &const_igamma_temme_216,
+	(const decNumber *) &const_igamma_temme_217,
+	(const decNumber *) &const_igamma_temme_218,
+	(const decNumber *) &const_igamma_temme_219,
+	(const decNumber *) &const_igamma_temme_220,
+	(const decNumber *) &const_igamma_temme_221,
+	(const decNumber *) &const_igamma_temme_222,
+	(const decNumber *) &const_igamma_temme_223,
+	(const decNumber *) &const_igamma_temme_224,
+	(const decNumber *) &const_igamma_temme_225,
+	(const decNumber *) &const_igamma_temme_226,
+	(const decNumber *) &const_igamma_temme_227,
+	(const decNumber *) &const_igamma_temme_228,
+	(const decNumber *) &const_igamma_temme_229,
+	(const decNumber *) &const_igamma_temme_230,
+	(const decNumber *) &const_igamma_temme_231,
+	(const decNumber *) &const_igamma_temme_232,
+	(const decNumber *) &const_igamma_temme_233,
+	(const decNumber *) &const_igamma_temme_234,
+	(const decNumber *) &const_igamma_temme_235,
+	(const decNumber *) &const_igamma_temme_236,
+	(const decNumber *) &const_igamma_temme_237,
+	(const decNumber *) &const_igamma_temme_238,
+	(const decNumber *) &const_igamma_temme_239,
+	(const decNumber *) &const_igamma_temme_240,
+	(const decNumber *) &const_igamma_temme_241,
+	(const decNumber *) &const_igamma_temme_242,
+	(const decNumber *) &const_igamma_temme_243,
+	(const decNumber *) &const_igamma_temme_244,
+	(const decNumber *) &const_igamma_temme_245,
+	(const decNumber *) &const_igamma_temme_246,
+	(const decNumber *) &const_igamma_temme_247,
+	(const decNumber *) &const_igamma_temme_248,
+	(const decNumber *) &const_igamma_temme_249,
+	(const decNumber *) &const_igamma_temme_250,
+	(const decNumber *) &const_igamma_temme_251,
+	(const decNumber *) &const_igamma_temme_252,
+	(const decNumber *) &const_igamma_temme_253,
+	(const decNumber *) &const_igamma_temme_254,
+	(const decNumber *) &const_igamma_temme_255,
+	(const decNumber *) &const_igamma_temme_256,
+	(const decNumber *) &const_igamma_temme_257,
+	(const decNumber *) &const_igamma_temme_258,
+	(const decNumber *) &const_igamma_temme_259,
+	(const decNumber *) &const_igamma_temme_260,
+	(const decNumber *) &const_igamma_temme_261,
+	(const decNumber *) &const_igamma_temme_262,
+	(const decNumber *) &const_igamma_temme_263,
+	(const decNumber *) &const_igamma_temme_264,
+	(const decNumber *) &const_igamma_temme_265,
+	(const decNumber *) &const_igamma_temme_266,
+	(const decNumber *) &const_igamma_temme_267,
+	(const decNumber *) &const_igamma_temme_268,
+	(const decNumber *) &const_igamma_temme_269,
+	(const decNumber *) &const_igamma_temme_270,
+	(const decNumber *) &const_igamma_temme_271,
+	(const decNumber *) &const_igamma_temme_272,
+	(const decNumber *) &const_igamma_temme_273,
+	(const decNumber *) &const_igamma_temme_274,
+	(const decNumber *) &const_igamma_temme_275,
+	(const decNumber *) &const_igamma_temme_276,
+	(const decNumber *) &const_igamma_temme_277,
+	(const decNumber *) &const_igamma_temme_278,
+	(const decNumber *) &const_igamma_temme_279,
+	(const decNumber *) &const_igamma_temme_280,
+	(const decNumber *) &const_igamma_temme_281,
+	(const decNumber *) &const_igamma_temme_282,
+	(const decNumber *) &const_igamma_temme_283,
+	(const decNumber *) &const_igamma_temme_284,
+	(const decNumber *) &const_igamma_temme_285,
+	(const decNumber *) &const_igamma_temme_286,
+	(const decNumber *) &const_igamma_temme_287,
+	(const decNumber *) &const_igamma_temme_288,
+	(const decNumber *) &const_igamma_temme_289,
+	(const decNumber *) &const_igamma_temme_290,
+	(const decNumber *) &const_igamma_temme_291,
+	(const decNumber *) &const_igamma_temme_292,
+	(const decNumber *) &const_igamma_temme_293,
+	(const decNumber *) &const_igamma_temme_294,
+	(const decNumber *) &const_igamma_temme_295,
+	(const decNumber *) &const_igamma_temme_296,
+	(const decNumber *) &const_igamma_temme_297,
+	(const decNumber *) &const_igamma_temme_298,
+	(const decNumber *) &const_igamma_temme_299,
+	(const decNumber *) &const_igamma_temme_300,
+	(const decNumber *) &const_igamma_temme_301,
+	(const decNumber *) &const_igamma_temme_302,
+	(const decNumber *) &const_igamma_temme_303,
+	(const decNumber *) &const_igamma_temme_304,
+	(const decNumber *) &const_igamma_temme_305,
+	(const decNumber *) &const_igamma_temme_306,
+	(const decNumber *) &const_igamma_temme_307,
+	(const decNumber *) &const_igamma_temme_308,
+	(const decNumber *) &const_igamma_temme_309,
+	(const decNumber *) &const_igamma_temme_310,
+	(const decNumber *) &const_igamma_temme_311,
+	(const decNumber *) &const_igamma_temme_312,
+	(const decNumber *) &const_igamma_temme_313,
+	(const decNumber *) &const_igamma_temme_314,
+	(const decNumber *) &const_igamma_temme_315,
+	(const decNumber *) &const_igamma_temme_316,
+	(const decNumber *) &const_igamma_temme_317,
+	(const decNumber *) &const_igamma_temme_318,
+	(const decNumber *) &const_igamma_temme_319,
+	(const decNumber *) &const_igamma_temme_320,
+	(const decNumber *) &const_igamma_temme_321,
+	(const decNumber *) &const_igamma_temme_322,
+	(const decNumber *) &const_igamma_temme_323,
+	(const decNumber *) &const_igamma_temme_324,
+	(const decNumber *) &const_igamma_temme_325,
+	(const decNumber *) &const_igamma_temme_326,
+	(const decNumber *) &const_igamma_temme_327,
+	(const decNumber *) &const_igamma_temme_328,
+	(const decNumber *) &const_igamma_temme_329,
+	(const decNumber *) &const_igamma_temme_330,
+	(const decNumber *) &const_igamma_temme_331,
+	(const decNumber *) &const_igamma_temme_332,
+	(const decNumber *) &const_igamma_temme_333,
+	(const decNumber *) &const_igamma_temme_334,
+	(const decNumber *) &const_igamma_temme_335,
+	(const decNumber *) &const_igamma_temme_336,
+	(const decNumber *) &const_igamma_temme_337,
+	(const decNumber *) &const_igamma_temme_338,
+	(const decNumber *) &const_igamma_temme_339,
+	(const decNumber *) &const_igamma_temme_340,
+	(const decNumber *) &const_igamma_temme_341,
+	(const decNumber *) &const_igamma_temme_342,
+	(const decNumber *) &const_igamma_temme_343,
+	(const decNumber *) &const_igamma_temme_344,
+	(const decNumber *) &const_igamma_temme_345,
+	(const decNumber *) &const_igamma_temme_346,
+	(const decNumber *) &const_igamma_temme_347,
+	(const decNumber *) &const_igamma_temme_348,
+	(const decNumber *) &const_igamma_temme_349,
+	(const decNumber *) &const_igamma_temme_350,
+	(const decNumber *) &const_igamma_temme_351,
+	(const decNumber *) &const_igamma_temme_352,
+	(const decNumber *) &const_igamma_temme_353,
+	(const decNumber *) &const_igamma_temme_354,
+	(const decNumber *) &const_igamma_temme_355,
+	(const decNumber *) &const_igamma_temme_356,
+	(const decNumber *) &const_igamma_temme_357,
+	(const decNumber *) &const_igamma_temme_358,
+	(const decNumber *) &const_igamma_temme_359,
+	(const decNumber *) &const_igamma_temme_360,
+	(const decNumber *) &const_igamma_temme_361,
+	(const decNumber *) &const_igamma_temme_362,
+	(const decNumber *) &const_igamma_temme_363,
+	(const decNumber *) &const_igamma_temme_364,
+	(const decNumber *) &const_igamma_temme_365,
+	(const decNumber *) &const_igamma_temme_366,
+	(const decNumber *) &const_igamma_temme_367,
+	(const decNumber *) &const_igamma_temme_368,
+	(const decNumber *) &const_igamma_temme_369,
+	(const decNumber *) &const_igamma_temme_370,
+	(const decNumber *) &const_igamma_temme_371,
+	(const decNumber *) &const_igamma_temme_372,
+	(const decNumber *) &const_igamma_temme_373,
+	(const decNumber *) &const_igamma_temme_374,
+	(const decNumber *) &const_igamma_temme_375,
+	(const decNumber *) &const_igamma_temme_376,
+	(const decNumber *) &const_igamma_temme_377,
+	(const decNumber *) &const_igamma_temme_378,
+	(const decNumber *) &const_igamma_temme_379,
+	(const decNumber *) &const_igamma_temme_380,
+	(const decNumber *) &const_igamma_temme_381,
+	(const decNumber *) &const_igamma_temme_382,
+	(const decNumber *) &const_igamma_temme_383,
+	(const decNumber *) &const_igamma_temme_384,
+	(const decNumber *) &const_igamma_temme_385,
+	(const decNumber *) &const_igamma_temme_386,
+	(const decNumber *) &const_igamma_temme_387,
+	(const decNumber *) &const_igamma_temme_388,
+	(const decNumber *) &const_igamma_temme_389,
+	(const decNumber *) &const_igamma_temme_390,
+	(const decNumber *) &const_igamma_temme_391,
+	(const decNumber *) &const_igamma_temme_392,
+	(const decNumber *) &const_igamma_temme_393,
+	(const decNumber *) &const_igamma_temme_394,
+	(const decNumber *) &const_igamma_temme_395,
+	(const decNumber *) &const_igamma_temme_396,
+	(const decNumber *) &const_igamma_temme_397,
+	(const decNumber *) &const_igamma_temme_398,
+	(const decNumber *) &const_igamma_temme_399,
+	(const decNumber *) &const_igamma_temme_400,
+	(const decNumber *) &const_igamma_temme_401,
+	(const decNumber *) &const_igamma_temme_402,
+	(const decNumber *) &const_igamma_temme_403,
+	(const decNumber *) &const_igamma_temme_404,
+	(const decNumber *) &const_igamma_temme_405,
+	(const decNumber *) &const_igamma_temme_406,
+	(const decNumber *) &const_igamma_temme_407,
+	(const decNumber *) &const_igamma_temme_408,
+	(const decNumber *) &const_igamma_temme_409,
+	(const decNumber *) &const_igamma_temme_410,
+	(const decNumber *) &const_igamma_temme_411,
+	(const decNumber *) &const_igamma_temme_412,
+	(const decNumber *) &const_igamma_temme_413,
+	(const decNumber *) &const_igamma_temme_414,
+	(const decNumber *) &const_igamma_temme_415,
+	(const decNumber *) &const_igamma_temme_416,
+	(const decNumber *) &const_igamma_temme_417,
+	(const decNumber *) &const_igamma_temme_418,
+	(const decNumber *) &const_igamma_temme_419,
+	(const decNumber *) &const_igamma_temme_420,
+	(const decNumber *) &const_igamma_temme_421,
+	(const decNumber *) &const_igamma_temme_422,
+	(const decNumber *) &const_igamma_temme_423,
+	(const decNumber *) &const_igamma_temme_424,
+	(const decNumber *) &const_igamma_temme_425,
+	(const decNumber *) &const_igamma_temme_426,
+	(const decNumber *) &const_igamma_temme_427,
+	(const decNumber *) &const_igamma_temme_428,
+	(const decNumber *) &const_igamma_temme_429,
+	(const decNumber *) &const_igamma_temme_430,
+	(const decNumber *) &const_igamma_temme_431,
+	(const decNumber *) &const_igamma_temme_432,
+	(const decNumber *) &const_igamma_temme_433,
+	(const decNumber *) &const_igamma_temme_434,
+	(const decNumber *) &const_igamma_temme_435,
+	(const decNumber *) &const_igamma_temme_436,
+	(const decNumber *) &const_igamma_temme_437,
+	(const decNumber *) &const_igamma_temme_438,
+	(const decNumber *) &const_igamma_temme_439,
+	(const decNumber *) &const_igamma_temme_440,
+	(const decNumber *) &const_igamma_temme_441,
+	(const decNumber *) &const_igamma_temme_442,
+	(const decNumber *) &const_igamma_temme_443,
+	(const decNumber *) &const_igamma_temme_444,
+	(const decNumber *) &const_igamma_temme_445,
+	(const decNumber *) &const_igamma_temme_446,
+	(const decNumber *) &const_igamma_temme_447,
+	(const decNumber *) &const_igamma_temme_448,
+	(const decNumber *) &const_igamma_temme_449,
+	(const decNumber *) &const_igamma_temme_450,
+	(const decNumber *) &const_igamma_temme_451,
+	(const decNumber *) &const_igamma_temme_452,
+	(const decNumber *) &const_igamma_temme_453,
+	(const decNumber *) &const_igamma_temme_454,
+	(const decNumber *) &const_igamma_temme_455,
+	(const decNumber *) &const_igamma_temme_456,
+	(const decNumber *) &const_igamma_temme_457,
+	(const decNumber *) &const_igamma_temme_458,
+	(const decNumber *) &const_igamma_temme_459,
+	(const decNumber *) &const_igamma_temme_460,
+	(const decNumber *) &const_igamma_temme_461,
+	(const decNumber *) &const_igamma_temme_462,
+	(const decNumber *) &const_igamma_temme_463,
+	(const decNumber *) &const_igamma_temme_464,
+	(const decNumber *) &const_igamma_temme_465,
+	(const decNumber *) &const_igamma_temme_466,
+	(const decNumber *) &const_igamma_temme_467,
+	(const decNumber *) &const_igamma_temme_468,
+	(const decNumber *) &const_igamma_temme_469,
+	(const decNumber *) &const_igamma_temme_470,
+	(const decNumber *) &const_igamma_temme_471,
+	(const decNumber *) &const_igamma_temme_472,
+	(const decNumber *) &const_igamma_temme_473,
+	(const decNumber *) &const_igamma_temme_474,
+	(const decNumber *) &const_igamma_temme_475,
+	(const decNumber *) &const_igamma_temme_476,
+	(const decNumber *) &const_igamma_temme_477,
+	(const decNumber *) &const_igamma_temme_478,
+	(const decNumber *) &const_igamma_temme_479,
+	(const decNumber *) &const_igamma_temme_480,
+	(const decNumber *) &const_igamma_temme_481,
+	(const decNumber *) &const_igamma_temme_482,
+	(const decNumber *) &const_igamma_temme_483,
+	(const decNumber *) &const_igamma_temme_484,
+	(const decNumber *) &const_igamma_temme_485,
+	(const decNumber *) &const_igamma_temme_486,
+	(const decNumber *) &const_igamma_temme_487,
+	(const decNumber *) &const_igamma_temme_488,
+	(const decNumber *) &const_igamma_temme_489,
+	(const decNumber *) &const_igamma_temme_490,
+	(const decNumber *) &const_igamma_temme_491,
+	(const decNumber *) &const_igamma_temme_492,
+	(const decNumber *) &const_igamma_temme_493,
+	(const decNumber *) &const_igamma_temme_494,
+	(const decNumber *) &const_igamma_temme_495,
+	(const decNumber *) &const_igamma_temme_496,
+	(const decNumber *) &const_igamma_temme_497,
+	(const decNumber *) &const_igamma_temme_498,
+	(const decNumber *) &const_igamma_temme_499,
+	(const decNumber *) &const_igamma_temme_500,
+	(const decNumber *) &const_igamma_temme_501,
+	(const decNumber *) &const_igamma_temme_502,
+	(const decNumber *) &const_igamma_temme_503,
+	(const decNumber *) &const_igamma_temme_504,
+	(const decNumber *) &const_igamma_temme_505,
+	(const decNumber *) &const_igamma_temme_506,
+	(const decNumber *) &const_igamma_temme_507,
+	(const decNumber *) &const_igamma_temme_508,
+	(const decNumber *) &const_igamma_temme_509,
+	(const decNumber *) &const_igamma_temme_510,
+	(const decNumber *) &const_igamma_temme_511,
+	(const decNumber *) &const_igamma_temme_512,
+	(const decNumber *) &const_igamma_temme_513,
+	(const decNumber *) &const_igamma_temme_514,
+	(const decNumber *) &const_igamma_temme_515,
+	(const decNumber *) &const_igamma_temme_516,
+	(const decNumber *) &const_igamma_temme_517,
+	(const decNumber *) &const_igamma_temme_518,
+	(const decNumber *) &const_igamma_temme_519,
+	(const decNumber *) &const_igamma_temme_520,
+	(const decNumber *) &const_igamma_temme_521,
+	(const decNumber *) &const_igamma_temme_522,
+	(const decNumber *) &const_igamma_temme_523,
+	(const decNumber *) &const_igamma_temme_524,
+	(const decNumber *) &const_igamma_temme_525,
+	(const decNumber *) &const_igamma_temme_526,
+	(const decNumber *) &const_igamma_temme_527,
+	(const decNumber *) &const_igamma_temme_528,
+	(const decNumber *) &const_igamma_temme_529,
+	(const decNumber *) &const_igamma_temme_530,
+	(const decNumber *) &const_igamma_temme_531,
+	(const decNumber *) &const_igamma_temme_532,
+	(const decNumber *) &const_igamma_temme_533,
+	(const decNumber *) &const_igamma_temme_534,
+	(const decNumber *) &const_igamma_temme_535,
+	(const decNumber *) &const_igamma_temme_536,
+	(const decNumber *) &const_igamma_temme_537,
+	(const decNumber *) &const_igamma_temme_538,
+	(const decNumber *) &const_igamma_temme_539,
+	(const decNumber *) &const_igamma_temme_540,
+	(const decNumber *) &const_igamma_temme_541,
+	(const decNumber *) &const_igamma_temme_542,
+	(const decNumber *) &const_igamma_temme_543,
+	(const decNumber *) &const_igamma_temme_544,
+	(const decNumber *) &const_igamma_temme_545,
+	(const decNumber *) &const_igamma_temme_546,
+	(const decNumber *) &const_igamma_temme_547,
+	(const decNumber *) &const_igamma_temme_548,
+	(const decNumber *) &const_igamma_temme_549,
+	(const decNumber *) &const_igamma_temme_550,
+	(const decNumber *) &const_igamma_temme_551,
+	(const decNumber *) &const_igamma_temme_552,
+	(const decNumber *) &const_igamma_temme_553,
+	(const decNumber *) &const_igamma_temme_554,
+	(const decNumber *) &const_igamma_temme_555,
+	(const decNumber *) &const_igamma_temme_556,
+	(const decNumber *) &const_igamma_temme_557,
+	(const decNumber *) &const_igamma_temme_558,
+	(const decNumber *) &const_igamma_temme_559,
+	(const decNumber *) &const_igamma_temme_560,
+	(const decNumber *) &const_igamma_temme_561,
+	(const decNumber *) &const_igamma_temme_562,
+	(const decNumber *) &const_igamma_temme_563,
+	(const decNumber *) &const_igamma_temme_564,
+	(const decNumber *) &const_igamma_temme_565,
+	(const decNumber *) &const_igamma_temme_566,
+	(const decNumber *) &const_igamma_temme_567,
+	(const decNumber *) &const_igamma_temme_568,
+	(const decNumber *) &const_igamma_temme_569,
+	(const decNumber *) &const_igamma_temme_570,
+	(const decNumber *) &const_igamma_temme_571,
+	(const decNumber *) &const_igamma_temme_572,
+	(const decNumber *) &const_igamma_temme_573,
+	(const decNumber *) &const_igamma_temme_574,
+	(const decNumber *) &const_igamma_temme_575,
+	(const decNumber *) &const_igamma_temme_576,
+	(const decNumber *) &const_igamma_temme_577,
+	(const decNumber *) &const_igamma_temme_578,
+	(const decNumber *) &const_igamma_temme_579,
+	(const decNumber *) &const_igamma_temme_580,
+	(const decNumber *) &const_igamma_temme_581,
+	(const decNumber *) &const_igamma_temme_582,
+	(const decNumber *) &const_igamma_temme_583,
+	(const decNumber *) &const_igamma_temme_584,
+	(const decNumber *) &const_igamma_temme_585,
+	(const decNumber *) &const_igamma_temme_586,
+	(const decNumber *) &const_igamma_temme_587,
+	(const decNumber *) &const_igamma_temme_588,
+	(const decNumber *) &const_igamma_temme_589,
+	(const decNumber *) &const_igamma_temme_590,
+	(const decNumber *) &const_igamma_temme_591,
+	(const decNumber *) &const_igamma_temme_592,
+	(const decNumber *) &const_igamma_temme_593,
+	(const decNumber *) &const_igamma_temme_594,
+	(const decNumber *) &const_igamma_temme_595,
+	(const decNumber *) &const_igamma_temme_596,
+	(const decNumber *) &const_igamma_temme_597,
+	(const decNumber *) &const_igamma_temme_598,
+	(const decNumber *) &const_igamma_temme_599,
+	(const decNumber *) &const_igamma_temme_600,
+	(const decNumber *) &const_igamma_temme_601,
+	(const decNumber *) &const_igamma_temme_602,
+	(const decNumber *) &const_igamma_temme_603,
+	(const decNumber *) &const_igamma_temme_604,
+	(const decNumber *) &const_igamma_temme_605,
+	(const decNumber *) &const_igamma_temme_606,
+	(const decNumber *) &const_igamma_temme_607,
+	(const decNumber *) &const_igamma_temme_608,
+	(const decNumber *) &const_igamma_temme_609,
+	(const decNumber *) &const_igamma_temme_610,
+	(const decNumber *) &const_igamma_temme_611,
+	(const decNumber *) &const_igamma_temme_612,
+	(const decNumber *) &const_igamma_temme_613,
+	(const decNumber *) &const_igamma_temme_614,
+	(const decNumber *) &const_igamma_temme_615,
+	(const decNumber *) &const_igamma_temme_616,
+	(const decNumber *) &const_igamma_temme_617,
+	(const decNumber *) &const_igamma_temme_618,
+	(const decNumber *) &const_igamma_temme_619,
+	(const decNumber *) &const_igamma_temme_620,
+	(const decNumber *) &const_igamma_temme_621,
+	(const decNumber *) &const_igamma_temme_622,
+	(const decNumber *) &const_igamma_temme_623,
+	(const decNumber *) &const_igamma_temme_624,
+	(const decNumber *) &const_igamma_temme_625,
+	(const decNumber *) &const_igamma_temme_626,
+	(const decNumber *) &const_igamma_temme_627,
+	(const decNumber *) &const_igamma_temme_628,
+	(const decNumber *) &const_igamma_temme_629,
+	(const decNumber *) &const_igamma_temme_630,
+	(const decNumber *) &const_igamma_temme_631,
+	(const decNumber *) &const_igamma_temme_632,
+	(const decNumber *) &const_igamma_temme_633,
+	(const decNumber *) &const_igamma_temme_634,
+	(const decNumber *) &const_igamma_temme_635,
+	(const decNumber *) &const_igamma_temme_636,
+	(const decNumber *) &const_igamma_temme_637,
+	(const decNumber *) &const_igamma_temme_638,
+	(const decNumber *) &const_igamma_temme_639,
+};
+
@@ -0,0 +1,298 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_rfact_0 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_rfact_1 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_rfact_2 = {
+	1,
+	-1,
+	128,
+	{ 5 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_3 = {
+	51,
+	-51,
+	128,
+	{ 666666667, 666666666, 666666666, 666666666, 666666666, 166666 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_4 = {
+	51,
+	-52,
+	0,
+	{ 666666667, 666666666, 666666666, 666666666, 666666666, 416666 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_5 = {
+	51,
+	-53,
+	0,
+	{ 333333333, 333333333, 333333333, 333333333, 333333333, 833333 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_6 = {
+	51,
+	-53,
+	128,
+	{ 888888889, 888888888, 888888888, 888888888, 888888888, 138888 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_7 = {
+	51,
+	-54,
+	128,
+	{ 698412698, 412698412, 698412698, 412698412, 698412698, 198412 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_8 = {
+	51,
+	-55,
+	0,
+	{ 873015873, 15873015, 873015873, 15873015, 873015873, 248015 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_9 = {
+	51,
+	-56,
+	0,
+	{ 192239859, 906525573, 192239858, 906525573, 192239858, 275573 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_10 = {
+	51,
+	-57,
+	128,
+	{ 192239859, 906525573, 192239858, 906525573, 192239858, 275573 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_11 = {
+	51,
+	-58,
+	128,
+	{ 83854417, 187750521, 83854417, 187750521, 83854417, 250521 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_12 = {
+	51,
+	-59,
+	0,
+	{ 236545348, 323125434, 903212014, 989792100, 569878680, 208767 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_13 = {
+	51,
+	-60,
+	0,
+	{ 105034883, 479327257, 771701549, 145993923, 438368216, 160590 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_14 = {
+	51,
+	-61,
+	128,
+	{ 503596345, 56662326, 979786821, 247138516, 455977297, 114707 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_15 = {
+	51,
+	-63,
+	128,
+	{ 23975632, 44415510, 198578807, 647590113, 373181981, 764716 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_16 = {
+	50,
+	-63,
+	0,
+	{ 376498477, 440275969, 74911175, 852974382, 773323873, 47794 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_17 = {
+	51,
+	-65,
+	0,
+	{ 273520453, 1623349, 558301032, 76319894, 725434552, 281145 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_18 = {
+	51,
+	-66,
+	128,
+	{ 40844696, 334235194, 643500573, 264622163, 69685862, 156192 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_19 = {
+	51,
+	-68,
+	128,
+	{ 899182611, 74922073, 123687228, 971695598, 524662432, 822063 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_rfact_20 = {
+	51,
+	-69,
+	0,
+	{ 949591306, 37461036, 61843614, 485847799, 762331216, 411031 }
+};
+
+const decNumber *const const_sincos_rfact[21] = {
+	(const decNumber *) &const_sincos_rfact_0,
+	(const decNumber *) &const_sincos_rfact_1,
+	(const decNumber *) &const_sincos_rfact_2,
+	(const decNumber *) &const_sincos_rfact_3,
+	(const decNumber *) &const_sincos_rfact_4,
+	(const decNumber *) &const_sincos_rfact_5,
+	(const decNumber *) &const_sincos_rfact_6,
+	(const decNumber *) &const_sincos_rfact_7,
+	(const decNumber *) &const_sincos_rfact_8,
+	(const decNumber *) &const_sincos_rfact_9,
+	(const decNumber *) &const_sincos_rfact_10,
+	(const decNumber *) &const_sincos_rfact_11,
+	(const decNumber *) &const_sincos_rfact_12,
+	(const decNumber *) &const_sincos_rfact_13,
+	(const decNumber *) &const_sincos_rfact_14,
+	(const decNumber *) &const_sincos_rfact_15,
+	(const decNumber *) &const_sincos_rfact_16,
+	(const decNumber *) &const_sincos_rfact_17,
+	(const decNumber *) &const_sincos_rfact_18,
+	(const decNumber *) &const_sincos_rfact_19,
+	(const decNumber *) &const_sincos_rfact_20,
+};
+
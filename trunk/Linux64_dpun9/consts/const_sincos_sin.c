@@ -0,0 +1,454 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+#include "decNumber/decNumber.h"
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_sin_0 = {
+	1,
+	0,
+	0,
+	{ 0 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_1 = {
+	51,
+	-52,
+	0,
+	{ 630257529, 583147453, 769426826, 142549549, 743274180, 490676 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_2 = {
+	51,
+	-52,
+	0,
+	{ 731675006, 458611366, 638886418, 19941955, 403295606, 980171 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_3 = {
+	51,
+	-51,
+	0,
+	{ 316529392, 819706215, 129646717, 751658850, 474455361, 146730 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_4 = {
+	51,
+	-51,
+	0,
+	{ 617751955, 240927691, 868477022, 267848284, 322016128, 195090 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_5 = {
+	51,
+	-51,
+	0,
+	{ 783283832, 118320990, 162077471, 889948274, 179903263, 242980 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_6 = {
+	51,
+	-51,
+	0,
+	{ 278324151, 274691476, 375817395, 367636192, 677254462, 290284 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_7 = {
+	51,
+	-51,
+	0,
+	{ 779671222, 570477766, 212619147, 50689253, 853392220, 336889 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_8 = {
+	51,
+	-51,
+	0,
+	{ 562485627, 866761344, 984030398, 771728459, 432365089, 382683 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_9 = {
+	51,
+	-51,
+	0,
+	{ 629342459, 534304578, 856888798, 94320966, 93430282, 427555 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_10 = {
+	51,
+	-51,
+	0,
+	{ 318932481, 377657460, 625905254, 648556387, 736825997, 471396 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_11 = {
+	51,
+	-51,
+	0,
+	{ 120416218, 772608049, 838968815, 726593693, 744193221, 514102 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_12 = {
+	51,
+	-51,
+	0,
+	{ 190754804, 874374937, 813948532, 224742830, 233019602, 555570 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_13 = {
+	51,
+	-51,
+	0,
+	{ 338437505, 889511926, 528829969, 343467036, 304492433, 595699 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_14 = {
+	51,
+	-51,
+	0,
+	{ 94841722, 370675687, 613225493, 498215171, 284163645, 634393 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_15 = {
+	51,
+	-51,
+	0,
+	{ 632199794, 803228750, 850427421, 400625376, 954847018, 671558 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_16 = {
+	51,
+	-51,
+	0,
+	{ 937688474, 39284835, 362104849, 524400844, 781186547, 707106 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_17 = {
+	50,
+	-50,
+	0,
+	{ 530930909, 272972895, 689749516, 909117561, 112535495, 74095 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_18 = {
+	50,
+	-50,
+	0,
+	{ 129290081, 980097104, 660975846, 696081090, 45336273, 77301 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_19 = {
+	51,
+	-51,
+	0,
+	{ 427170461, 923879569, 512963141, 909806676, 531480644, 803207 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_20 = {
+	50,
+	-50,
+	0,
+	{ 81198725, 575673856, 837761790, 523707878, 961230254, 83146 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_21 = {
+	51,
+	-51,
+	0,
+	{ 799433734, 137042490, 984284770, 69902269, 610000272, 857728 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_22 = {
+	51,
+	-51,
+	0,
+	{ 620674728, 349508442, 863660388, 29712756, 264348355, 881921 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_23 = {
+	51,
+	-51,
+	0,
+	{ 25050608, 48710132, 297230537, 331586200, 293123443, 903989 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_24 = {
+	51,
+	-51,
+	0,
+	{ 625863642, 286822416, 189396788, 756128183, 532511286, 923879 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_25 = {
+	51,
+	-51,
+	0,
+	{ 795825183, 357185589, 402599502, 778412509, 65183020, 941544 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_26 = {
+	51,
+	-51,
+	0,
+	{ 205630037, 969482849, 886980269, 864935797, 335732208, 956940 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_27 = {
+	51,
+	-51,
+	0,
+	{ 962248074, 251456865, 207286100, 992603984, 253194543, 970031 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_28 = {
+	51,
+	-51,
+	0,
+	{ 730893336, 36973933, 236134239, 449126182, 280403230, 980785 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_29 = {
+	51,
+	-51,
+	0,
+	{ 533336907, 63983689, 738016243, 973451673, 509964780, 989176 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_30 = {
+	51,
+	-51,
+	0,
+	{ 868729857, 921575474, 953109479, 886244836, 726672196, 995184 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[6];
+} const_sincos_sin_31 = {
+	51,
+	-51,
+	0,
+	{ 614704612, 694443203, 604759100, 392714771, 456205172, 998795 }
+};
+
+static const struct {
+	int32_t digits;
+	int32_t exponent;
+	uint8_t bits;
+	decNumberUnit lsu[1];
+} const_sincos_sin_32 = {
+	1,
+	0,
+	0,
+	{ 1 }
+};
+
+const decNumber *const const_sincos_sin[33] = {
+	(const decNumber *) &const_sincos_sin_0,
+	(const decNumber *) &const_sincos_sin_1,
+	(const decNumber *) &const_sincos_sin_2,
+	(const decNumber *) &const_sincos_sin_3,
+	(const decNumber *) &const_sincos_sin_4,
+	(const decNumber *) &const_sincos_sin_5,
+	(const decNumber *) &const_sincos_sin_6,
+	(const decNumber *) &const_sincos_sin_7,
+	(const decNumber *) &const_sincos_sin_8,
+	(const decNumber *) &const_sincos_sin_9,
+	(const decNumber *) &const_sincos_sin_10,
+	(const decNumber *) &const_sincos_sin_11,
+	(const decNumber *) &const_sincos_sin_12,
+	(const decNumber *) &const_sincos_sin_13,
+	(const decNumber *) &const_sincos_sin_14,
+	(const decNumber *) &const_sincos_sin_15,
+	(const decNumber *) &const_sincos_sin_16,
+	(const decNumber *) &const_sincos_sin_17,
+	(const decNumber *) &const_sincos_sin_18,
+	(const decNumber *) &const_sincos_sin_19,
+	(const decNumber *) &const_sincos_sin_20,
+	(const decNumber *) &const_sincos_sin_21,
+	(const decNumber *) &const_sincos_sin_22,
+	(const decNumber *) &const_sincos_sin_23,
+	(const decNumber *) &const_sincos_sin_24,
+	(const decNumber *) &const_sincos_sin_25,
+	(const decNumber *) &const_sincos_sin_26,
+	(const decNumber *) &const_sincos_sin_27,
+	(const decNumber *) &const_sincos_sin_28,
+	(const decNumber *) &const_sincos_sin_29,
+	(const decNumber *) &const_sincos_sin_30,
+	(const decNumber *) &const_sincos_sin_31,
+	(const decNumber *) &const_sincos_sin_32,
+};
+
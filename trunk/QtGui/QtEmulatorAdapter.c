@@ -223,14 +223,17 @@ void prepare_memory_save()
 
 void after_state_load()
 {
+	label_index_invalidate(REGION_RAM);
 }
 
 void after_backup_load()
 {
+	label_index_invalidate(REGION_BACKUP);
 }
 
 void after_library_load()
 {
+	label_index_invalidate(REGION_LIBRARY);
 	init_library();
 }
 
@@ -108,6 +108,7 @@ static struct {
 	{ DFLT,  "360",			"360"		},
 	{ DFLT,  "400",			"400"		},
 	{ DFLT,  "500",			"500"		},
+	{ DFLT,  "5000",		"5000"		},
 	{ DFLT,  "9000",		"9000"		},
 	{ DFLT,  "36000",		"36000"		},
 	{ DFLT,  "100000",		"100000"	},
@@ -119,6 +120,7 @@ static struct {
 	{ DFLT,  "hms_threshold",	"0.000001388888888888888888888888888888888888888888888"	},
 	{ DFLT,  "0_0001",		"0.0001"	},
 	{ DFLT,  "0_001",		"0.001"		},
+	{ DFLT,  "0_002",		"0.002"		},
 	{ DFLT,  "0_1",			"0.1"		},
 	{ DFLT,  "0_0195",		"0.0195"	},
 	{ DFLT,  "0_2",			"0.2"		},
@@ -167,6 +169,7 @@ static struct {
 */
 												},
 	{ DFLT,  "sqrt2PI",		"2.50662827463100050241576528481104525300698674060994"	},
+	{ DFLT,  "lnsqrt2PI",	"0.91893853320467274178032973640561763986139747363778"	},
 	{ DFLT,  "recipsqrt2PI",	"0.3989422804014326779399460599343818684758586311649347"	},
 	{ DFLT,  "PIon2",		"1.57079632679489661923132169163975144209858469968755"	},
 	{ DFLT,  "PIon180",		"0.01745329251994329576923690768488612713442871888541"	},
@@ -432,24 +435,11 @@ static int compare_files(const char *const fn1, const char *const fn2) {
 }
 
 
-static void output(FILE *fm, const char *name, const decNumber *d) {
+static void output_number(FILE *fc, const char *qual, const char *name, const decNumber *d) {
 	int i;
-	int num;
-	FILE *fc;
-	char fname[1000];
-	char tmpname[1000];
-	static int body = 0;
-
-	fprintf(fh, "extern const decNumber const_%s;\n", name);
+	const int num = ((d->digits+DECDPUN-1)/DECDPUN);
 
-	sprintf(fname, "const_%s.c", name);
-	sprintf(tmpname, "tmp_const_%s.c", name);
-	fc = fopen(tmpname, "w");
-	license(fc, "/* ", " * ", " */");
-	num = ((d->digits+DECDPUN-1)/DECDPUN);
-	fprintf(fc,	"#include \"decNumber/decNumber.h\"\n"
-			"\n"
-			"const struct {\n"
+	fprintf(fc,	"%sconst struct {\n"
 			"\tint32_t digits;\n"
 			"\tint32_t exponent;\n"
 			"\tuint8_t bits;\n"
@@ -460,14 +450,35 @@ static void output(FILE *fm, const char *name, const decNumber *d) {
 			"\t%d,\n"
 			"\t%u,\n"
 			"\t{ ",
-		num, name, d->digits, d->exponent, d->bits);
+		qual, num, name, d->digits, d->exponent, d->bits);
 	for (i=0; i<num; i++) {
 		if (i != 0)
 			fprintf(fc, ", ");
 		fprintf(fc, "%lu", (unsigned long int)d->lsu[i]);
 	}
 	fprintf(fc, " }\n};\n\n");
+}
+
+static FILE *output_open(const char *name) {
+	char tmpname[1000];
+	FILE *fc;
+
+	sprintf(tmpname, "tmp_const_%s.c", name);
+	fc = fopen(tmpname, "w");
+	license(fc, "/* ", " * ", " */");
+	fprintf(fc,	"#include \"decNumber/decNumber.h\"\n"
+			"\n");
+	return fc;
+}
+
+static void output_close(FILE *fm, FILE *fc, const char *name) {
+	char fname[1000];
+	char tmpname[1000];
+	static int body = 0;
+
 	fclose(fc);
+	sprintf(fname, "const_%s.c", name);
+	sprintf(tmpname, "tmp_const_%s.c", name);
 	if (compare_files(tmpname, fname)) {
 		unlink(fname);
 		rename(tmpname, fname);
@@ -480,6 +491,359 @@ static void output(FILE *fm, const char *name, const decNumber *d) {
 	fprintf(fm, "\tconst_%s.o", name);
 }
 
+static void output(FILE *fm, const char *name, const decNumber *d) {
+	FILE *fc;
+
+	fprintf(fh, "extern const decNumber const_%s;\n", name);
+	fc = output_open(name);
+	output_number(fc, "", name, d);
+	output_close(fm, fc, name);
+}
+
+/* Output a table of numbers as an array of pointers to them.
+ */
+static void output_table(FILE *fm, const char *name, const decNumber d[], int n) {
+	FILE *fc;
+	char ename[1000];
+	int i;
+
+	fprintf(fh, "extern const decNumber *const const_%s[%d];\n", name, n);
+	fc = output_open(name);
+	for (i=0; i<n; i++) {
+		sprintf(ename, "%s_%d", name, i);
+		output_number(fc, "static ", ename, &d[i]);
+	}
+	fprintf(fc, "const decNumber *const const_%s[%d] = {\n", name, n);
+	for (i=0; i<n; i++)
+		fprintf(fc, "\t(const decNumber *) &const_%s_%d,\n", name, i);
+	fprintf(fc, "};\n\n");
+	output_close(fm, fc, name);
+}
+
+/* Tables for the sine and cosine kernel in decn.c.  The argument is reduced
+ * to the nearest multiple of pi/(2 SINCOS_STEPS) and the remainder evaluated
+ * by a polynomial with SINCOS_TERMS terms.  The step is split in two so that
+ * multiples of its first part up to 999 are exact in SINCOS_NDIG digits.
+ */
+#define SINCOS_STEPS	32
+#define SINCOS_TERMS	20
+#define SINCOS_NDIG	51		/* SINCOS_DIGITS in decn.c */
+#define SINCOS_WORK	70
+
+static void int_to_number(decNumber *r, int n, decContext *ctx) {
+	char buf[20];
+
+	sprintf(buf, "%d", n);
+	decNumberFromString(r, buf, ctx);
+}
+
+static void round_number(decNumber *r, const decNumber *x, int digits) {
+	decContext ctx;
+	decNumber y;
+
+	decContextDefault(&ctx, DEC_INIT_BASE);
+	ctx.digits = digits;
+	ctx.emax=DEC_MAX_MATH;
+	ctx.emin=-DEC_MAX_MATH;
+	ctx.round = DEC_ROUND_HALF_EVEN;
+	decNumberPlus(&y, x, &ctx);
+	decNumberNormalize(r, &y, &ctx);
+}
+
+static void sin_series(decNumber *r, const decNumber *x, decContext *ctx) {
+	decNumber x2, t, n, s;
+	int i;
+
+	decNumberMultiply(&x2, x, x, ctx);
+	decNumberCopy(&t, x);
+	decNumberCopy(r, x);
+	for (i=3; i<1000; i+=2) {
+		int_to_number(&n, -i * (i-1), ctx);
+		decNumberMultiply(&t, &t, &x2, ctx);
+		decNumberDivide(&t, &t, &n, ctx);
+		decNumberAdd(&s, r, &t, ctx);
+		decNumberCompare(&n, &s, r, ctx);
+		decNumberCopy(r, &s);
+		if (decNumberIsZero(&n))
+			break;
+	}
+}
+
+static void const_sincos(FILE *fm) {
+	static decNumber tbl[SINCOS_STEPS+SINCOS_TERMS+2];
+	decNumber pi, step, x, y;
+	decContext ctx;
+	int n;
+
+	decContextDefault(&ctx, DEC_INIT_BASE);
+	ctx.digits = SINCOS_WORK;
+	ctx.emax=DEC_MAX_MATH;
+	ctx.emin=-DEC_MAX_MATH;
+	ctx.round = DEC_ROUND_HALF_EVEN;
+
+	for (n=0; strcmp(cnsts[n].name, "2PI") != 0; n++);
+	decNumberFromString(&pi, cnsts[n].value, &ctx);
+	int_to_number(&x, 4 * SINCOS_STEPS, &ctx);
+	decNumberDivide(&step, &pi, &x, &ctx);
+
+	fprintf(fh, "\n#define SINCOS_STEPS %d\n#define SINCOS_TERMS %d\n",
+			SINCOS_STEPS, SINCOS_TERMS);
+
+	round_number(&x, &step, SINCOS_NDIG - 6);
+	output(fm, "sincos_step1", &x);
+	decNumberSubtract(&y, &step, &x, &ctx);
+	round_number(&y, &y, SINCOS_NDIG);
+	output(fm, "sincos_step2", &y);
+	int_to_number(&y, 1, &ctx);
+	decNumberDivide(&x, &y, &step, &ctx);
+	round_number(&x, &x, SINCOS_NDIG);
+	output(fm, "sincos_rstep", &x);
+
+	// Sines of the steps over the first quadrant
+	for (n=0; n<=SINCOS_STEPS; n++) {
+		int_to_number(&x, n, &ctx);
+		decNumberMultiply(&x, &x, &step, &ctx);
+		sin_series(&y, &x, &ctx);
+		round_number(tbl+n, &y, SINCOS_NDIG);
+	}
+	output_table(fm, "sincos_sin", tbl, SINCOS_STEPS+1);
+
+	// Reciprocal factorials with the signs of the sine and cosine series
+	int_to_number(&x, 1, &ctx);
+	for (n=0; n<=SINCOS_TERMS; n++) {
+		if (n > 1) {
+			int_to_number(&y, n, &ctx);
+			decNumberDivide(&x, &x, &y, &ctx);
+		}
+		if (n & 2)
+			decNumberMinus(&y, &x, &ctx);
+		else
+			decNumberCopy(&y, &x);
+		round_number(tbl+n, &y, SINCOS_NDIG);
+	}
+	output_table(fm, "sincos_rfact", tbl, SINCOS_TERMS+1);
+}
+
+/* Tables for the gamma function in decn.c.  The Lanczos sum
+ *	c0 + c1/(x+1) + ... + cN/(x+N)
+ * is multiplied out into the ratio of two polynomials of degree N, both
+ * with positive coefficients, so it costs a single division.  The Stirling
+ * series for large arguments uses B(2k) / (2k (2k-1)).  Every
+ * GAMMA_TABLE_STEP-th factorial and gamma of a half integer start the
+ * products for integer and half integer arguments.  All are rounded to DFLT
+ * digits since decn.c copies them into its own numbers.
+ */
+#define GAMMA_TERMS		21
+#define GAMMA_TABLE_STEP	8
+#define GAMMA_TABLE_SIZE	32
+#define STIRLING_TERMS		24
+#define GAMMA_WORK		70
+
+static const struct {
+	const char *num, *den;
+} stirling[STIRLING_TERMS] = {
+	{ "1", "12" },
+	{ "-1", "360" },
+	{ "1", "1260" },
+	{ "-1", "1680" },
+	{ "1", "1188" },
+	{ "-691", "360360" },
+	{ "1", "156" },
+	{ "-3617", "122400" },
+	{ "43867", "244188" },
+	{ "-174611", "125400" },
+	{ "77683", "5796" },
+	{ "-236364091", "1506960" },
+	{ "657931", "300" },
+	{ "-3392780147", "93960" },
+	{ "1723168255201", "2492028" },
+	{ "-7709321041217", "505920" },
+	{ "151628697551", "396" },
+	{ "-26315271553053477373", "2418179400" },
+	{ "154210205991661", "444" },
+	{ "-261082718496449122051", "21106800" },
+	{ "1520097643918070802691", "3109932" },
+	{ "-2530297234481911294093", "118680" },
+	{ "25932657025822267968607", "25380" },
+	{ "-5609403368997817686249127547", "104700960" },
+};
+
+static const char *const_value(const char *name) {
+	int n;
+
+	for (n=0; strcmp(cnsts[n].name, name) != 0; n++);
+	return cnsts[n].value;
+}
+
+static void const_gamma(FILE *fm) {
+	static decNumber num[GAMMA_TERMS+1], den[GAMMA_TERMS+1], tbl[GAMMA_TABLE_SIZE];
+	decNumber c, x, y, z;
+	decContext ctx;
+	char name[20];
+	int i, j, k;
+
+	decContextDefault(&ctx, DEC_INIT_BASE);
+	ctx.digits = DECNUMDIGITS;
+	ctx.emax=DEC_MAX_MATH;
+	ctx.emin=-DEC_MAX_MATH;
+	ctx.round = DEC_ROUND_HALF_EVEN;
+
+	fprintf(fh, "\n#define GAMMA_TERMS %d\n#define GAMMA_TABLE_STEP %d\n"
+			"#define GAMMA_TABLE_SIZE %d\n#define STIRLING_TERMS %d\n",
+			GAMMA_TERMS, GAMMA_TABLE_STEP, GAMMA_TABLE_SIZE, STIRLING_TERMS);
+
+	/* den = (x+1) ... (x+N), num = c0 den + sum ck den / (x+k).
+	 * Both are exact at this precision.
+	 */
+	for (i=0; i<=GAMMA_TERMS; i++) {
+		decNumberZero(num+i);
+		decNumberZero(den+i);
+	}
+	int_to_number(den, 1, &ctx);
+	for (k=1; k<=GAMMA_TERMS; k++) {
+		int_to_number(&x, k, &ctx);
+		for (i=k; i>0; i--) {
+			decNumberMultiply(&y, den+i, &x, &ctx);
+			decNumberAdd(den+i, &y, den+i-1, &ctx);
+		}
+		decNumberMultiply(den, den, &x, &ctx);
+	}
+	for (k=0; k<=GAMMA_TERMS; k++) {
+		sprintf(name, "gammaC%02d", k);
+		decNumberFromString(&c, const_value(name), &ctx);
+		if (k == 0) {
+			for (i=0; i<=GAMMA_TERMS; i++) {
+				decNumberMultiply(&y, den+i, &c, &ctx);
+				decNumberAdd(num+i, num+i, &y, &ctx);
+			}
+			continue;
+		}
+		// Synthetic division of den by x+k
+		int_to_number(&x, k, &ctx);
+		decNumberZero(&z);
+		for (i=GAMMA_TERMS; i>0; i--) {
+			decNumberMultiply(&y, &z, &x, &ctx);
+			decNumberSubtract(&z, den+i, &y, &ctx);
+			decNumberMultiply(&y, &z, &c, &ctx);
+			decNumberAdd(num+i-1, num+i-1, &y, &ctx);
+		}
+	}
+	for (i=0; i<=GAMMA_TERMS; i++) {
+		round_number(num+i, num+i, DFLT);
+		round_number(den+i, den+i, DFLT);
+	}
+	output_table(fm, "gamma_num", num, GAMMA_TERMS+1);
+	output_table(fm, "gamma_den", den, GAMMA_TERMS+1);
+
+	ctx.digits = GAMMA_WORK;
+	for (i=0; i<STIRLING_TERMS; i++) {
+		decNumberFromString(&x, stirling[i].num, &ctx);
+		decNumberFromString(&y, stirling[i].den, &ctx);
+		decNumberDivide(&x, &x, &y, &ctx);
+		round_number(tbl+i, &x, DFLT);
+	}
+	output_table(fm, "gamma_stirling", tbl, STIRLING_TERMS);
+
+	// Factorials and gamma of half integers, products are exact at full precision
+	ctx.digits = DECNUMDIGITS;
+	int_to_number(&x, 1, &ctx);
+	for (j=0; j<GAMMA_TABLE_SIZE * GAMMA_TABLE_STEP; j++) {
+		if (j % GAMMA_TABLE_STEP == 0)
+			round_number(tbl + j / GAMMA_TABLE_STEP, &x, DFLT);
+		int_to_number(&y, j+1, &ctx);
+		decNumberMultiply(&x, &x, &y, &ctx);
+	}
+	output_table(fm, "gamma_fact", tbl, GAMMA_TABLE_SIZE);
+
+	ctx.digits = GAMMA_WORK;
+	decNumberFromString(&x, const_value("PI"), &ctx);
+	decNumberSquareRoot(&x, &x, &ctx);
+	decNumberFromString(&z, "0.5", &ctx);
+	for (j=0; j<GAMMA_TABLE_SIZE * GAMMA_TABLE_STEP; j++) {
+		if (j % GAMMA_TABLE_STEP == 0)
+			round_number(tbl + j / GAMMA_TABLE_STEP, &x, DFLT);
+		int_to_number(&y, j, &ctx);
+		decNumberAdd(&y, &y, &z, &ctx);
+		decNumberMultiply(&x, &x, &y, &ctx);
+	}
+	output_table(fm, "gamma_half", tbl, GAMMA_TABLE_SIZE);
+}
+
+/* Coefficients of Temme's uniform expansion of the incomplete gamma function
+ *	Q(a, x) = erfc(eta sqrt(a/2)) / 2 + exp(-a eta^2/2) / sqrt(2 PI a) sum c_k(eta) / a^k
+ * for large a in decn.c.  With x/a = 1 + mu and eta^2 / 2 = mu - ln(1+mu),
+ * mu = sum a_m eta^m follows from mu mu' = eta (1+mu).  Then u = eta / mu
+ * gives c_0 = (u - 1) / eta and c_k = c_(k-1)' / eta + (-1)^k g_k / mu where
+ * the Stirling coefficient g_k just cancels the pole at zero.  The first
+ * IGAMMA_TEMME_N terms of each power series suffice for |eta| below 0.35.
+ */
+#define IGAMMA_TEMME_K		16
+#define IGAMMA_TEMME_N		40
+#define IGAMMA_TEMME_M		(IGAMMA_TEMME_N + 2 * IGAMMA_TEMME_K + 2)
+
+static void const_igamma(FILE *fm) {
+	static decNumber a[IGAMMA_TEMME_M], u[IGAMMA_TEMME_M], c[IGAMMA_TEMME_M];
+	static decNumber tbl[IGAMMA_TEMME_K * IGAMMA_TEMME_N];
+	decNumber s, t, x;
+	decContext ctx;
+	int i, k, m, n, len;
+
+	decContextDefault(&ctx, DEC_INIT_BASE);
+	ctx.digits = GAMMA_WORK;
+	ctx.emax=DEC_MAX_MATH;
+	ctx.emin=-DEC_MAX_MATH;
+	ctx.round = DEC_ROUND_HALF_EVEN;
+
+	fprintf(fh, "\n#define IGAMMA_TEMME_K %d\n#define IGAMMA_TEMME_N %d\n",
+			IGAMMA_TEMME_K, IGAMMA_TEMME_N);
+
+	// (m+1) a_m = a_(m-1) - sum (m+1-i) a_i a_(m+1-i) for i from 2 to m-1
+	decNumberZero(a);
+	int_to_number(a+1, 1, &ctx);
+	for (m=2; m<IGAMMA_TEMME_M; m++) {
+		decNumberCopy(&s, a+m-1);
+		for (i=2; i<m; i++) {
+			int_to_number(&x, m+1-i, &ctx);
+			decNumberMultiply(&t, a+i, a+m+1-i, &ctx);
+			decNumberMultiply(&t, &t, &x, &ctx);
+			decNumberSubtract(&s, &s, &t, &ctx);
+		}
+		int_to_number(&x, m+1, &ctx);
+		decNumberDivide(a+m, &s, &x, &ctx);
+	}
+
+	// u = eta / mu = 1 / (a_1 + a_2 eta + ...)
+	int_to_number(u, 1, &ctx);
+	for (n=1; n<IGAMMA_TEMME_M-1; n++) {
+		decNumberZero(&s);
+		for (i=1; i<=n; i++) {
+			decNumberMultiply(&t, a+i+1, u+n-i, &ctx);
+			decNumberSubtract(&s, &s, &t, &ctx);
+		}
+		decNumberCopy(u+n, &s);
+	}
+
+	// Each c_k in place from c_(k-1), two terms shorter every time
+	len = IGAMMA_TEMME_M - 2;
+	for (n=0; n<len; n++)
+		decNumberCopy(c+n, u+n+1);
+	for (k=0; k<IGAMMA_TEMME_K; k++) {
+		if (k > 0) {
+			decNumberCopy(&x, c+1);
+			len -= 2;
+			for (n=0; n<len; n++) {
+				int_to_number(&t, n+2, &ctx);
+				decNumberMultiply(&s, c+n+2, &t, &ctx);
+				decNumberMultiply(&t, &x, u+n+1, &ctx);
+				decNumberSubtract(c+n, &s, &t, &ctx);
+			}
+		}
+		for (n=0; n<IGAMMA_TEMME_N; n++)
+			round_number(tbl + k * IGAMMA_TEMME_N + n, c+n, DFLT);
+	}
+	output_table(fm, "igamma_temme", tbl, IGAMMA_TEMME_K * IGAMMA_TEMME_N);
+}
+
 static void const_big(void) {
 	int n;
 	decNumber x, y;
@@ -511,6 +875,9 @@ static void const_big(void) {
 
 		output(fm, cnsts[n].name, &y);
 	}
+	const_sincos(fm);
+	const_gamma(fm);
+	const_igamma(fm);
 	fprintf(fm, "\n\n.SILENT: $(OBJS)\n\n"
 			"all: $(OBJS)\n"
 			"\t@rm -f ../%slibconsts.a\n"
@@ -21,6 +21,10 @@
 #include <stdio.h>
 #include <ctype.h>
 #include <string.h>
+#include <time.h>
+#if !defined(WIN32) || defined(__GNUC__)
+#include <sys/time.h>
+#endif
 
 #include "xeq.h" 
 #include "keys.h"
@@ -32,17 +36,25 @@
 
 #include "catalogues.h"
 
+#ifdef INCLUDE_THREAD_INSTANCES
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 
 #define CH_QUIT		'Q'
 #define CH_TRACE	'T'
 #define CH_FLAGS	'F'
 #define CH_ICOUNT	'C'
+#define CH_PROFILE	'P'
 #define CH_REFRESH	12	/* ^L */
 #define CH_COPY		'X'
 #define CH_PASTE	'V'
 
-unsigned long long int instruction_count = 0;
+INSTANCE unsigned long long int instruction_count = 0;
 int view_instruction_counter = 0;
+INSTANCE int headless_mode = 0;
+INSTANCE unsigned int headless_error = ERR_NONE;
 
 /*
  *  PC keys to calculator keys
@@ -478,8 +490,681 @@ static unsigned int dump_commands(int silent) {
 }
 
 
+/*
+ *  Headless batch execution
+ *
+ *  calc run <label> [file]
+ *  calc profile <label> [file] [report]
+ *
+ *  <file> is either a state file or a .wp34s source which is assembled
+ *  into an otherwise cleared calculator.  <label> is a numeric label,
+ *  one of A to D, an alpha label of up to three characters or an XROM
+ *  entry point written as x:NAME (see the xrom dump for the names).
+ *  The program is run to completion without a tty or display and the
+ *  stack, L, I and the non zero global registers are printed.  The state file is not written back.
+ *  'profile' runs the program with the execution profiler (see below) and
+ *  writes its report to stdout or the given file.
+ */
+static double wall_clock(void) {
+#if defined(WIN32) && !defined(__GNUC__)
+	return (double) clock() / CLOCKS_PER_SEC;
+#elif defined(WIN32) || !defined(CLOCK_MONOTONIC)
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec + tv.tv_usec * 1e-6;
+#else
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+#endif
+}
+
+/* Find the opcode whose handler is the given XROM entry point */
+static opcode xrom_entry_opcode(unsigned int address) {
+	const void *const fp = xrom + address - XROM_START;
+	unsigned int i;
+
+	for (i=0; i<NUM_NILADIC; i++)
+		if ((const void *) niladics[i].niladicf == fp)
+			return OP_NIL | i;
+	for (i=0; i<NUM_MONADIC; i++) {
+		if ((const void *) monfuncs[i].mondreal == fp || (const void *) monfuncs[i].monint == fp)
+			return OP_MON | i;
+		if ((const void *) monfuncs[i].mondcmplx == fp)
+			return OP_CMON | i;
+	}
+	for (i=0; i<NUM_DYADIC; i++) {
+		if ((const void *) dyfuncs[i].dydreal == fp || (const void *) dyfuncs[i].dydint == fp)
+			return OP_DYA | i;
+		if ((const void *) dyfuncs[i].dydcmplx == fp)
+			return OP_CDYA | i;
+	}
+	for (i=0; i<NUM_TRIADIC; i++)
+		if ((const void *) trifuncs[i].trireal == fp || (const void *) trifuncs[i].triint == fp)
+			return OP_TRI | i;
+	return OP_NIL | OP_NOP;
+}
+
+static int label_opcode(const char *label, opcode *op) {
+	unsigned int i, n;
+
+	if (label[0] == 'x' && label[1] == ':') {
+		for (i=0; i<num_xrom_entry_points; i++)
+			if (strcmp(label + 2, xrom_entry_points[i].name) == 0) {
+				*op = xrom_entry_opcode(xrom_entry_points[i].address);
+				return *op != (OP_NIL | OP_NOP);
+			}
+		return 0;
+	}
+	if (isdigit(label[0])) {
+		n = atoi(label);
+		if (n >= 100)
+			return 0;
+		*op = RARG(RARG_XEQ, n);
+		return 1;
+	}
+	if (label[0] >= 'A' && label[0] <= 'D' && label[1] == '\0') {
+		*op = RARG(RARG_XEQ, 100 + label[0] - 'A');
+		return 1;
+	}
+	n = strlen(label);
+	if (n == 0 || n > 3)
+		return 0;
+	*op = OP_DBL + (DBL_XEQ << DBL_SHIFT);
+	for (i=0; i<n; i++)
+		*op |= (label[i] & 0xff) << (i == 0 ? 0 : 8 + 8 * i);
+	return 1;
+}
+
+static void print_reg(FILE *f, const char *name, int index, int zero) {
+	char buf[64];
+
+	if (is_intmode())
+		sprintf(buf, "%lld", get_reg_n_int(index));
+	else if (is_dblmode())
+		decimal128ToString(&(get_reg_n(index)->d), buf);
+	else
+		decimal64ToString(&(get_reg_n(index)->s), buf);
+	if (zero || strcmp(buf, "0") != 0)
+		fprintf(f, "%s: %s\n", name, buf);
+}
+
+/*
+ *  Execution profiler
+ *
+ *  While profile_mode is set xeq() reports every instruction it executes.
+ *  Count, inclusive and self time are kept per opcode, count and self time
+ *  per program step.  Nested instructions (XROM code, the functions called
+ *  by the solver or integrator) are charged to their own opcode and step
+ *  and only add to the inclusive time of the instruction that called them.
+ *  Steps in XROM are also summed up per XLBL routine.
+ *
+ *  The report is sorted by self time.  It goes to stdout or a file for
+ *  'calc profile', to PROFILE_FILE for the interactive CH_PROFILE toggle.
+ *  A file name ending in .csv gives comma separated values.
+ */
+int profile_mode = 0;
+
+#define PROFILE_OPS	4096		/* Distinct opcodes, power of two */
+#define PROFILE_DEPTH	32		/* Nesting of xeq() calls timed */
+#define PROFILE_FILE	"wp34s-profile.txt"
+
+struct profile_entry {
+	opcode op;			// opcode, address or XLBL index
+	int used;
+	unsigned long long int count;
+	double total, self;
+};
+
+static struct profile_entry ProfileOps[PROFILE_OPS];
+static struct profile_entry ProfileSteps[65536];
+static unsigned int ProfileOpsUsed;
+
+static struct {
+	struct profile_entry *op;
+	int pc;
+	double start, nested;
+} ProfileStack[PROFILE_DEPTH];
+static int ProfileDepth;
+static int ProfilePc = -1;
+static double ProfileStart;
+
+static void profile_clear(void) {
+	xset(ProfileOps, 0, sizeof(ProfileOps));
+	xset(ProfileSteps, 0, sizeof(ProfileSteps));
+	ProfileOpsUsed = 0;
+	ProfileDepth = 0;
+	ProfilePc = -1;
+	ProfileStart = wall_clock();
+}
+
+static struct profile_entry *profile_find(opcode op) {
+	unsigned int i = (op * 2654435761u) >> 20;
+
+	for (;;) {
+		struct profile_entry *const e = ProfileOps + (i++ & (PROFILE_OPS - 1));
+
+		if (e->used && e->op == op)
+			return e;
+		if (! e->used) {
+			if (ProfileOpsUsed >= PROFILE_OPS * 3 / 4)
+				return NULL;
+			++ProfileOpsUsed;
+			e->used = 1;
+			e->op = op;
+			return e;
+		}
+	}
+}
+
+/* The next instruction comes from program step pc */
+void profile_step(unsigned int pc) {
+	ProfilePc = pc;
+}
+
+void profile_begin(opcode op) {
+	if (ProfileDepth < PROFILE_DEPTH) {
+		ProfileStack[ProfileDepth].op = profile_find(op);
+		ProfileStack[ProfileDepth].pc = ProfilePc;
+		ProfileStack[ProfileDepth].nested = 0;
+		ProfileStack[ProfileDepth].start = wall_clock();
+	}
+	ProfilePc = -1;
+	++ProfileDepth;
+}
+
+void profile_end(void) {
+	const double now = wall_clock();
+	double elapsed, self;
+
+	if (--ProfileDepth >= PROFILE_DEPTH || ProfileDepth < 0) {
+		if (ProfileDepth < 0)
+			ProfileDepth = 0;
+		return;
+	}
+	elapsed = now - ProfileStack[ProfileDepth].start;
+	self = elapsed - ProfileStack[ProfileDepth].nested;
+	if (ProfileStack[ProfileDepth].op != NULL) {
+		struct profile_entry *const e = ProfileStack[ProfileDepth].op;
+		e->count++;
+		e->total += elapsed;
+		e->self += self;
+	}
+	if (ProfileStack[ProfileDepth].pc >= 0) {
+		struct profile_entry *const e = ProfileSteps + ProfileStack[ProfileDepth].pc;
+		e->count++;
+		e->total += elapsed;
+		e->self += self;
+	}
+	if (ProfileDepth > 0)
+		ProfileStack[ProfileDepth - 1].nested += elapsed;
+}
+
+/* Program text of an opcode with the special characters spelled out */
+static const char *profile_op_name(opcode op, char *buf) {
+	char instr[16];
+	const char *p = prt(op, instr);
+	char *q = buf;
+
+	if (op == RARG(RARG_ALPHA, ' '))
+		strcpy(instr+2, "[space]");
+	while (*p != '\0') {
+		const char c = *p++;
+		const char *const s = pretty(c);
+
+		if (s == NULL)
+			*q++ = c;
+		else if (strcmp("narrow-space", s) == 0 && *p == c) {
+			*q++ = ' ';
+			p++;
+		}
+		else
+			q += sprintf(q, "[%s]", s);
+	}
+	*q = '\0';
+	return buf;
+}
+
+/* Index of the XLBL routine containing an XROM address or -1 */
+static int profile_xrom_routine(unsigned int pc) {
+	unsigned int i, best = 0;
+	int n = -1;
+
+	for (i=0; i<num_xrom_entry_points; i++) {
+		const unsigned int a = addrXROM(xrom_entry_points[i].address);
+		if (a <= pc && a >= best) {
+			best = a;
+			n = i;
+		}
+	}
+	return n;
+}
+
+static const char *profile_step_name(unsigned int pc, char *buf) {
+	static const char *const regions[] = { "RAM", "LIB", "BUP" };
+
+	if (isXROM(pc)) {
+		const int n = profile_xrom_routine(pc);
+		if (n < 0)
+			sprintf(buf, "XROM %04x", pc);
+		else
+			sprintf(buf, "XROM %s+%u", xrom_entry_points[n].name,
+					pc - addrXROM(xrom_entry_points[n].address));
+	}
+	else
+		sprintf(buf, "%s %03u", regions[nLIB(pc)], user_pc(pc));
+	return buf;
+}
+
+static int profile_compare(const void *a, const void *b) {
+	const struct profile_entry *const x = *(const struct profile_entry *const *) a;
+	const struct profile_entry *const y = *(const struct profile_entry *const *) b;
+
+	return x->self < y->self ? 1 : x->self > y->self ? -1 : 0;
+}
+
+static int profile_sort(struct profile_entry *table, int size, struct profile_entry **list) {
+	int i, n = 0;
+
+	for (i=0; i<size; i++)
+		if (table[i].count != 0)
+			list[n++] = table + i;
+	qsort(list, n, sizeof(*list), &profile_compare);
+	return n;
+}
+
+static void profile_csv_string(FILE *f, const char *s) {
+	putc('"', f);
+	for (; *s != '\0'; s++) {
+		if (*s == '"')
+			putc('"', f);
+		putc(*s, f);
+	}
+	putc('"', f);
+}
+
+static void profile_report(FILE *f, int csv) {
+	static struct profile_entry *list[65536];
+	static struct profile_entry routines[sizeof(xrom_entry_points) / sizeof(*xrom_entry_points) + 1];
+	const double elapsed = wall_clock() - ProfileStart;
+	unsigned long long int total = 0;
+	char name[100], where[100];
+	int i, n;
+
+	xset(routines, 0, sizeof(routines));
+	for (i=0; i<65536; i++)
+		if (ProfileSteps[i].count != 0 && isXROM(i)) {
+			struct profile_entry *const r = routines + profile_xrom_routine(i) + 1;
+			r->op = i;
+			r->count += ProfileSteps[i].count;
+			r->total += ProfileSteps[i].total;
+			r->self += ProfileSteps[i].self;
+		}
+	for (i=0; i<PROFILE_OPS; i++)
+		total += ProfileOps[i].count;
+
+	if (csv)
+		fprintf(f, "table,count,total_s,self_s,address,name\n");
+	else
+		fprintf(f, "\nOpcode profile: %llu instructions in %.6f s\n"
+			   "%12s %12s %12s %6s  %s\n", total, elapsed, "count", "total s", "self s", "self%", "opcode");
+	n = profile_sort(ProfileOps, PROFILE_OPS, list);
+	for (i=0; i<n; i++) {
+		profile_op_name(list[i]->op, name);
+		if (csv) {
+			fprintf(f, "opcode,%llu,%.9f,%.9f,%04x,", list[i]->count, list[i]->total, list[i]->self, (unsigned int) list[i]->op);
+			profile_csv_string(f, name);
+			putc('\n', f);
+		}
+		else
+			fprintf(f, "%12llu %12.6f %12.6f %5.1f%%  %s\n", list[i]->count, list[i]->total, list[i]->self,
+					elapsed > 0 ? 100 * list[i]->self / elapsed : 0, name);
+	}
+
+	if (! csv)
+		fprintf(f, "\nStep profile\n%12s %12s %12s %6s  %-4s  %-20s %s\n",
+			"count", "total s", "self s", "self%", "addr", "step", "opcode");
+	n = profile_sort(ProfileSteps, 65536, list);
+	for (i=0; i<n; i++) {
+		const unsigned int pc = list[i] - ProfileSteps;
+
+		profile_op_name(getprog(pc), name);
+		profile_step_name(pc, where);
+		if (csv) {
+			fprintf(f, "step,%llu,%.9f,%.9f,%04x,", list[i]->count, list[i]->total, list[i]->self, pc);
+			strcat(where, " ");
+			profile_csv_string(f, strcat(where, name));
+			putc('\n', f);
+		}
+		else
+			fprintf(f, "%12llu %12.6f %12.6f %5.1f%%  %04x  %-20s %s\n", list[i]->count, list[i]->total,
+					list[i]->self, elapsed > 0 ? 100 * list[i]->self / elapsed : 0, pc, where, name);
+	}
+
+	n = profile_sort(routines, sizeof(routines) / sizeof(*routines), list);
+	if (n > 0 && ! csv)
+		fprintf(f, "\nXROM routine profile (self time of their steps)\n%12s %12s %6s  %s\n",
+			"steps", "self s", "self%", "routine");
+	for (i=0; i<n; i++) {
+		const int r = list[i] - routines - 1;
+		const char *const s = r < 0 ? "(no XLBL)" : xrom_entry_points[r].name;
+		if (csv) {
+			fprintf(f, "xrom,%llu,%.9f,%.9f,%04x,", list[i]->count, list[i]->total, list[i]->self,
+					r < 0 ? addrXROM(0) : addrXROM(xrom_entry_points[r].address));
+			profile_csv_string(f, s);
+			putc('\n', f);
+		}
+		else
+			fprintf(f, "%12llu %12.6f %5.1f%%  %s\n", list[i]->count, list[i]->self,
+					elapsed > 0 ? 100 * list[i]->self / elapsed : 0, s);
+	}
+}
+
+/* Write the report to a file, stdout for "-" */
+static int profile_write(const char *file) {
+	const int n = strlen(file);
+	FILE *f = stdout;
+
+	if (strcmp(file, "-") != 0 && (f = fopen(file, "w")) == NULL) {
+		perror(file);
+		return 1;
+	}
+	profile_report(f, n > 4 && strcmp(file + n - 4, ".csv") == 0);
+	if (f != stdout)
+		fclose(f);
+	return 0;
+}
+
+#ifdef INCLUDE_THREAD_INSTANCES
+/* The assembler's work files are shared by all threads */
+static pthread_mutex_t ImportLock = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+/* Load a state file or assemble a .wp34s source into RAM
+ */
+static int load_batch_file(const char *file) {
+	const int n = strlen(file);
+
+	if (n > 6 && strcmp(file + n - 6, ".wp34s") == 0) {
+#ifdef INCLUDE_THREAD_INSTANCES
+		pthread_mutex_lock(&ImportLock);
+#endif
+		init_34s();
+		import_textfile(file);
+#ifdef INCLUDE_THREAD_INSTANCES
+		pthread_mutex_unlock(&ImportLock);
+#endif
+		if (ProgSize == 0) {
+			fprintf(stderr, "nothing imported from %s\n", file);
+			return 2;
+		}
+	}
+	else
+		load_statefile(file);
+	return 0;
+}
+
+static int run_batch(const char *label, const char *file, const char *report, FILE *out) {
+	char name[8];
+	opcode op;
+	double start, elapsed;
+	unsigned int i;
+
+	if (! label_opcode(label, &op)) {
+		fprintf(stderr, "bad label %s\n", label);
+		return 2;
+	}
+	headless_mode = 1;
+	if (file != NULL && load_batch_file(file))
+		return 2;
+	init_state();
+	State2.runmode = 1;
+	instruction_count = 0;
+	headless_error = ERR_NONE;
+	if (report != NULL) {
+		profile_clear();
+		profile_mode = 1;
+	}
+#ifdef INCLUDE_DECNUMBER_ARENA
+	decArenaAllocs = decArenaHeap = decArenaHigh = 0;
+#endif
+#ifdef INCLUDE_RESULT_CACHE
+	result_cache_clear();
+#endif
+
+	start = wall_clock();
+	xeq(op);
+	while ((Running || Pause) && headless_error == ERR_NONE) {
+		if (Pause) {
+			// No one is watching, skip the pause
+			Pause = 0;
+			xeq_xrom();
+		}
+		xeqprog();
+	}
+	elapsed = wall_clock() - start;
+	profile_mode = 0;
+
+	for (i=0; i<(unsigned int) stack_size(); i++) {
+		sprintf(name, "%c", REGNAMES[i]);
+		print_reg(out, name, regX_idx + i, 1);
+	}
+	print_reg(out, "L", regL_idx, 1);
+	print_reg(out, "I", regI_idx, 1);
+	for (i=0; i<global_regs(); i++) {
+		sprintf(name, "R%02u", i);
+		print_reg(out, name, i, 0);
+	}
+	if (headless_error != ERR_NONE) {
+		const opcode eop = RARG(RARG_ERROR, headless_error & RARG_MASK);
+		for (i=0; i<num_xrom_labels && xrom_labels[i].op != eop; i++);
+		fprintf(out, "error %u%s%s\n", headless_error, i<num_xrom_labels ? " " : "",
+				i<num_xrom_labels ? xrom_labels[i].name : "");
+	}
+	fprintf(out, "instructions: %llu\n", instruction_count);
+#ifdef INCLUDE_DECNUMBER_ARENA
+	fprintf(out, "arena: %u temporaries, %u from the heap, %u bytes peak\n",
+			decArenaAllocs, decArenaHeap, decArenaHigh);
+#endif
+#ifdef INCLUDE_RESULT_CACHE
+	fprintf(out, "cache: %u hits, %u misses\n", ResultCacheHits, ResultCacheMisses);
+#endif
+	fprintf(out, "time: %.6f s\n", elapsed);
+	if (elapsed > 0)
+		fprintf(out, "throughput: %.0f steps/s\n", instruction_count / elapsed);
+	if (report != NULL && profile_write(report))
+		return 2;
+	return headless_error != ERR_NONE;
+}
+
+#ifdef INCLUDE_COMPILED_PROGRAMS
+/*
+ *  Ahead of time translation: 'calc translate ram|lib [file] [out.c]'
+ *
+ *  Writes C code that runs the steps of a program region one after the
+ *  other.  Every step is handed to xeq() by xeq_compiled(), so errors,
+ *  stack lift and last X behave exactly as in the interpreter.  Pairs the
+ *  interpreter fuses are left to xeq_compiled_pair().  Going on
+ *  with the next step is a plain jump in C, branches, skips and returns
+ *  go through a switch on the program counter.  END statements and the
+ *  last step are left to the interpreter.  The result is linked into the
+ *  console emulator with 'make AOT=out.c' and is used for as long as the
+ *  region holds exactly the translated code.
+ */
+static int translate(const char *region_name, const char *file, const char *out) {
+	FILE *f = stdout;
+	int region, size, offset, width;
+	char name[64], step[16];
+
+	if (strcmp(region_name, "ram") == 0)
+		region = REGION_RAM;
+	else if (strcmp(region_name, "lib") == 0)
+		region = REGION_LIBRARY;
+	else {
+		fprintf(stderr, "bad region %s, use ram or lib\n", region_name);
+		return 2;
+	}
+	if (file != NULL && load_batch_file(file))
+		return 2;
+	size = sizeLIB(region);
+	if (out != NULL && strcmp(out, "-") != 0) {
+		f = fopen(out, "w");
+		if (f == NULL) {
+			perror(out);
+			return 2;
+		}
+	}
+
+	fprintf(f, "/* Translated from %s by 'calc translate', do not edit */\n\n",
+			file != NULL ? file : "the saved state");
+	fprintf(f, "#include \"xeq.h\"\n\n");
+	fprintf(f, "#define STEP(next, op)\tif (++n, xeq_compiled(next, op) || n >= steps) continue\n");
+	fprintf(f, "#define PAIR(next)\tif (n += 2, xeq_compiled_pair(next) || n >= steps) continue; else goto S##next\n\n");
+	fprintf(f, "static int run(const int steps)\n{\n\tint n = 0;\n\n");
+	fprintf(f, "\twhile (n < steps && Running && ! Pause) {\n");
+	fprintf(f, "\t\tswitch (state_pc()) {\n");
+	for (offset = 0; offset < size; offset += width) {
+		const unsigned int pc = addrLIB(offset + 1, region);
+		const opcode op = getprog(pc);
+
+		width = 1 + isDBL(op);
+		if (op != (OP_NIL | OP_END) && offset + width < size)
+			fprintf(f, "\t\tcase %u:\tgoto S%u;\n", pc, pc);
+	}
+	fprintf(f, "\t\tdefault:\treturn n;\n\t\t}\n\n");
+	for (offset = 0; offset < size; offset += width) {
+		const unsigned int pc = addrLIB(offset + 1, region);
+		const opcode op = getprog(pc);
+		char *p;
+
+		width = 1 + isDBL(op);
+		profile_op_name(op, name);
+		while ((p = strstr(name, "*/")) != NULL)
+			*p = '+';
+		profile_step_name(pc, step);
+		if (op != (OP_NIL | OP_END) && offset + width < size) {
+			const opcode second = getprog(addrLIB(offset + width + 1, region));
+			const int pair = width + 1 + isDBL(second);
+
+			if (offset + pair < size && second != (OP_NIL | OP_END) && is_fused_pair(op, second))
+				fprintf(f, "S%u:\t\tPAIR(%u);\t/* %s %s */\n",
+						pc, addrLIB(offset + pair + 1, region), step, name);
+			else
+				fprintf(f, "S%u:\t\tSTEP(%u, 0x%04x);\t/* %s %s */\n",
+						pc, addrLIB(offset + width + 1, region), op, step, name);
+		}
+		else
+			fprintf(f, "S%u:\t\treturn n;\t/* %s %s */\n", pc, step, name);
+	}
+	fprintf(f, "\t}\n\treturn n;\n}\n\n");
+	fprintf(f, "const struct compiled_program CompiledProgram = {\n");
+	fprintf(f, "\t%s, %d, 0x%04x, &run\n};\n",
+			region == REGION_RAM ? "REGION_RAM" : "REGION_LIBRARY", size, region_crc(region));
+	if (f != stdout)
+		fclose(f);
+	return 0;
+}
+#endif
+
+#ifdef INCLUDE_THREAD_INSTANCES
+/*
+ *  Batch jobs in parallel: 'calc parallel <label> <file>...'
+ *
+ *  Every thread of the pool owns a complete calculator.  A thread starts
+ *  each job from the saved state like a fresh 'calc run' would and writes
+ *  the report to a temporary file.  The reports are printed in the order
+ *  of the files once all jobs are done.
+ */
+struct batch_job {
+	const char *file;
+	FILE *out;
+	int rc;
+};
+
+static struct {
+	pthread_mutex_t lock;
+	const char *label;
+	struct batch_job *jobs;
+	int count, next;
+} Batch = { PTHREAD_MUTEX_INITIALIZER };
+
+static void *batch_thread(void *arg) {
+	for (;;) {
+		struct batch_job *job;
+
+		pthread_mutex_lock(&Batch.lock);
+		job = Batch.next < Batch.count ? Batch.jobs + Batch.next++ : NULL;
+		pthread_mutex_unlock(&Batch.lock);
+		if (job == NULL)
+			return NULL;
+
+		xeq_init_contexts();
+		load_statefile(NULL);
+		job->rc = run_batch(Batch.label, job->file, NULL, job->out);
+		fflush(job->out);
+	}
+}
+
+static int run_parallel(const char *label, int count, char *files[]) {
+	pthread_t threads[64];
+	int nthreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	int i, c, rc = 0;
+
+	if (nthreads > count)
+		nthreads = count;
+	if (nthreads > (int) (sizeof(threads) / sizeof(threads[0])))
+		nthreads = sizeof(threads) / sizeof(threads[0]);
+	if (nthreads < 1)
+		nthreads = 1;
+
+	Batch.label = label;
+	Batch.count = count;
+	Batch.next = 0;
+	Batch.jobs = (struct batch_job *) calloc(count, sizeof(struct batch_job));
+	if (Batch.jobs == NULL)
+		return 2;
+	for (i = 0; i < count; i++) {
+		Batch.jobs[i].file = files[i];
+		Batch.jobs[i].out = tmpfile();
+		if (Batch.jobs[i].out == NULL) {
+			perror("tmpfile");
+			return 2;
+		}
+	}
+
+	for (i = 0; i < nthreads; i++)
+		if (pthread_create(threads + i, NULL, &batch_thread, NULL) != 0) {
+			nthreads = i;
+			break;
+		}
+	if (nthreads == 0)
+		batch_thread(NULL);
+	for (i = 0; i < nthreads; i++)
+		pthread_join(threads[i], NULL);
+
+	for (i = 0; i < count; i++) {
+		printf("== %s\n", files[i]);
+		rewind(Batch.jobs[i].out);
+		while ((c = getc(Batch.jobs[i].out)) != EOF)
+			putchar(c);
+		fclose(Batch.jobs[i].out);
+		if (Batch.jobs[i].rc > rc)
+			rc = Batch.jobs[i].rc;
+	}
+	free(Batch.jobs);
+	return rc;
+}
+#endif
+
+
 void shutdown( void )
 {
+	if (profile_mode) {
+		profile_mode = 0;
+		profile_write(PROFILE_FILE);
+	}
 	checksum_all();
 	setuptty( 1 );
 	save_statefile( NULL );
@@ -548,6 +1233,10 @@ void flush_comm( void )
 
 
 
+#ifdef COMPILED_PROGRAM
+extern const struct compiled_program CompiledProgram;
+#endif
+
 /*
  *  Main loop
  */
@@ -557,6 +1246,21 @@ int main(int argc, char *argv[]) {
 
 	xeq_init_contexts();
 	load_statefile( NULL );
+#ifdef COMPILED_PROGRAM
+	set_compiled_program(&CompiledProgram);
+#endif
+	if (argc > 2 && strcmp(argv[1], "run") == 0)
+		return run_batch(argv[2], argc > 3 ? argv[3] : NULL, NULL, stdout);
+	if (argc > 2 && strcmp(argv[1], "profile") == 0)
+		return run_batch(argv[2], argc > 3 ? argv[3] : NULL, argc > 4 ? argv[4] : "-", stdout);
+#ifdef INCLUDE_COMPILED_PROGRAMS
+	if (argc > 2 && strcmp(argv[1], "translate") == 0)
+		return translate(argv[2], argc > 3 ? argv[3] : NULL, argc > 4 ? argv[4] : NULL);
+#endif
+#ifdef INCLUDE_THREAD_INSTANCES
+	if (argc > 3 && strcmp(argv[1], "parallel") == 0)
+		return run_parallel(argv[2], argc - 3, argv + 3);
+#endif
 	if (argc > 1) {
 		if (argc == 2) {
 			if (strcmp(argv[1], "commands") == 0) {
@@ -678,6 +1382,16 @@ skipargs:
 				instruction_count = 0;
 				view_instruction_counter = 1 - view_instruction_counter;
 				display();
+			} else if (c == CH_PROFILE) {
+				// Start profiling or stop and write the report
+				if (profile_mode) {
+					profile_mode = 0;
+					profile_write(PROFILE_FILE);
+				}
+				else {
+					profile_clear();
+					profile_mode = 1;
+				}
 			} else if (c == CH_PASTE) {
 				paste_raw_x("123.14159265358979323846264338327950\n"
 						"9.876543210987654321e123;"
@@ -240,6 +240,10 @@ static Int         decGetDigits(Unit *, Int);
 /*static*/ Int	   decGetInt(const decNumber *);
 //static decNumber * decLnOp(decNumber *, const decNumber *,
 //                              decContext *, uInt *);
+#if DECKARATSUBA
+static void        decKaratsuba(Unit *, const Unit *, Int, const Unit *,
+                              Int, Unit *);
+#endif
 static decNumber * decMultiplyOp(decNumber *, const decNumber *,
                               const decNumber *, decContext *,
                               uInt *);
@@ -305,6 +309,41 @@ static void xfree(void* a)
 
 #endif // WIN32
 
+#if DECARENA
+#include <stdlib.h>                // for malloc, free when it overflows
+
+// Temporaries are bump allocated from the arena.  Freeing one releases
+// it and everything allocated after it; as storage is only freed on the
+// way out of a routine, the arena is empty again when the top-level
+// operation returns.  If it is exhausted the heap is used instead.
+static INSTANCE uint64_t decArena[(DECARENA+7)/8]; // the arena
+static INSTANCE uInt decArenaUsed=0;  // bytes in use
+INSTANCE uInt decArenaAllocs=0;       // temporaries from the arena
+INSTANCE uInt decArenaHeap=0;         // temporaries from the heap
+INSTANCE uInt decArenaHigh=0;         // most bytes ever in use
+
+static void *decArenaAlloc(size_t n) {
+  uInt used=decArenaUsed;
+  n=(n+7)&~(size_t)7;              // keep the next block aligned
+  if (n<=DECARENA-used) {
+    decArenaUsed=used+n;
+    if (decArenaUsed>decArenaHigh) decArenaHigh=decArenaUsed;
+    decArenaAllocs++;
+    return (uByte *)decArena+used;}
+  decArenaHeap++;
+  return malloc(n);
+  } // decArenaAlloc
+
+static void decArenaFree(void *alloc) {
+  uByte *b=(uByte *)alloc;
+  if (b>=(uByte *)decArena && b<(uByte *)decArena+DECARENA) {
+    if (b<(uByte *)decArena+decArenaUsed)
+      decArenaUsed=b-(uByte *)decArena; // release it and all later ones
+    }
+   else free(alloc);
+  } // decArenaFree
+#endif
+
 /* Diagnostic macros, etc. */
 #if DECALLOC
 // Handle malloc/free accounting.  If enabled, our accountable routines
@@ -322,6 +361,9 @@ uInt decAllocBytes=0;              // count of bytes allocated
 // checked to be 0 at appropriate times (e.g., after the test
 // harness completes a set of tests).  This checking may be unreliable
 // if the testing is done in a multi-thread environment.
+#elif DECARENA
+#define malloc(a) decArenaAlloc(a)
+#define free(a) decArenaFree(a)
 #else
 #ifndef WIN32
 #define malloc(a) __builtin_alloca(a)
@@ -3466,9 +3508,9 @@ static decNumber * decDivideOp(decNumber *res,
 /* C must have space for set->digits digits.                          */
 /*                                                                    */
 /* ------------------------------------------------------------------ */
-/* 'Classic' multiplication is used rather than Karatsuba, as the     */
-/* latter would give only a minor improvement for the short numbers   */
-/* expected to be handled most (and uses much more memory).           */
+/* 'Classic' multiplication is used for the short numbers expected to */
+/* be handled most.  If both operands have DECKARATSUBA digits or     */
+/* more, the 'old code' path hands the exact product to decKaratsuba. */
 /*                                                                    */
 /* There are two major paths here: the general-purpose ('old code')   */
 /* path which handles all DECDPUN values, and a fastpath version      */
@@ -3487,6 +3529,13 @@ static decNumber * decDivideOp(decNumber *res,
 /* of the operand coefficients.                                       */
 /* ------------------------------------------------------------------ */
 #define FASTMUL (DECUSE64 && DECDPUN<5)
+#if DECKARATSUBA
+  // Units below which decKaratsuba stops splitting [at least 4, as
+  // the half sums of shorter operands need not be any shorter], and
+  // the Units of workspace it needs for an n-Unit longer operand
+  #define KARAUNITS (D2U(DECKARATSUBA)<4 ? 4 : D2U(DECKARATSUBA))
+  #define KARAWORK(n) (8*(n)+64)
+#endif
 static decNumber * decMultiplyOp(decNumber *res, const decNumber *lhs,
                                  const decNumber *rhs, decContext *set,
                                  uInt *status) {
@@ -3502,6 +3551,9 @@ static decNumber * decMultiplyOp(decNumber *res, const decNumber *lhs,
   const Unit *mer, *mermsup;       // work
   Int  madlength;                  // Units in multiplicand
   Int  shift;                      // Units to shift multiplicand by
+  #if DECKARATSUBA
+  Unit *allocwork=NULL;            // -> Karatsuba workspace, iff used
+  #endif
 
   #if FASTMUL
     // if DECDPUN is 1 or 3 work in base 10**9, otherwise
@@ -3732,6 +3784,17 @@ static decNumber * decMultiplyOp(decNumber *res, const decNumber *lhs,
         acc=(Unit *)allocacc;                // use the allocated space
         }
 
+      #if DECKARATSUBA
+      if (rhs->digits>=DECKARATSUBA) {       // long enough to split
+        madlength=D2U(lhs->digits);
+        accunits=madlength+D2U(rhs->digits);
+        allocwork=(Unit *)malloc(KARAWORK(madlength)*sizeof(Unit));
+        if (allocwork==NULL) {*status|=DEC_Insufficient_storage; break;}
+        decKaratsuba(acc, lhs->lsu, madlength, rhs->lsu,
+                     D2U(rhs->digits), allocwork);
+        }
+       else {
+      #endif
       /* Now the main long multiplication loop */
       // Unlike the equivalent in the IBM Java implementation, there
       // is no advantage in calculating from msu to lsu.  So, do it
@@ -3757,6 +3820,9 @@ static decNumber * decMultiplyOp(decNumber *res, const decNumber *lhs,
         // multiply multiplicand by 10**DECDPUN for next Unit to left
         shift++;                   // add this for 'logical length'
         } // n
+      #if DECKARATSUBA
+        } // schoolbook
+      #endif
     #if FASTMUL
       } // unchunked units
     #endif
@@ -3786,7 +3852,10 @@ static decNumber * decMultiplyOp(decNumber *res, const decNumber *lhs,
     decFinish(res, set, &residue, status);   // final cleanup
     } while(0);                         // end protected
 
-  if (allocacc!=NULL) free(allocacc);   // drop any storage used
+  #if DECKARATSUBA
+  if (allocwork!=NULL) free(allocwork); // drop any storage used
+  #endif
+  if (allocacc!=NULL) free(allocacc);   // ..
   #if DECSUBSET
   if (allocrhs!=NULL) free(allocrhs);   // ..
   if (alloclhs!=NULL) free(alloclhs);   // ..
@@ -3798,6 +3867,79 @@ static decNumber * decMultiplyOp(decNumber *res, const decNumber *lhs,
   return res;
   } // decMultiplyOp
 
+#if DECKARATSUBA
+/* ------------------------------------------------------------------ */
+/* decKaratsuba -- exact product of two Unit arrays                   */
+/*                                                                    */
+/*   r    is the result, na+nb Units (the top ones may be zero)       */
+/*   a    is the longer operand, na Units                             */
+/*   b    is the shorter operand, nb Units (1<=nb<=na)                */
+/*   work is scratch space for KARAWORK(na) Units                     */
+/*                                                                    */
+/* With B=10**(h*DECDPUN) the operands are split as a=a1*B+a0 and     */
+/* b=b1*B+b0, and the three half-length products                      */
+/*                                                                    */
+/*   z0=a0*b0   z2=a1*b1   z1=(a0+a1)*(b0+b1)-z0-z2                   */
+/*                                                                    */
+/* are formed recursively, giving a*b=z2*B**2+z1*B+z0.  All the       */
+/* intermediates are non-negative, so decUnitAddSub does the adds and */
+/* subtracts.  If b is no longer than half of a, a is cut into pieces */
+/* of b's length instead.  Below KARAUNITS the partial products are   */
+/* accumulated one Unit at a time, exactly as in decMultiplyOp.       */
+/*                                                                    */
+/* r must not overlap a, b, or work.                                  */
+/* ------------------------------------------------------------------ */
+static void decKaratsuba(Unit *r, const Unit *a, Int na,
+                         const Unit *b, Int nb, Unit *work) {
+  Int  h;                          // Units in the low halves
+  Int  i;                          // work
+  Int  la, lb, lz;                 // Units in a0+a1, b0+b1 and z1
+  Unit *sa, *sb, *z1;              // -> a0+a1, b0+b1 and z1 in work
+
+  if (nb<KARAUNITS) {              // short enough for schoolbook
+    Int accunits=1;                // accumulator starts at '0'
+    *r=0;
+    for (i=0; i<nb; i++) {
+      if (b[i]!=0) accunits=decUnitAddSub(&r[i], accunits-i, a, na, 0,
+                                          &r[i], b[i])+i;
+       else r[accunits++]=0;       // extend with a 0, as above
+      }
+    for (; accunits<na+nb; accunits++) r[accunits]=0;
+    return;
+    }
+
+  h=(na+1)/2;
+  if (nb<=h) {                     // unbalanced; cut a into b-sized pieces
+    Unit *t=work;                  // -> product of one piece
+    for (i=0; i<na+nb; i++) r[i]=0;
+    for (i=0; i<na; i+=nb) {
+      Int n=na-i<nb ? na-i : nb;   // Units in this piece
+      if (n==nb) decKaratsuba(t, a+i, n, b, nb, t+2*nb);
+       else decKaratsuba(t, b, nb, a+i, n, t+2*nb);
+      // the sum so far is shorter than B**(i+nb), so this cannot carry
+      decUnitAddSub(&r[i], nb, t, n+nb, 0, &r[i], 1);
+      }
+    return;
+    }
+
+  sa=work;                         // h+1 Units
+  sb=sa+h+1;                       // h+1 Units
+  z1=sb+h+1;                       // 2h+2 Units
+  work=z1+2*h+2;                   // for the recursion
+  decKaratsuba(r, a, h, b, h, work);                  // z0
+  decKaratsuba(r+2*h, a+h, na-h, b+h, nb-h, work);    // z2
+  la=decUnitAddSub(a, h, a+h, na-h, 0, sa, 1);
+  lb=decUnitAddSub(b, h, b+h, nb-h, 0, sb, 1);
+  if (la>=lb) decKaratsuba(z1, sa, la, sb, lb, work);
+   else decKaratsuba(z1, sb, lb, sa, la, work);
+  lz=decUnitAddSub(z1, la+lb, r, 2*h, 0, z1, -1);
+  lz=decUnitAddSub(z1, lz, r+2*h, na+nb-2*h, 0, z1, -1);
+  // drop leading zero Units so that z1*B fits in r
+  for (; lz>1 && z1[lz-1]==0; lz--);
+  decUnitAddSub(r+h, na+nb-h, z1, lz, 0, r+h, 1);
+  } // decKaratsuba
+#endif
+
 /* ------------------------------------------------------------------ */
 /* decExpOp -- effect exponentiation                                  */
 /*                                                                    */
@@ -6640,7 +6782,11 @@ static void *decMalloc(size_t n) {
   uInt  *j;                        // work
   uByte *b, *b0;                   // ..
 
+  #if DECARENA
+  alloc=decArenaAlloc(size);       // -> allocated storage
+  #else
   alloc=malloc(size);              // -> allocated storage
+  #endif
   if (alloc==NULL) return NULL;    // out of strorage
   b0=(uByte *)alloc;               // as bytes
   decAllocBytes+=n;                // account for storage
@@ -6679,7 +6825,11 @@ static void decFree(void *alloc) {
   for (b=b0+n+8; b<b0+n+12; b++) if (*b!=DECFENCE)
     printf("=== Corrupt byte [%02x] at offset +%d from %d, n=%d ===\n", *b,
            b-b0-8, (Int)b0, n);
+  #if DECARENA
+  decArenaFree(b0);                // drop the storage
+  #else
   free(b0);                        // drop the storage
+  #endif
   decAllocBytes-=n;                // account for storage
   // printf(" free -- dAB: %d (%d)\n", decAllocBytes, -n);
   } // decFree
@@ -43,9 +43,12 @@
   // Define the decNumber data structure.  The size and shape of the
   // units array in the structure is determined by the following
   // constant.  This must not be changed without recompiling the
-  // decNumber library modules.
-  #define DECDPUN 3                // DECimal Digits Per UNit [must be in
+  // decNumber library modules.  Hosted builds may set it from the
+  // Makefile (make DECDPUN=9).
+  #if !defined(DECDPUN)
+    #define DECDPUN 3              // DECimal Digits Per UNit [must be in
                                    // range 1-9; 3 or powers of 2 are best].
+  #endif
 
   // DECNUMDIGITS is the default number of digits that can be held in
   // the structure.  If undefined, 1 is assumed and it is assumed that
@@ -143,4 +146,10 @@
   #define decNumberIsSNaN(dn)     (((dn)->bits&(DECSNAN))!=0)
   #define decNumberIsInfinite(dn) (((dn)->bits&DECINF)!=0)
 
+  #if defined(INCLUDE_DECNUMBER_ARENA)
+  // Temporaries served by the arena (heap allocations avoided), those
+  // which still had to use the heap, and the most arena bytes in use
+  extern INSTANCE uint32_t decArenaAllocs, decArenaHeap, decArenaHigh;
+  #endif
+
 #endif
@@ -33,9 +33,37 @@
                               // rounded up to a multiple of 4; must
                               // be zero or positive.
 
+  // Digits in the shorter operand from which multiplication is split
+  // (Karatsuba); 0 for schoolbook only, as in the firmware to save
+  // flash.  The crossover is about 40 Units.
+  #if !defined(DECKARATSUBA)
+    #if defined(REALBUILD) && !defined(HOSTBUILD)
+      #define DECKARATSUBA 0
+    #elif DECDPUN>4
+      #define DECKARATSUBA 300
+    #else
+      #define DECKARATSUBA 150
+    #endif
+  #endif
+
+  // Bytes of arena for temporaries that do not fit the local buffers;
+  // 0 to put them on the stack.
+  #if defined(INCLUDE_DECNUMBER_ARENA)
+    #if !defined(DECARENA)
+      #define DECARENA 65536
+    #endif
+  #else
+    #undef DECARENA
+    #define DECARENA 0
+  #endif
+
   /* Conditional code flags -- set these to 1 for best performance */
   #define DECENDIAN 1         // 1=concrete formats are endian
-  #define DECUSE64  0         // 1 to allow use of 64-bit integers
+  #if DECDPUN>4
+    #define DECUSE64  1       // wide units need 64-bit partial products
+  #else
+    #define DECUSE64  0       // 1 to allow use of 64-bit integers
+  #endif
 
   /* Conditional check flags -- set these to 0 for best performance */
   #define DECCHECK  0         // 1 to enable robust checking
@@ -527,6 +527,13 @@ void decDigitsToDPD(const decNumber *dn, uInt *targ, Int shift) {
       digits-=3;                   // [may go negative]
       inu++;                       // may need another
 
+    #elif DECDPUN==9               // three declets to each unit
+      bin=in%1000;
+      in/=1000;
+      digits-=3;                   // [may go negative]
+      cut+=3;
+      if (cut==DECDPUN && digits>0) {inu++; in=*inu; cut=0;}
+
     #else                          // must collect digit-by-digit
       Unit dig;                    // current digit
       Int j;                       // digit-in-declet count
@@ -599,7 +606,10 @@ void decDigitsFromDPD(decNumber *dn, const uInt *sour, Int declets) {
   const uInt *uin=sour;            // -> current input uInt
   uInt  uoff=0;                    // -> current input offset [from right]
 
-  #if DECDPUN!=3
+  #if DECDPUN==9
+  Unit  out=0;                     // accumulator
+  Int   cut=0;                     // power of ten in current unit
+  #elif DECDPUN!=3
   uInt  bcd;                       // BCD result
   uInt  nibble;                    // work
   Unit  out=0;                     // accumulator
@@ -636,6 +646,17 @@ void decDigitsFromDPD(decNumber *dn, const uInt *sour, Int declets) {
     uout++;
     } // n
 
+  #elif DECDPUN==9
+    // declets hold binary 0-999, three of them to a unit
+    if (dpd!=0 && dpd<1000) out=(Unit)(out+dpd*powers[cut]);
+    cut+=3;
+    if (cut==DECDPUN) {*uout=out; if (out) {last=uout; out=0;} uout++; cut=0;}
+    } // n
+  if (cut!=0) {                         // some more left over
+    *uout=out;                          // write out final unit
+    if (out) last=uout;                 // and note if non-zero
+    }
+
   #else // DECDPUN!=3
     if (dpd==0) {                  // fastpath [e.g., leading zeros]
       // write out three 0 digits (nibbles); out may have digit(s)
@@ -649,7 +670,12 @@ void decDigitsFromDPD(decNumber *dn, const uInt *sour, Int declets) {
       continue;
       }
 
+#if 0
     bcd=DPD2BCD[dpd];              // convert 10 bits to 12 bits BCD
+#else
+    if (dpd>=1000) bcd=0;          // binary 0-999 to 12 bits BCD
+     else bcd=dpd%10 | (dpd/10%10)<<4 | (dpd/100)<<8;
+#endif
 
     // now accumulate the 3 BCD nibbles into units
     nibble=bcd & 0x00f;
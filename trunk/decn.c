@@ -110,17 +110,438 @@ const decNumber *convergence_threshold(void) {
 }
 
 
+#ifdef INCLUDE_BINARY_ARITHMETIC
+/* Finite numbers of up to BIN_DIGITS digits have their coefficient held
+ * in a 128 bit integer.  Sums and products of such numbers are formed
+ * exactly in binary and rounded to Ctx the way decNumber rounds.  Whatever
+ * doesn't fit, or might underflow or overflow, is left to decNumber.
+ */
+#define BIN_DIGITS	38
+#if DECDPUN == 3
+#define BIN_UNIT	1000U
+#elif DECDPUN == 9
+#define BIN_UNIT	1000000000U
+#else
+#define BIN_UNIT	((unsigned int) Pow10[DECDPUN])
+#endif
+#define BIN_SPLIT_UNITS	(18 / DECDPUN)
+#define BIN_SPLIT	Pow10[BIN_SPLIT_UNITS * DECDPUN]
+
+static const unsigned long long int Pow10[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL,
+	10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL,
+	100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+	100000000000000000ULL, 1000000000000000000ULL,
+	10000000000000000000ULL
+};
+
+static bin_coeff bin_pow10(int n) {
+	if (n < 20)
+		return Pow10[n];
+	return (bin_coeff) Pow10[19] * Pow10[n - 19];
+}
+
+static int bin_digits(bin_coeff c) {
+	const unsigned long long int hi = (unsigned long long int) (c >> 64);
+	const unsigned long long int lo = (unsigned long long int) c;
+	int bits, n;
+
+	if (hi != 0)
+		bits = 128 - __builtin_clzll(hi);
+	else if (lo != 0)
+		bits = 64 - __builtin_clzll(lo);
+	else
+		return 1;
+	n = (bits * 1233) >> 12;
+	return n + (c >= bin_pow10(n));
+}
+
+int binnum_from_number(struct binnum *r, const decNumber *x) {
+	int i = (x->digits + DECDPUN - 1) / DECDPUN;
+
+	if ((x->bits & DECSPECIAL) || x->digits > BIN_DIGITS)
+		return 0;
+	if (x->digits < 20) {
+		unsigned long long int v = 0;
+
+		while (i-- > 0)
+			v = v * BIN_UNIT + x->lsu[i];
+		r->c = v;
+	} else {
+		bin_coeff v = 0;
+
+		while (i-- > 0)
+			v = v * BIN_UNIT + x->lsu[i];
+		r->c = v;
+	}
+	r->e = x->exponent;
+	r->digits = x->digits;
+	r->neg = decNumberIsNegative(x) != 0;
+	return 1;
+}
+
+/* Round x to the given number of digits.  Returns non-zero if anything
+ * but zeros was dropped.
+ */
+static int bin_round(struct binnum *x, int digits, enum rounding round) {
+	const int drop = x->digits - digits;
+	const bin_coeff p = bin_pow10(drop);
+	const bin_coeff q = x->c / p;
+	const bin_coeff rem = x->c - q * p;
+	const bin_coeff half = p / 2;
+	int up;
+
+	switch (round) {
+	case DEC_ROUND_CEILING:	up = rem != 0 && ! x->neg;		break;
+	case DEC_ROUND_FLOOR:	up = rem != 0 && x->neg;		break;
+	case DEC_ROUND_UP:	up = rem != 0;				break;
+	case DEC_ROUND_HALF_UP:	up = rem >= half;			break;
+	case DEC_ROUND_HALF_DOWN: up = rem > half;			break;
+	case DEC_ROUND_HALF_EVEN: up = rem > half || (rem == half && (q & 1));	break;
+	default:		up = 0;					break;
+	}
+	x->c = q;
+	x->e += drop;
+	x->digits = digits;
+	if (up && ++x->c == bin_pow10(digits)) {
+		x->c /= 10;
+		x->e++;
+	}
+	return rem != 0;
+}
+
+static decNumber *bin_result(decNumber *r, struct binnum *x) {
+	uint32_t status = 0;
+	unsigned long long int lo;
+	bin_coeff c;
+	int i = 0, k;
+
+	if (x->digits > Ctx.digits)
+		status = bin_round(x, Ctx.digits, Ctx.round) ? (DEC_Inexact | DEC_Rounded) : DEC_Rounded;
+	if (Ctx.clamp || x->e < Ctx.emin || x->e + x->digits - 1 > Ctx.emax)
+		return NULL;
+
+	Ctx.status |= status;
+	r->digits = x->digits;
+	r->exponent = x->e;
+	r->bits = x->neg ? DECNEG : 0;
+	c = x->c;
+	while (c >> 64) {
+		lo = (unsigned long long int) (c % BIN_SPLIT);
+		c /= BIN_SPLIT;
+		for (k = 0; k < BIN_SPLIT_UNITS; k++) {
+			r->lsu[i++] = (decNumberUnit) (lo % BIN_UNIT);
+			lo /= BIN_UNIT;
+		}
+	}
+	lo = (unsigned long long int) c;
+	do {
+		r->lsu[i++] = (decNumberUnit) (lo % BIN_UNIT);
+		lo /= BIN_UNIT;
+	} while (lo != 0);
+	return r;
+}
+
+/* The exact sum or difference, provided both operands still fit once
+ * they have been brought to the same exponent.
+ */
+static int bin_sum(struct binnum *r, const struct binnum *a, const struct binnum *b, int negate) {
+	bin_coeff x, y, s;
+	const int nb = b->neg ^ negate;
+	const int e = a->e < b->e ? a->e : b->e;
+	const int sa = a->e - e, sb = b->e - e;
+
+	if (a->digits + sa > BIN_DIGITS || b->digits + sb > BIN_DIGITS)
+		return 0;
+	if (a->digits + sa < 19 && b->digits + sb < 19) {
+		// Both fit in 64 bits, so does the sum
+		const unsigned long long int u = (unsigned long long int) a->c * Pow10[sa];
+		const unsigned long long int v = (unsigned long long int) b->c * Pow10[sb];
+
+		x = u;
+		y = v;
+		s = a->neg == nb ? u + v : u >= v ? u - v : v - u;
+	} else {
+		x = a->c * bin_pow10(sa);
+		y = b->c * bin_pow10(sb);
+		s = a->neg == nb ? x + y : x >= y ? x - y : y - x;
+	}
+
+	if (a->neg == nb)
+		r->neg = a->neg;
+	else if (x > y)
+		r->neg = a->neg;
+	else if (x < y)
+		r->neg = nb;
+	else
+		r->neg = Ctx.round == DEC_ROUND_FLOOR;
+	r->c = s;
+	r->e = e;
+	r->digits = bin_digits(s);
+	return 1;
+}
+
+static int bin_product(struct binnum *r, const struct binnum *a, const struct binnum *b) {
+	if ((a->c >> 64) || (b->c >> 64))
+		return 0;
+	r->c = (bin_coeff) (unsigned long long int) a->c * (unsigned long long int) b->c;
+	r->e = a->e + b->e;
+	r->digits = bin_digits(r->c);
+	r->neg = a->neg ^ b->neg;
+	return 1;
+}
+
+static decNumber *bin_add(decNumber *r, const decNumber *a, const decNumber *b, int negate) {
+	struct binnum x, y, s;
+
+	// decAddOp() doesn't round operands longer than the precision exactly
+	if (a->digits > Ctx.digits || b->digits > Ctx.digits)
+		return NULL;
+	if (! binnum_from_number(&x, a) || ! binnum_from_number(&y, b) || ! bin_sum(&s, &x, &y, negate))
+		return NULL;
+	return bin_result(r, &s);
+}
+
+static decNumber *bin_multiply(decNumber *r, const decNumber *a, const decNumber *b) {
+	struct binnum x, y, p;
+
+	if (! binnum_from_number(&x, a) || ! binnum_from_number(&y, b) || ! bin_product(&p, &x, &y))
+		return NULL;
+	return bin_result(r, &p);
+}
+#endif
+
+#ifdef INCLUDE_PACKED_ARITHMETIC
+/* Register contents are taken apart straight into a binary coefficient.
+ * The declets of our packed formats hold plain binary values 0 .. 999,
+ * so no conversion tables are involved.  A sum or product that decNumber
+ * would get exactly at Ctx precision is packed again in one rounding
+ * step, which is what setRegister() ends up with as well.
+ */
+#include <string.h>
+
+#define BIN_LOW_DECLETS	6	/* 18 digits in the low half of a decimal128 */
+
+static unsigned long long int bin_declets(unsigned long long int w, int n) {
+	unsigned long long int v = 0;
+	int i;
+
+	for (i = n - 1; i >= 0; i--) {
+		const unsigned int d = (w >> (10 * i)) & 0x3ff;
+
+		v = v * 1000 + (d < 1000 ? d : 0);
+	}
+	return v;
+}
+
+static unsigned long long int bin_to_declets(unsigned long long int v, int n) {
+	unsigned long long int w = 0;
+	int i;
+
+	for (i = 0; i < n; i++) {
+		w |= (v % 1000) << (10 * i);
+		v /= 1000;
+	}
+	return w;
+}
+
+/* Decode the combination field, zero is returned for the specials
+ */
+static int bin_comb(unsigned int comb, unsigned int *msd, unsigned int *exp) {
+	if ((comb >> 3) != 3) {
+		*exp = comb >> 3;
+		*msd = comb & 7;
+	} else if (((comb >> 1) & 3) != 3) {
+		*exp = (comb >> 1) & 3;
+		*msd = 8 + (comb & 1);
+	} else
+		return 0;
+	return 1;
+}
+
+static unsigned int bin_make_comb(unsigned int msd, unsigned int exp) {
+	if (msd >= 8)
+		return 0x18 | ((exp << 1) & 6) | (msd & 1);
+	return ((exp << 3) & 0x18) | msd;
+}
+
+int binnum_from_packed(struct binnum *r, const REGISTER *x, int dbl) {
+	unsigned long long int hi;
+	unsigned int msd, exp;
+	bin_coeff w = 0;
+
+	// Both byte orders store the words the way the machine does
+	if (dbl) {
+		memcpy(&w, &(x->d), sizeof(w));
+		hi = (unsigned long long int) (w >> 64);
+	} else
+		memcpy(&hi, &(x->s), sizeof(hi));
+	r->neg = hi >> 63;
+	if ((hi << 1) == 0 && (unsigned long long int) w == 0) {
+		// How our zeros are stored, whatever exponent they came with
+		r->c = 0;
+		r->e = 0;
+		r->digits = 1;
+		return 1;
+	}
+	if (! bin_comb((hi >> 58) & 0x1f, &msd, &exp))
+		return 0;
+	if (dbl) {
+		const unsigned long long int top = (unsigned long long int) (w >> 60);
+
+		r->e = (int) ((exp << 12) | ((hi >> 46) & 0xfff)) - DECIMAL128_Bias;
+		r->c = (bin_coeff) (msd * Pow10[15] + bin_declets(top, 5)) * Pow10[18]
+			+ bin_declets((unsigned long long int) w, BIN_LOW_DECLETS);
+	} else {
+		r->e = (int) ((exp << 8) | ((hi >> 50) & 0xff)) - DECIMAL64_Bias;
+		r->c = msd * Pow10[15] + bin_declets(hi, 5);
+	}
+	r->digits = bin_digits(r->c);
+	return 1;
+}
+
+/* Pack a number the way setRegister() does (normalise non-zero) or the
+ * way packed_from_number() does.  Zero is returned, and nothing written,
+ * for results decNumber would have rounded, or which are too close to the
+ * limits of the format to be packed without its help.
+ */
+int packed_from_binnum(REGISTER *r, const struct binnum *x, int dbl, enum rounding round, int normalise) {
+	const int pmax = dbl ? DECIMAL128_Pmax : DECIMAL64_Pmax;
+	const int emax = dbl ? DECIMAL128_Emax : DECIMAL64_Emax;
+	const int emin = dbl ? DECIMAL128_Emin : DECIMAL64_Emin;
+	const int etop = dbl ? DECIMAL128_Ehigh - DECIMAL128_Bias : DECIMAL64_Ehigh - DECIMAL64_Bias;
+	struct binnum v = *x;
+	bin_coeff w;
+
+	if (v.digits > Ctx.digits || v.e + v.digits > emax)
+		return 0;
+	if (v.c == 0)
+		w = 0;
+	else {
+		unsigned int exp, msd;
+
+		if (normalise) {
+			if ((v.c >> 64) == 0) {
+				unsigned long long int c = (unsigned long long int) v.c;
+
+				while (c % 10 == 0) {
+					c /= 10;
+					v.e++;
+				}
+				v.c = c;
+			} else
+				while (v.c % 10 == 0) {
+					v.c /= 10;
+					v.e++;
+				}
+			v.digits = bin_digits(v.c);
+		}
+		if (v.e + v.digits - 1 < emin)
+			return 0;
+		if (v.digits > pmax)
+			bin_round(&v, pmax, round);
+		if (v.e > etop)
+			return 0;
+
+		if (dbl) {
+			const unsigned long long int top = (unsigned long long int) (v.c / Pow10[18]);
+			const unsigned long long int low = (unsigned long long int) (v.c - (bin_coeff) top * Pow10[18]);
+
+			exp = v.e + DECIMAL128_Bias;
+			msd = top / Pow10[15];
+			w = (bin_coeff) bin_make_comb(msd, exp >> 12) << 122
+				| (bin_coeff) (exp & 0xfff) << 110
+				| (bin_coeff) bin_to_declets(top % Pow10[15], 5) << 60
+				| bin_to_declets(low, BIN_LOW_DECLETS);
+		} else {
+			const unsigned long long int c = (unsigned long long int) v.c;
+
+			exp = v.e + DECIMAL64_Bias;
+			msd = c / Pow10[15];
+			w = bin_to_declets(c % Pow10[15], 5) | ((unsigned long long int) (exp & 0xff) << 50)
+				| ((unsigned long long int) bin_make_comb(msd, exp >> 8) << 58);
+		}
+	}
+	if (dbl) {
+		if (v.neg)
+			w |= (bin_coeff) 1 << 127;
+		memcpy(&(r->d), &w, sizeof(w));
+	} else {
+		unsigned long long int s = (unsigned long long int) w;
+
+		if (v.neg)
+			s |= 1ULL << 63;
+		memcpy(&(r->s), &s, sizeof(s));
+	}
+	return 1;
+}
+
+/* Sums and products as decNumber would work them out at Ctx precision.
+ * Zero is returned if that would have involved rounding.
+ */
+int binnum_add(struct binnum *r, const struct binnum *a, const struct binnum *b, int negate) {
+	return bin_sum(r, a, b, negate) && r->digits <= Ctx.digits;
+}
+
+int binnum_multiply(struct binnum *r, const struct binnum *a, const struct binnum *b) {
+	return bin_product(r, a, b) && r->digits <= Ctx.digits;
+}
+
+/* -1, 0 or 1 as a is less than, equal to or greater than b
+ */
+int binnum_compare(const struct binnum *a, const struct binnum *b) {
+	const int sign = a->neg ? -1 : 1;
+	int ea, eb;
+	bin_coeff x, y;
+
+	if (a->c == 0 || b->c == 0) {
+		if (b->c != 0)
+			return b->neg ? 1 : -1;
+		return a->c == 0 ? 0 : sign;
+	}
+	if (a->neg != b->neg)
+		return sign;
+	ea = a->e + a->digits;
+	eb = b->e + b->digits;
+	if (ea != eb)
+		return ea > eb ? sign : -sign;
+	// Same magnitude, so lining up the coefficients takes no more digits
+	x = a->c;
+	y = b->c;
+	if (a->e > b->e)
+		x *= bin_pow10(a->e - b->e);
+	else
+		y *= bin_pow10(b->e - a->e);
+	if (x == y)
+		return 0;
+	return x > y ? sign : -sign;
+}
+#endif
+
 /* Some wrapper rountines to save space
  */
 decNumber *dn_add(decNumber *r, const decNumber *a, const decNumber *b) {
+#ifdef INCLUDE_BINARY_ARITHMETIC
+	if (bin_add(r, a, b, 0) != NULL)
+		return r;
+#endif
 	return decNumberAdd(r, a, b, &Ctx);
 }
 
 decNumber *dn_subtract(decNumber *r, const decNumber *a, const decNumber *b) {
+#ifdef INCLUDE_BINARY_ARITHMETIC
+	if (bin_add(r, a, b, 1) != NULL)
+		return r;
+#endif
 	return decNumberSubtract(r, a, b, &Ctx);
 }
 
 decNumber *dn_multiply(decNumber *r, const decNumber *a, const decNumber *b) {
+#ifdef INCLUDE_BINARY_ARITHMETIC
+	if (bin_multiply(r, a, b) != NULL)
+		return r;
+#endif
 	return decNumberMultiply(r, a, b, &Ctx);
 }
 
@@ -952,6 +1373,101 @@ decNumber *decNumberBigMod(decNumber *res, const decNumber *x, const decNumber *
 }
 
 
+#ifdef INCLUDE_SINCOS_TABLE
+/* Sum the terms first, first+2, ... top of the sine or cosine series in r2 = r^2
+ * by Horner's rule.  The coefficients already carry their signs.
+ */
+static void sincos_poly(decNumber *res, const decNumber *r2, int first, int top) {
+	int n;
+
+	decNumberCopy(res, const_sincos_rfact[top]);
+	for (n = top - 2; n >= first; n -= 2) {
+		dn_multiply(res, res, r2);
+		dn_add(res, res, const_sincos_rfact[n]);
+	}
+}
+
+/* Calculate sin and cos from the table of the first quadrant.  The argument
+ * is split into q steps of pi/(2 SINCOS_STEPS) and a remainder r of at most
+ * half a step, so a few terms of the series in r suffice and then
+ *	sin(a) = sin(q step) cos(r) + cos(q step) sin(r)
+ *	cos(a) = cos(q step) cos(r) - sin(q step) sin(r)
+ * Terms beyond the working precision are dropped when r is small and on the
+ * axes only the one of cos(r) and sin(r) that is wanted is evaluated.
+ * Returns false if the argument is too large to be reduced exactly.
+ */
+static int sincos_table(const decNumber *a, decNumber *sout, decNumber *cout, int digits) {
+	sincosNumber q, r, r2, s, c, t, u;
+	const decNumber *sb, *cb;
+	int k, j, quad, neg_s, neg_c, even, m, top;
+
+	if (decNumberIsSpecial(a))
+		return 0;
+	dn_multiply(&q.n, a, &const_sincos_rstep);
+	decNumberIntg(&q.n, &q.n);
+	if (q.n.digits + q.n.exponent > 3)
+		return 0;
+	k = dn_to_int(&q.n) % (4 * SINCOS_STEPS);
+	if (k < 0)
+		k += 4 * SINCOS_STEPS;
+	quad = k / SINCOS_STEPS;
+	j = k % SINCOS_STEPS;
+
+	dn_multiply(&t.n, &q.n, &const_sincos_step1);
+	dn_subtract(&r.n, a, &t.n);
+	dn_multiply(&t.n, &q.n, &const_sincos_step2);
+	dn_subtract(&r.n, &r.n, &t.n);
+	dn_multiply(&r2.n, &r.n, &r.n);
+
+	// r^2 < 10^-m so powers of r^2 past SINCOS_DIGITS/m don't matter
+	top = SINCOS_TERMS;
+	m = -(r2.n.exponent + r2.n.digits);
+	if (dn_eq0(&r2.n))
+		top = 1;
+	else if (m > 0 && top > 2 * ((SINCOS_DIGITS + m - 1) / m) - 1)
+		top = 2 * ((SINCOS_DIGITS + m - 1) / m) - 1;
+
+	even = (quad & 1) == 0;
+	if (j != 0 || (even ? cout : sout) != NULL)
+		sincos_poly(&c.n, &r2.n, 0, top & ~1);
+	else
+		decNumberZero(&c.n);
+	if (j != 0 || (even ? sout : cout) != NULL) {
+		sincos_poly(&s.n, &r2.n, 1, (top - 1) | 1);
+		dn_multiply(&s.n, &s.n, &r.n);
+	} else
+		decNumberZero(&s.n);
+
+	sb = const_sincos_sin[(quad & 1) ? SINCOS_STEPS - j : j];
+	cb = const_sincos_sin[(quad & 1) ? j : SINCOS_STEPS - j];
+	neg_s = quad >= 2;
+	neg_c = quad == 1 || quad == 2;
+
+	if (sout != NULL) {
+		dn_multiply(&t.n, sb, &c.n);
+		dn_multiply(&u.n, cb, &s.n);
+		if (neg_s)
+			dn_minus(&t.n, &t.n);
+		if (neg_c)
+			dn_minus(&u.n, &u.n);
+	}
+	if (cout != NULL) {
+		dn_multiply(&c.n, cb, &c.n);
+		dn_multiply(&s.n, sb, &s.n);
+		if (neg_c)
+			dn_minus(&c.n, &c.n);
+		if (neg_s)
+			dn_minus(&s.n, &s.n);
+	}
+	Ctx.digits = digits;
+	if (sout != NULL)
+		dn_add(sout, &t.n, &u.n);
+	if (cout != NULL)
+		dn_subtract(cout, &c.n, &s.n);
+	return 1;
+}
+#endif
+
 /* Calculate sin and cos by Taylor series
  */
 void sincosTaylor(const decNumber *a, decNumber *sout, decNumber *cout) {
@@ -960,6 +1476,11 @@ void sincosTaylor(const decNumber *a, decNumber *sout, decNumber *cout) {
 	const int digits = Ctx.digits;
 	Ctx.digits = SINCOS_DIGITS;
 
+#ifdef INCLUDE_SINCOS_TABLE
+	if (sincos_table(a, sout, cout, digits))
+		return;
+#endif
+
 	dn_multiply(&a2.n, a, a);
 	dn_1(&j.n);
 	dn_1(&t.n);
@@ -1714,6 +2235,135 @@ const decNumber *const gamma_consts[21] = {
 	&const_gammaC19, &const_gammaC20, &const_gammaC21,
 };
 
+#ifdef INCLUDE_FAST_GAMMA
+/* The sum of Stirling's series sum B(2k) / (2k (2k-1) y^(2k-1)).  The terms
+ * are added until they drop below the working precision which takes at most
+ * STIRLING_TERMS of them for y above 20.
+ */
+static void stirling_sum(decNumber *s, const decNumber *y) {
+	decNumber r, r2, t;
+	int k;
+
+	decNumberRecip(&r, y);
+	dn_multiply(&r2, &r, &r);
+	decNumberZero(s);
+	for (k = 0; k < STIRLING_TERMS; k++) {
+		dn_multiply(&t, const_gamma_stirling[k], &r);
+		dn_add(s, s, &t);
+		if (t.exponent + t.digits < -Ctx.digits - 1)
+			break;
+		dn_multiply(&r, &r, &r2);
+	}
+}
+
+/* Log gamma of y by the Stirling series
+ *	(y - 1/2) ln y - y + ln sqrt(2 PI) + sum B(2k) / (2k (2k-1) y^(2k-1))
+ */
+static void gamma_stirling(decNumber *res, const decNumber *y) {
+	decNumber r, s, t, u;
+
+	stirling_sum(&s, y);
+	dn_ln(&t, y);
+	dn_subtract(&u, y, &const_0_5);
+	dn_multiply(&r, &u, &t);
+	dn_subtract(&u, &r, y);
+	dn_add(&t, &u, &const_lnsqrt2PI);
+	dn_add(res, &t, &s);
+}
+
+/* Gamma of x+1 for integers and half integers x below 256: start from every
+ * GAMMA_TABLE_STEP-th value in the table and multiply the remaining factors.
+ * Returns false for other arguments.
+ */
+static int gamma_table(decNumber *res, const decNumber *x) {
+	const decNumber *const *tbl = const_gamma_fact;
+	decNumber t, f;
+	int m, r;
+
+	if (! is_int(x)) {
+		dn_add(&t, x, &const_0_5);
+		if (! is_int(&t))
+			return 0;
+		x = &t;
+		tbl = const_gamma_half;
+	}
+	if (dn_lt0(x) || ! dn_lt(x, &const_256))
+		return 0;
+	m = dn_to_int(x);
+	r = m % GAMMA_TABLE_STEP;
+	decNumberCopy(res, tbl[m / GAMMA_TABLE_STEP]);
+	int_to_dn(&f, m - r);
+	if (tbl == const_gamma_half)
+		dn_subtract(&f, &f, &const_0_5);
+	while (r-- > 0) {
+		dn_inc(&f);
+		dn_multiply(res, res, &f);
+	}
+	return 1;
+}
+
+/* The Lanczos sum for gamma of x+1 as the ratio of two polynomials with
+ * positive coefficients.
+ */
+static void lanczos_sum(decNumber *s, const decNumber *x) {
+	decNumber n, d;
+	int k;
+
+	decNumberCopy(&n, const_gamma_num[GAMMA_TERMS]);
+	decNumberCopy(&d, const_gamma_den[GAMMA_TERMS]);
+	for (k = GAMMA_TERMS - 1; k >= 0; k--) {
+		dn_multiply(&n, &n, x);
+		dn_add(&n, &n, const_gamma_num[k]);
+		dn_multiply(&d, &d, x);
+		dn_add(&d, &d, const_gamma_den[k]);
+	}
+	dn_divide(s, &n, &d);
+}
+
+/* Gamma of x+1 for x > -1, or its logarithm when ln is set.  Below 20 the
+ * Lanczos sum is used, above the Stirling series is cheaper and more
+ * accurate.  The denominator of the sum vanishes at -1 so negative x take a
+ * step up first.  The sum only needs a logarithm for the log gamma.
+ */
+static void fast_gamma(decNumber *res, const decNumber *x, int ln) {
+	decNumber n, d, r, s, t;
+
+	if (dn_ge(x, &const_20)) {
+		dn_p1(&t, x);
+		gamma_stirling(res, &t);
+		if (! ln)
+			dn_exp(res, res);
+		return;
+	}
+	if (dn_lt0(x)) {
+		dn_p1(&t, x);
+		fast_gamma(&s, &t, ln);
+		if (ln) {
+			dn_ln(&n, &t);
+			dn_subtract(res, &s, &n);
+		} else
+			dn_divide(res, &s, &t);
+		return;
+	}
+	lanczos_sum(&s, x);
+
+//		r = z + g + .5;
+	dn_add(&r, x, &const_gammaR);
+
+//		(z+.5) * log(r) - r;
+	dn_ln(&n, &r);
+	dn_add(&t, x, &const_0_5);
+	dn_multiply(&d, &n, &t);
+	dn_subtract(&n, &d, &r);
+	if (ln) {
+		dn_ln(&t, &s);
+		dn_add(res, &n, &t);
+	} else {
+		dn_exp(&t, &n);
+		dn_multiply(res, &t, &s);
+	}
+}
+#else
 static void dn_LnGamma(decNumber *res, const decNumber *x) {
 	decNumber r, s, t, u, v;
 	int k;
@@ -1734,7 +2384,7 @@ static void dn_LnGamma(decNumber *res, const decNumber *x) {
 	DUMP(&t, "sum");
 	DUMP(&s, "ln");
 #endif
-//		r = z + g + .5;
+//		r = z + g + .5;
 	dn_add(&r, x, &const_gammaR);
 #ifdef DUMP
 	DUMP(&r, "r");
@@ -1756,6 +2406,7 @@ static void dn_LnGamma(decNumber *res, const decNumber *x) {
 	fclose(f);
 #endif
 }
+#endif
 
 // common code for the [GAMMA] and LN[GAMMA]
 static decNumber *Gamma_LnGamma(decNumber *res, const decNumber *xin, const int ln) {
@@ -1789,7 +2440,7 @@ static decNumber *Gamma_LnGamma(decNumber *res, const decNumber *xin, const int
 		dn_m1(&x, &t);
 	} else {
 		dn_m1(&x, xin);
-#ifdef GAMMA_FAST_INTEGERS
+#if defined(GAMMA_FAST_INTEGERS) && ! defined(INCLUDE_FAST_GAMMA)
 		// Provide a fast path evaluation for positive integer arguments that aren't too large
 		// The threshold for overflow is 205! (i.e. 204! is within range and 205! isn't).
 		// Without introducing a new constant, we've got 150 or 256 to choose from.
@@ -1806,8 +2457,16 @@ static decNumber *Gamma_LnGamma(decNumber *res, const decNumber *xin, const int
 #endif
 	}
 
+#ifdef INCLUDE_FAST_GAMMA
+	if (gamma_table(res, &x)) {
+		if (ln)
+			dn_ln(res, res);
+	} else
+		fast_gamma(res, &x, ln);
+#else
 	dn_LnGamma(res, &x);
 	if (!ln) dn_exp(res, res);
+#endif
 
 	// Finally invert if we started with a negative argument
 	if (reflec) {
@@ -2102,30 +2761,25 @@ void decNumber2Fraction(decNumber *n, decNumber *d, const decNumber *x) {
 	}
 }
 
-static decNumber *gser(decNumber *res, const decNumber *a, const decNumber *x, const decNumber *gln) {
-	decNumber ap, del, sum, t, u;
+/* The series for the lower incomplete gamma function without its factor
+ *	x^a e^-x sum x^n / (a (a+1) ... (a+n))
+ */
+static void gser_sum(decNumber *sum, const decNumber *a, const decNumber *x) {
+	decNumber ap, del, t;
 	int i;
 
-	if (dn_le0(x))
-		return decNumberZero(res);
 	decNumberCopy(&ap, a);
-	decNumberRecip(&sum, a);
-	decNumberCopy(&del, &sum);
+	decNumberRecip(sum, a);
+	decNumberCopy(&del, sum);
 	for (i=0; i<1000; i++) {
 		dn_inc(&ap);
 		dn_divide(&t, x, &ap);
 		dn_multiply(&del, &del, &t);
-		dn_add(&t, &sum, &del);
-		if (dn_eq(&t, &sum))
+		dn_add(&t, sum, &del);
+		if (dn_eq(&t, sum))
 			break;
-		decNumberCopy(&sum, &t);
+		decNumberCopy(sum, &t);
 	}
-	dn_ln(&t, x);
-	dn_multiply(&u, &t, a);
-	dn_subtract(&t, &u, x);
-	dn_subtract(&u, &t, gln);
-	dn_exp(&t, &u);
-	return dn_multiply(res, &sum, &t);
 }
 
 static void gcheckSmall(decNumber *v)
@@ -2136,15 +2790,18 @@ static void gcheckSmall(decNumber *v)
 		decNumberCopy(v, threshold);
 }
 
-static decNumber *gcf(decNumber *res, const decNumber *a, const decNumber *x, const decNumber *gln) {
-	decNumber an, b, c, d, h, t, u, v, i;
+/* The continued fraction for the upper incomplete gamma function without
+ * its factor x^a e^-x, evaluated by the modified Lentz method.
+ */
+static void gcf_sum(decNumber *h, const decNumber *a, const decNumber *x) {
+	decNumber an, b, c, d, t, u, v, i;
 	int n;
 
 	dn_p1(&t, x);
 	gcheckSmall(dn_subtract(&b, &t, a));		// b = (x+1) - a
 	set_inf(&c);
 	decNumberRecip(&d, &b);
-	decNumberCopy(&h, &d);
+	decNumberCopy(h, &d);
 	decNumberZero(&i);
 	for (n=0; n<1000; n++) {
 		dn_inc(&i);
@@ -2159,11 +2816,304 @@ static decNumber *gcf(decNumber *res, const decNumber *a, const decNumber *x, co
 		dn_add(&c, &b, &t);
 		gcheckSmall(&c);
 		dn_multiply(&t, &d, &c);
-		dn_multiply(&u, &h, &t);
-		if (dn_eq(&h, &u))
+		dn_multiply(&u, h, &t);
+		if (dn_eq(h, &u))
+			break;
+		decNumberCopy(h, &u);
+	}
+}
+
+#ifdef INCLUDE_FAST_INCOMPLETE
+/* ln(1+x) - x without the cancellation for small x.  With s = x / (2+x)
+ * ln(1+x) = 2 atanh(s) and x = 2s / (1-s) so this is
+ *	2 (s^3/3 + s^5/5 + ...) - 2 s^2 / (1-s)
+ * whose terms are all small.  Past |s| = 1/2 the logarithm is taken directly.
+ */
+decNumber *decNumberLn1pmx(decNumber *r, const decNumber *x) {
+	decNumber n, s, s2, sum, t, u;
+
+	dn_p2(&t, x);
+	dn_divide(&s, x, &t);
+	if (! dn_abs_lt(&s, &const_0_5)) {
+		decNumberLn1p(&t, x);
+		return dn_subtract(r, &t, x);
+	}
+	dn_multiply(&s2, &s, &s);
+	dn_multiply(&t, &s2, &s);
+	decNumberCopy(&n, &const_3);
+	decNumberZero(&sum);
+	for (;;) {
+		dn_divide(&u, &t, &n);
+		dn_add(&u, &sum, &u);
+		if (dn_eq(&u, &sum))
 			break;
-		decNumberCopy(&h, &u);
+		decNumberCopy(&sum, &u);
+		dn_multiply(&t, &t, &s2);
+		dn_p2(&n, &n);
 	}
+	dn_1m(&t, &s);
+	dn_divide(&u, &s2, &t);
+	dn_subtract(&t, &sum, &u);
+	return dn_mul2(r, &t);
+}
+
+/* The log of gamma*(y) = gamma(y) / (sqrt(2 PI) y^(y-1/2) e^-y), which is
+ * just the sum of Stirling's series for large y.  Ratios of gamma functions
+ * of large arguments are best formed from these.
+ */
+decNumber *decNumberLnGammaStar(decNumber *r, const decNumber *y) {
+	decNumber s, t, u;
+
+	if (dn_ge(y, &const_20)) {
+		stirling_sum(r, y);
+		return r;
+	}
+	decNumberLnGamma(&s, y);
+	dn_ln(&t, y);
+	dn_subtract(&u, y, &const_0_5);
+	dn_multiply(r, &u, &t);
+	dn_subtract(&u, &s, r);
+	dn_add(&t, &u, y);
+	return dn_subtract(r, &t, &const_lnsqrt2PI);
+}
+
+/* x^a e^-x / gamma(a) for 0 < a < 20, or x^a e^-x when not regularised.
+ * For integer and half integer a the power is a product and gamma comes
+ * from the table, which leaves only the exponential.  Otherwise with the
+ * Lanczos sum s and r = a + g + 1/2
+ *	x^a e^-x / gamma(a) = a / s (x/r)^a e^(r-x) / sqrt(r)
+ * takes one logarithm instead of three.
+ */
+static void gamma_factor(decNumber *res, const decNumber *a, const decNumber *x, int regularised) {
+	decNumber p, r, s, t, u;
+	int n, half = 0;
+
+	if (! is_int(a)) {
+		dn_add(&t, a, &const_0_5);
+		half = is_int(&t);
+	}
+	if (half || is_int(a)) {
+		n = dn_to_int(a);
+		dn_1(&p);
+		decNumberCopy(&u, x);
+		for (; n > 0; n >>= 1) {
+			if (n & 1)
+				dn_multiply(&p, &p, &u);
+			if (n > 1)
+				dn_multiply(&u, &u, &u);
+		}
+		if (half) {
+			dn_sqrt(&u, x);
+			dn_multiply(&p, &p, &u);
+		}
+		dn_minus(&t, x);
+		dn_exp(&u, &t);
+		dn_multiply(res, &p, &u);
+		if (regularised) {
+			dn_m1(&t, a);
+			gamma_table(&u, &t);
+			dn_divide(res, res, &u);
+		}
+	} else if (regularised) {
+		dn_add(&r, a, &const_gammaR);
+		dn_divide(&t, x, &r);
+		dn_ln(&u, &t);
+		dn_multiply(&p, &u, a);
+		dn_subtract(&t, &r, x);
+		dn_add(&u, &p, &t);
+		dn_exp(&p, &u);
+		lanczos_sum(&s, a);
+		dn_divide(&t, a, &s);
+		dn_multiply(&u, &p, &t);
+		dn_sqrt(&t, &r);
+		dn_divide(res, &u, &t);
+	} else {
+		dn_ln(&t, x);
+		dn_multiply(&u, &t, a);
+		dn_subtract(&t, &u, x);
+		dn_exp(res, &t);
+	}
+}
+
+static decNumber *igamma(decNumber *res, const decNumber *a, const decNumber *x, int upper, int regularised);
+
+/* Temme's uniform expansion of the regularised incomplete gamma functions
+ * for large a:
+ *	Q(a, x) = erfc(eta sqrt(a/2)) / 2 + exp(-a eta^2/2) / sqrt(2 PI a) sum c_k(eta) / a^k
+ * where eta^2 / 2 = phi = mu - ln(1+mu) for x = a (1+mu) and eta has the sign
+ * of mu.  The c_k are power series in eta with coefficients from
+ * compile_consts.c, all below one, so terms that cannot reach the working
+ * precision are left off.  The error function is Q(1/2, a phi).
+ */
+static decNumber *igamma_temme(decNumber *res, const decNumber *a, const decNumber *mu, const decNumber *phi, int upper) {
+	decNumber eta, y, e, c, s, p, t;
+	const decNumber *const *d;
+	int k, n, m, pe;
+	const int ee = phi->exponent + phi->digits;
+
+	dn_mul2(&t, phi);
+	dn_sqrt(&eta, &t);
+	if (decNumberIsNegative(mu))
+		dn_minus(&eta, &eta);
+	dn_multiply(&y, a, phi);
+	igamma(&t, &const_0_5, &y, 1, 1);
+	dn_div2(&e, &t);
+
+	decNumberZero(&s);
+	dn_1(&p);
+	for (k = 0; k < IGAMMA_TEMME_K; k++) {
+		pe = p.exponent + p.digits;
+		if (pe < -Ctx.digits - 3)
+			break;
+		// |eta|^n < 10^(n (ee + 0.3) / 2) so later terms are negligible
+		m = IGAMMA_TEMME_N;
+		if (dn_eq0(phi))
+			m = 1;
+		else if (ee < 0) {
+			m = 20 * (Ctx.digits + 3 + pe) / (-10 * ee - 3) + 1;
+			if (m > IGAMMA_TEMME_N)
+				m = IGAMMA_TEMME_N;
+		}
+		d = const_igamma_temme + k * IGAMMA_TEMME_N;
+		decNumberCopy(&c, d[m-1]);
+		for (n = m-2; n >= 0; n--) {
+			dn_multiply(&c, &c, &eta);
+			dn_add(&c, &c, d[n]);
+		}
+		dn_multiply(&t, &c, &p);
+		dn_add(&s, &s, &t);
+		dn_divide(&p, &p, a);
+	}
+	dn_multiply(&t, &const_2PI, a);
+	dn_sqrt(&c, &t);
+	dn_minus(&t, &y);
+	dn_exp(&p, &t);
+	dn_divide(&t, &p, &c);
+	dn_multiply(&p, &t, &s);
+	if (upper) {
+		if (decNumberIsNegative(mu))
+			dn_1m(&e, &e);
+		return dn_add(res, &e, &p);
+	}
+	if (! decNumberIsNegative(mu))
+		dn_1m(&e, &e);
+	return dn_subtract(res, &e, &p);
+}
+
+/* The incomplete gamma functions for finite positive a and x, the upper or
+ * lower one, regularised or not.  Temme's expansion takes a of 500 and more
+ * close to the transition x = a, where both the series and the continued
+ * fraction need most terms, and a wider range below it once the series
+ * alone would need hundreds of terms.  Otherwise the series gives the lower
+ * and the continued fraction the upper function, the other follows by
+ * subtraction.  The series is cheaper until well past x = a + 1 when a is small, but its
+ * complement is only accurate while that is not tiny.  For a of 20 and more
+ * the common factor x^a e^-x / gamma(a) is formed as
+ *	exp(a (ln(1+mu) - mu) - ln gamma*(a)) sqrt(a / (2 PI))
+ * which avoids the cancellation between a ln x and ln gamma(a); those
+ * functions are regularised first and multiplied by gamma(a) when not wanted
+ * so.
+ */
+static decNumber *igamma(decNumber *res, const decNumber *a, const decNumber *x, int upper, int regularised) {
+	decNumber a1, f, mu, phi, s, t, u;
+	int cf;
+	const int large = dn_ge(a, &const_20);
+
+	dn_p1(&a1, a);
+	cf = ! dn_lt(x, &a1);
+	if (cf && ! large && dn_lt(x, &const_20))
+		cf = 0;
+
+	if (large) {
+		dn_subtract(&t, x, a);
+		dn_divide(&mu, &t, a);
+		decNumberLn1pmx(&phi, &mu);
+		dn_minus(&t, &phi);
+		if (dn_ge(a, &const_500) && dn_lt(&t, dn_lt(x, a) && dn_ge(a, &const_5000) ? &const_0_05 : &const_0_002)) {
+			igamma_temme(res, a, &mu, &t, upper);
+			goto scale;
+		}
+		dn_multiply(&t, a, &phi);
+		decNumberLnGammaStar(&u, a);
+		dn_subtract(&s, &t, &u);
+		dn_exp(&t, &s);
+		dn_sqrt(&u, a);
+		dn_multiply(&s, &u, &const_recipsqrt2PI);
+		dn_multiply(&f, &t, &s);
+	} else
+		gamma_factor(&f, a, x, regularised);
+
+	if (cf)
+		gcf_sum(&s, a, x);
+	else
+		gser_sum(&s, a, x);
+	dn_multiply(res, &f, &s);
+	if (cf != upper) {
+		if (large || regularised)
+			dn_1(&u);
+		else
+			decNumberGamma(&u, a);
+		dn_subtract(&t, &u, res);
+		// Past a+1 keep the complement of the series only while it is not too small
+		dn_multiply(&s, &u, is_dblmode() ? &const_0_05 : &const_1e_14);
+		if (! cf && ! dn_lt(x, &a1) && dn_lt(&t, &s)) {
+			gcf_sum(&s, a, x);
+			dn_multiply(res, &f, &s);
+		} else
+			decNumberCopy(res, &t);
+	}
+scale:	if (large && ! regularised) {
+		decNumberGamma(&t, a);
+		dn_multiply(res, res, &t);
+	}
+	return res;
+}
+
+decNumber *decNumberGammap(decNumber *res, const decNumber *x, const decNumber *a) {
+	const int op = XeqOpCode - (OP_DYA | OP_GAMMAg);
+	const int regularised = op & 2;
+	const int upper = op & 1;
+
+	if (decNumberIsNegative(x) || dn_le0(a) ||
+			decNumberIsNaN(x) || decNumberIsNaN(a) || decNumberIsInfinite(a)) {
+		return set_NaN(res);
+	}
+	if (decNumberIsInfinite(x)) {
+		if (upper) {
+			if (regularised)
+				return dn_1(res);
+			return decNumberGamma(res, a);
+		}
+		return decNumberZero(res);
+	}
+	if (dn_eq0(x)) {
+		if (! upper)
+			return decNumberZero(res);
+		if (regularised)
+			return dn_1(res);
+		return decNumberGamma(res, a);
+	}
+	return igamma(res, a, x, upper, regularised);
+}
+#else
+static decNumber *gser(decNumber *res, const decNumber *a, const decNumber *x, const decNumber *gln) {
+	decNumber sum, t, u;
+
+	if (dn_le0(x))
+		return decNumberZero(res);
+	gser_sum(&sum, a, x);
+	dn_ln(&t, x);
+	dn_multiply(&u, &t, a);
+	dn_subtract(&t, &u, x);
+	dn_subtract(&u, &t, gln);
+	dn_exp(&t, &u);
+	return dn_multiply(res, &sum, &t);
+}
+
+static decNumber *gcf(decNumber *res, const decNumber *a, const decNumber *x, const decNumber *gln) {
+	decNumber h, t, u;
+
+	gcf_sum(&h, a, x);
 	dn_ln(&t, x);
 	dn_multiply(&u, &t, a);
 	dn_subtract(&t, &u, x);
@@ -2216,6 +3166,7 @@ invert:	if (regularised)
 	decNumberGamma(&z, a);
 	return dn_subtract(res, &z, res);
 }
+#endif
 
 #ifdef INCLUDE_FACTOR
 decNumber *decFactor(decNumber *r, const decNumber *x) {
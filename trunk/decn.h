@@ -147,6 +147,10 @@ extern decNumber *decNumberLnBeta(decNumber *res, const decNumber *x, const decN
 extern decNumber *decNumberERF(decNumber *res, const decNumber *x);
 extern decNumber *decNumberERFC(decNumber *res, const decNumber *x);
 extern decNumber *decNumberGammap(decNumber *res, const decNumber *a, const decNumber *x);
+#ifdef INCLUDE_FAST_INCOMPLETE
+extern decNumber *decNumberLn1pmx(decNumber *r, const decNumber *x);
+extern decNumber *decNumberLnGammaStar(decNumber *r, const decNumber *y);
+#endif
 
 extern decNumber *decNumberD2G(decNumber *res, const decNumber *x);
 extern decNumber *decNumberD2R(decNumber *res, const decNumber *x);
@@ -203,4 +207,26 @@ extern decNumber *dn_ln(decNumber *r, const decNumber *x);
 
 extern decNumber *decRecv(decNumber *r, const decNumber *x);
 
+#ifdef INCLUDE_BINARY_ARITHMETIC
+typedef unsigned __int128 bin_coeff;
+
+/* A finite number with a coefficient of up to 38 digits in binary */
+struct binnum {
+	bin_coeff c;
+	int e;
+	int digits;
+	int neg;
+};
+
+extern int binnum_from_number(struct binnum *r, const decNumber *x);
+#endif
+
+#ifdef INCLUDE_PACKED_ARITHMETIC
+extern int binnum_from_packed(struct binnum *r, const REGISTER *x, int dbl);
+extern int packed_from_binnum(REGISTER *r, const struct binnum *x, int dbl, enum rounding round, int normalise);
+extern int binnum_add(struct binnum *r, const struct binnum *a, const struct binnum *b, int negate);
+extern int binnum_multiply(struct binnum *r, const struct binnum *a, const struct binnum *b);
+extern int binnum_compare(const struct binnum *a, const struct binnum *b);
+#endif
+
 #endif
@@ -28,27 +28,27 @@
 #include "printer.h"
 #include "serial.h"
 
-static enum separator_modes { SEP_NONE, SEP_COMMA, SEP_DOT } SeparatorMode;
-static enum decimal_modes { DECIMAL_DOT, DECIMAL_COMMA } DecimalMode;
+static INSTANCE enum separator_modes { SEP_NONE, SEP_COMMA, SEP_DOT } SeparatorMode;
+static INSTANCE enum decimal_modes { DECIMAL_DOT, DECIMAL_COMMA } DecimalMode;
 
 static void set_status_sized(const char *, int);
 static void set_status(const char *);
 static void set_status_right(const char *);
 static void set_status_graphic(const unsigned char *);
 
-const char *DispMsg;	   // What to display in message area
-short int DispPlot;
+INSTANCE const char *DispMsg;	   // What to display in message area
+INSTANCE short int DispPlot;
 #ifndef REALBUILD
-char LastDisplayedText[NUMALPHA + 1];	   // For clipboard export
-char LastDisplayedNumber[NUMBER_LENGTH + 1];
-char LastDisplayedExponent[EXPONENT_LENGTH + 1];
-char forceDispPlot;
+INSTANCE char LastDisplayedText[NUMALPHA + 1];	   // For clipboard export
+INSTANCE char LastDisplayedNumber[NUMBER_LENGTH + 1];
+INSTANCE char LastDisplayedExponent[EXPONENT_LENGTH + 1];
+INSTANCE char forceDispPlot;
 #endif
 
-FLAG ShowRPN;		   // controls visibility of RPN annunciator
-FLAG JustDisplayed;	   // Avoid duplicate calls to display()
-SMALL_INT IntMaxWindow;    // Number of windows for integer display
-FLAG IoAnnunciator;	   // Status of the little "=" sign
+INSTANCE FLAG ShowRPN;		   // controls visibility of RPN annunciator
+INSTANCE FLAG JustDisplayed;	   // Avoid duplicate calls to display()
+INSTANCE SMALL_INT IntMaxWindow;    // Number of windows for integer display
+INSTANCE FLAG IoAnnunciator;	   // Status of the little "=" sign
 
 /* Message strings
  * Strings starting S7_ are for the lower 7 segment line.  Strings starting S_
@@ -214,6 +214,14 @@ void error_message(const unsigned int e)
 	};
 #endif
 
+#ifdef CONSOLE
+	if (headless_mode) {
+		// Batch execution: just remember the error for the final report
+		if (e != ERR_NONE)
+			headless_error = e;
+		return;
+	}
+#endif
 	if (e != ERR_NONE || Running) {
 		const char *p = error_table[e];
 		const char *q = find_char(p, '\0') + 1;
@@ -2215,7 +2223,10 @@ void display(void) {
 	int x_disp = 0;
 	const int shift = cur_shift();
 
-
+#ifdef CONSOLE
+	if (headless_mode)
+		return;
+#endif
 
 	if (State2.disp_freeze) {
 		State2.disp_freeze = 0;
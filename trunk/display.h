@@ -46,7 +46,7 @@ extern void set_RPN_annunciator(int on);
 
 #ifndef REALBUILD
 extern int getdig(int ch);
-extern char forceDispPlot;
+extern INSTANCE char forceDispPlot;
 #endif
 #ifdef INCLUDE_STOPWATCH
 extern void stopwatch_message(const char *str1, const char *str2, int force_small, char* exponent);
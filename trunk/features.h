@@ -74,6 +74,141 @@
 // Code to allow access to caller's local data from xIN-code
 // #define ENABLE_COPYLOCALS
 
+// Keep a table of the label addresses of each program region so that GTO,
+// XEQ and LBL? don't have to search the program step by step.
+// It needs a few bytes of RAM per label and is therefore emulator only.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_LABEL_INDEX
+#endif
+
+// Keep the assembled opcode and the address of the following step for every
+// program step so running programs don't fetch and decode each step again.
+// Six bytes of RAM per step, emulator only.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_DECODE_CACHE
+#endif
+
+// Instead of copying the whole stack before each instruction, remember the
+// old contents of the stack slots an instruction writes to and put only
+// those back if it fails.  Costs a few checks per register write.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_UNDO_JOURNAL
+#endif
+
+// Remember the unpacked form of recently read or written register values
+// so that chains of stack operations don't decode the same value again.
+// About one kB of RAM, emulator only.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_REGISTER_CACHE
+#endif
+
+// Recognise RCL nn or x<>y followed by + - * / when programs are decoded and
+// execute such pairs in one go without lifting and dropping the stack in
+// between.  Needs the decode cache, emulator only.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_FUSED_STEPS
+#endif
+
+// A running program looks for key presses and the heart beat only every
+// RUN_QUANTUM steps or when the ticker has advanced.  Asking the emulator's
+// keyboard queue takes a lock, the calculator just reads a counter.
+#if defined(CONSOLE) || defined(QTGUI)
+#define RUN_QUANTUM 64
+#endif
+
+// Keep everything that makes up a calculator in thread local storage so
+// each thread of the console emulator runs a calculator of its own.
+// 'calc parallel' uses this to run several batch jobs side by side.
+#if defined(CONSOLE) && ! defined(WIN32)
+#define INCLUDE_THREAD_INSTANCES
+#endif
+
+// Programs translated to C with 'calc translate' can be linked into the
+// console emulator (make AOT=file.c) and run instead of being interpreted.
+#ifdef CONSOLE
+#define INCLUDE_COMPILED_PROGRAMS
+#endif
+
+// Add, subtract and multiply numbers with short coefficients in 128 bit
+// binary instead of decimal units.  Needs a compiler that has such integers.
+#if (defined(CONSOLE) || defined(QTGUI)) && defined(__SIZEOF_INT128__)
+#define INCLUDE_BINARY_ARITHMETIC
+#endif
+
+// Add, subtract, multiply and compare registers holding such numbers
+// without unpacking them into decNumbers first.
+#ifdef INCLUDE_BINARY_ARITHMETIC
+#define INCLUDE_PACKED_ARITHMETIC
+#endif
+
+// decNumber temporaries too long for its local buffers are bump allocated
+// from an arena per thread, which counts what it saves the heap.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_DECNUMBER_ARENA
+#endif
+
+// Evaluate sines and cosines from a table of the first quadrant and a short
+// polynomial instead of summing the Taylor series.  About 3 kB of constants.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_SINCOS_TABLE
+#endif
+
+// In single precision evaluate logarithms, exponentials, powers, arc tangents
+// and gamma functions with a few guard digits first and at full precision
+// only when that result could round either way.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_GUARD_DIGITS
+#endif
+
+// Keep the last results of the costlier pure real functions in a small
+// cache keyed on the function, its operands and the modes.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_RESULT_CACHE
+#endif
+
+// Evaluate the gamma functions from tables for integers and half integers,
+// the Lanczos sum as a ratio of polynomials and Stirling's series for large
+// arguments.  About 4 kB of constants.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_FAST_GAMMA
+#endif
+
+// Evaluate the incomplete gamma and beta functions with their common factors
+// built from Stirling's series instead of differences of log gammas, the
+// beta continued fraction by its three term recurrence and the incomplete
+// gamma functions of large parameters by Temme's uniform expansion.  About
+// 25 kB of constants.
+#ifdef INCLUDE_FAST_GAMMA
+#define INCLUDE_FAST_INCOMPLETE
+#endif
+
+// Test primes by Miller-Rabin over seven fixed bases, which is exact for 64
+// bits, in Montgomery arithmetic on 128 bit products and find factors by
+// Pollard's rho instead of trial division.
+#if (defined(CONSOLE) || defined(QTGUI)) && defined(__SIZEOF_INT128__)
+#define INCLUDE_FAST_PRIMES
+#endif
+
+// Multiply and divide the double words of DBL*, DBL/ and DBLR as 128 bit
+// integers instead of in 16 bit digits.
+#if (defined(CONSOLE) || defined(QTGUI)) && defined(__SIZEOF_INT128__)
+#define INCLUDE_NATIVE_DBL
+#endif
+
+// Matrix multiply unpacks each element of its operands once into a
+// workspace instead of once for every product it is in.  With packed
+// arithmetic the dot products are summed in binary as long as that is
+// exact.  About 14 kB of stack.
+#if defined(CONSOLE) || defined(QTGUI)
+#define INCLUDE_MATRIX_WORKSPACE
+#endif
+
+#ifdef INCLUDE_THREAD_INSTANCES
+#define INSTANCE __thread
+#else
+#define INSTANCE
+#endif
+
 #ifndef TINY_BUILD
 
 // Include the Mantissa and exponent function
@@ -378,6 +513,26 @@
 #define PRETTY_FRACTION_ENTRY
 #endif
 
+#if defined(INCLUDE_COMPILED_PROGRAMS) && ! defined(INCLUDE_DECODE_CACHE)
+/* Compiled programs are checked again whenever the decode cache is dropped */
+#define INCLUDE_DECODE_CACHE
+#endif
+
+#if defined(INCLUDE_COMPILED_PROGRAMS) && ! defined(RUN_QUANTUM)
+/* Compiled programs run a quantum of steps at once */
+#define RUN_QUANTUM 64
+#endif
+
+#if defined(INCLUDE_FUSED_STEPS) && ! defined(INCLUDE_DECODE_CACHE)
+/* Fused steps are found while decoding programs */
+#define INCLUDE_DECODE_CACHE
+#endif
+
+#if defined(INCLUDE_DECODE_CACHE) && ! defined(INCLUDE_LABEL_INDEX)
+/* The decode cache relies on the label index change notifications */
+#define INCLUDE_LABEL_INDEX
+#endif
+
 #if defined(INCLUDE_COMPLEX_ZETA) && ! defined(INCLUDE_ZETA)
 /* Complex zeta implies real zeta */
 #define INCLUDE_ZETA
@@ -308,13 +308,15 @@ long long int intSubtract(long long int y, long long int x) {
 }
 
 static unsigned long long int multiply_with_overflow(unsigned long long int x, unsigned long long int y, int *overflow) {
-	const unsigned long long int t = mask_value(x * y);
+	const unsigned long long int p = x * y;
+	const unsigned long long int t = mask_value(p);
 
 	if (! *overflow && y != 0) {
 		const enum arithmetic_modes mode = int_mode();
 		const unsigned long long int tbm = (mode == MODE_UNSIGNED) ? 0 : topbit_mask();
 
-		if ((t & tbm) != 0 || t / y != x)
+		// Factors below 2^32 have an exact product, which needs no division
+		if ((t & tbm) != 0 || (((x | y) >> 32) == 0 ? t != p : t / y != x))
 			*overflow = 1;
 	}
 	return t;
@@ -557,7 +559,7 @@ long long int intAbs(long long int x) {
 #endif
 }
 
-#ifndef TINY_BUILD
+#if ! defined(TINY_BUILD) && ! defined(INCLUDE_NATIVE_DBL)
 static void breakup(unsigned long long int x, unsigned short xv[4]) {
 	xv[0] = x & 0xffff;
 	xv[1] = (x >> 16) & 0xffff;
@@ -578,10 +580,15 @@ void intDblMul(enum nilop op) {
 	const enum arithmetic_modes mode = int_mode();
 	unsigned long long int xv, yv;
 	int s;	
+#ifdef INCLUDE_NATIVE_DBL
+	unsigned __int128 p;
+	int i;
+#else
 	unsigned short int xa[4], ya[4];
 	unsigned int t[8];
 	unsigned short int r[8];
 	int i, j;
+#endif
 
 	{
 		long long int xr, yr;
@@ -596,6 +603,11 @@ void intDblMul(enum nilop op) {
 		s = sx != sy;
 	}
 
+#ifdef INCLUDE_NATIVE_DBL
+	p = (unsigned __int128) xv * yv;
+	yv = (unsigned long long int) p;
+	xv = (unsigned long long int) (p >> 64);
+#else
 	/* Do the multiplication by breaking the values into unsigned shorts
 	 * multiplying them all out and accumulating into unsigned ints.
 	 * Then perform a second pass over the ints to propogate carry.
@@ -624,6 +636,7 @@ void intDblMul(enum nilop op) {
 
 	yv = packup(r);
 	xv = packup(r+4);
+#endif
 
 	i = word_size();
 	if (i != 64)
@@ -652,6 +665,7 @@ void intDblMul(enum nilop op) {
 
 
 #ifndef TINY_BUILD
+#ifndef INCLUDE_NATIVE_DBL
 static int nlz(unsigned short int x) {
    int n;
 
@@ -760,6 +774,7 @@ static void divmnu(unsigned short q[], unsigned short r[],
 	for (i = 0; i < n; i++)
 		r[i] = (un[i] >> s) | (un[i+1] << (16-s));
 }
+#endif
 
 static unsigned long long int divmod(const long long int z, const long long int y,
 		const long long int x, int *sx, int *sy, unsigned long long *rem) {
@@ -767,12 +782,16 @@ static unsigned long long int divmod(const long long int z, const long long int
 	const unsigned int ws = word_size();
 	const long long int tbm = topbit_mask();
 	unsigned long long int d, h, l;
+#ifdef INCLUDE_NATIVE_DBL
+	unsigned __int128 n;
+#else
 	unsigned short denom[4];
 	unsigned short numer[8];
 	unsigned short quot[5];
 	unsigned short rmdr[4];
 	int num_denom;
 	int num_numer;
+#endif
 
 	l = (unsigned long long int)z;		// Numerator low
 	h = (unsigned long long int)y;		// Numerator high
@@ -798,6 +817,12 @@ static unsigned long long int divmod(const long long int z, const long long int
 		return 0;
 	}
 
+#ifdef INCLUDE_NATIVE_DBL
+	// Only the low word of a quotient that overflows is kept
+	n = ((unsigned __int128) h << ws) | l;
+	*rem = (unsigned long long int) (n % d);
+	return (unsigned long long int) (n / d);
+#else
 	if (ws != 64) {
 		l |= h << ws;
 		h >>= (64 - ws);
@@ -822,6 +847,7 @@ static unsigned long long int divmod(const long long int z, const long long int
 
 	*rem = packup(rmdr);
 	return packup(quot);
+#endif
 }
 #endif
 
@@ -1068,7 +1094,8 @@ long long int int_power_helper(unsigned long long int vy, unsigned long long int
 			r = multiply_with_overflow(r, vy, &overflow);
 		}
 		vx >>= 1;
-		vy = multiply_with_overflow(vy, vy, &overflow_next);
+		if (vx != 0)
+			vy = multiply_with_overflow(vy, vy, &overflow_next);
 	}
 	set_overflow(overflow);
 	return r;
@@ -1342,24 +1369,12 @@ void intbits(unsigned int arg, enum rarg op) {
 
 long long int intFib(long long int x) {
 #ifndef TINY_BUILD
-	int sx, s;
-	unsigned long long int v = extract_value(x, &sx);
-	const enum arithmetic_modes mode = int_mode();
-	unsigned long long int a0, a1;
-	unsigned int n, i;
-	long long int tbm;
+	int sx, s, i;
+	const unsigned long long int n = extract_value(x, &sx);
+	const unsigned int bits = word_size() - (int_mode() == MODE_UNSIGNED ? 0 : 1);
+	unsigned long long int a, b, c, d;
 
-	/* Limit things so we don't loop for too long.
-	 * The actual largest non-overflowing values for 64 bit integers
-	 * are Fib(92) for signed quantities and Fib(93) for unsigned.
-	 * We allow a bit more and maintain the low order digits.
-	 */
-	if (v >= 100) {
-		set_overflow(1);
-		return 0;
-	}
 	set_overflow(0);
-	n = v & 0xff;
 	if (n <= 1)
 		return build_value(n, 0);
 
@@ -1368,29 +1383,41 @@ long long int intFib(long long int x) {
 	 */
 	s = (sx && (n & 1) == 0)?1:0;
 
-	/* Mask to check for overflow */
-	tbm = topbit_mask();
-	if (mode == MODE_UNSIGNED)
-		tbm <<= 1;
-
-	/* Down to the computation.
+	/* Fast doubling from a = Fib(k) and b = Fib(k+1):
+	 *	Fib(2k) = Fib(k) (2 Fib(k+1) - Fib(k))
+	 *	Fib(2k+1) = Fib(k)^2 + Fib(k+1)^2
+	 * Everything is modulo 2^64 which keeps the low order bits of
+	 * larger values.  Fib(93) is the last one below 2^64 and so exact.
 	 */
-	a0 = 0;
-	a1 = 1;
-	for (i=1; i<n; i++) {
-		const unsigned long long int anew = a0 + a1;
-		if ((anew & tbm) || anew < a1)
-			set_overflow(1);
-		a0 = a1;
-		a1 = anew;
+	a = 0;
+	b = 1;
+	for (i=63; (n >> i) == 0; i--);
+	for (; i>=0; i--) {
+		c = a * (b + b - a);
+		d = a * a + b * b;
+		if ((n >> i) & 1) {
+			a = d;
+			b = c + d;
+		} else {
+			a = c;
+			b = d;
+		}
 	}
-	return build_value(a1, s);
+	if (n > 93 || (bits < 64 && (a >> bits) != 0))
+		set_overflow(1);
+	return build_value(a, s);
 #else
 	return 0;
 #endif
 }
 
 
+#ifdef INCLUDE_FAST_PRIMES
+/* Calculate (a . b) mod c from the full product */
+static unsigned long long mulmod(const unsigned long long int a, unsigned long long int b, const unsigned long long int c) {
+	return (unsigned long long int) (((unsigned __int128) a * b) % c);
+}
+#else
 /* Calculate (a . b) mod c taking care to avoid overflow */
 static unsigned long long mulmod(const unsigned long long int a, unsigned long long int b, const unsigned long long int c) {
 	unsigned long long int x=0, y=a%c;
@@ -1402,6 +1429,7 @@ static unsigned long long mulmod(const unsigned long long int a, unsigned long l
 	}
 	return x % c;
 }
+#endif
 
 /* Calculate (a ^ b) mod c */
 static unsigned long long int expmod(const unsigned long long int a, unsigned long long int b, const unsigned long long int c) {
@@ -1416,7 +1444,7 @@ static unsigned long long int expmod(const unsigned long long int a, unsigned lo
 }
 
 /* Test if a number is prime or not using a Miller-Rabin test */
-#ifndef TINY_BUILD
+#if ! defined(TINY_BUILD) && ! defined(INCLUDE_FAST_PRIMES)
 static const unsigned char primes[] = {
 	2, 3, 5, 7,	11, 13, 17, 19,
 	23, 29, 31, 37,	41, 43, 47, 53,
@@ -1425,6 +1453,107 @@ static const unsigned char primes[] = {
 #define QUICK_CHECK	(59*59-1)
 #endif
 
+#ifdef INCLUDE_FAST_PRIMES
+/* Arithmetic modulo an odd n in Montgomery form, where x stands for
+ * x R mod n with R = 2^64.  Products are reduced without a division.
+ */
+struct montgomery {
+	unsigned long long int n;	// the modulus
+	unsigned long long int ninv;	// n^-1 mod R
+	unsigned long long int one;	// R mod n
+};
+
+static void mont_init(struct montgomery *m, unsigned long long int n) {
+	unsigned long long int inv = n;	// right to three bits for odd n
+	int i;
+
+	for (i=0; i<5; i++)
+		inv *= 2 - n * inv;
+	m->n = n;
+	m->ninv = inv;
+	m->one = (0 - n) % n;
+}
+
+/* t / R mod n for t < n R */
+static unsigned long long int mont_redc(const struct montgomery *m, unsigned __int128 t) {
+	const unsigned long long int q = (unsigned long long int) t * m->ninv;
+	const unsigned long long int h = (unsigned long long int) (((unsigned __int128) q * m->n) >> 64);
+	const unsigned long long int th = (unsigned long long int) (t >> 64);
+
+	return th >= h ? th - h : th - h + m->n;
+}
+
+static unsigned long long int mont_mul(const struct montgomery *m, unsigned long long int a, unsigned long long int b) {
+	return mont_redc(m, (unsigned __int128) a * b);
+}
+
+static unsigned long long int mont_from(const struct montgomery *m, unsigned long long int a) {
+	return (unsigned long long int) (((unsigned __int128) (a % m->n) << 64) % m->n);
+}
+
+static unsigned long long int mont_pow(const struct montgomery *m, unsigned long long int a, unsigned long long int e) {
+	unsigned long long int x = m->one;
+
+	while (e > 0) {
+		if (e & 1)
+			x = mont_mul(m, x, a);
+		a = mont_mul(m, a, a);
+		e >>= 1;
+	}
+	return x;
+}
+
+/* Test if a number is prime or not using a Miller-Rabin test.  These seven
+ * bases leave no strong pseudoprime below 2^64, so the test is exact.
+ */
+static const unsigned long long int mr_bases[] = {
+	2, 325, 9375, 28178, 450775, 9780504, 1795265022
+};
+
+static const unsigned char primes[] = {
+	2, 3, 5, 7,	11, 13, 17, 19,
+	23, 29, 31, 37,	41, 43, 47, 53,
+};
+#define N_PRIMES	(sizeof(primes) / sizeof(unsigned char))
+#define QUICK_CHECK	(59*59-1)
+
+int isPrime(unsigned long long int p) {
+	struct montgomery m;
+	unsigned long long int d, x, minus1, a;
+	int i, r, s;
+
+	if (p < 2)	return 0;
+
+	/* Quick check for divisibility by small primes */
+	for (i=0; i<N_PRIMES; i++)
+		if (p == primes[i])
+			return 1;
+		else if ((p % primes[i]) == 0)
+			return 0;
+	if (p < QUICK_CHECK)
+		return 1;
+
+	mont_init(&m, p);
+	minus1 = p - m.one;
+	d = p - 1;
+	for (s = 0; (d & 1) == 0; s++)
+		d >>= 1;
+
+	for (i=0; i<sizeof(mr_bases) / sizeof(mr_bases[0]); i++) {
+		a = mr_bases[i] % p;
+		if (a == 0)
+			continue;
+		x = mont_pow(&m, mont_from(&m, a), d);
+		if (x == m.one || x == minus1)
+			continue;
+		for (r = 1; r < s && x != minus1; r++)
+			x = mont_mul(&m, x, x);
+		if (x != minus1)
+			return 0;
+	}
+	return 1;
+}
+#else
 int isPrime(unsigned long long int p) {
 #ifndef TINY_BUILD
 	int i;
@@ -1465,6 +1594,7 @@ int isPrime(unsigned long long int p) {
 #endif
 	return 1;
 }
+#endif
 
 #ifdef INCLUDE_INT_MODULO_OPS
 long long int intmodop(long long int z, long long int y, long long int x) {
@@ -1488,6 +1618,88 @@ long long int intmodop(long long int z, long long int y, long long int x) {
 
 #ifdef INCLUDE_FACTOR
 
+#ifdef INCLUDE_FAST_PRIMES
+/* Step y -> y^2 + c of Pollard's rho in Montgomery form */
+static unsigned long long int rho_step(const struct montgomery *m, unsigned long long int y, unsigned long long int c) {
+	const unsigned long long int s = mont_mul(m, y, y);
+	const unsigned long long int t = s + c;
+
+	return (t < s || t >= m->n) ? t - m->n : t;
+}
+
+/* Find a proper factor of the odd composite n by Brent's variant of Pollard's
+ * rho.  The differences are multiplied together so that one gcd serves a
+ * batch of RHO_BATCH steps, the last batch is retraced when that product
+ * lost the factor.  Should a cycle close without one another polynomial is
+ * tried.
+ */
+#define RHO_BATCH	128
+
+static unsigned long long int pollard_brent(unsigned long long int n) {
+	struct montgomery m;
+	unsigned long long int c, x, y, ys, q, g, r, k, i;
+
+	mont_init(&m, n);
+	for (c = m.one; ; c++) {
+		y = m.one + m.one;
+		r = 1;
+		q = m.one;
+		g = 1;
+		do {
+			x = y;
+			for (i=0; i<r; i++)
+				y = rho_step(&m, y, c);
+			for (k=0; k<r && g == 1; k += RHO_BATCH) {
+				ys = y;
+				for (i=0; i<RHO_BATCH && i<r-k; i++) {
+					y = rho_step(&m, y, c);
+					q = mont_mul(&m, q, x > y ? x - y : y - x);
+				}
+				g = int_gcd(q, n);
+			}
+			r += r;
+		} while (g == 1);
+		if (g == n)
+			do {
+				ys = rho_step(&m, ys, c);
+				g = int_gcd(x > ys ? x - ys : ys - x, n);
+			} while (g == 1);
+		if (g != n)
+			return g;
+	}
+}
+
+/* The least prime factor of n which has none below 59 */
+static unsigned long long int least_factor(unsigned long long int n) {
+	unsigned long long int d, e;
+
+	if (isPrime(n))
+		return n;
+	d = pollard_brent(n);
+	e = least_factor(n / d);
+	d = least_factor(d);
+	return d < e ? d : e;
+}
+
+/* Return the least prime factor of n or n itself if it is prime.  Small
+ * factors are divided out, the rest is split by Pollard's rho.
+ */
+unsigned long long int doFactor(unsigned long long int n)
+{
+	int i;
+
+	if (n <= 2) return n;
+	for (i=0; i<N_PRIMES; i++) {
+		if (n % primes[i] == 0)
+			return primes[i];
+	}
+	if (n <= QUICK_CHECK)		// the number is prime
+		return n;
+	return least_factor(n);
+}
+
+#else
+
 #ifndef TINY_BUILD
 
 // only need 8 terms for factors > 256
@@ -1613,6 +1825,7 @@ unsigned long long int doFactor(unsigned long long int n)
 #endif
 }
 #undef MAX_TERMS
+#endif
 
 
 long long int intFactor(long long int x) {
@@ -55,13 +55,13 @@ enum confirmations {
 	confirm_none=0, confirm_clall, confirm_reset, confirm_clprog, confirm_clpall
 };
 
-FLAG WasDataEntry;
+INSTANCE FLAG WasDataEntry;
 
 /* Local data to this module */
-unsigned int OpCode;
-FLAG OpCodeDisplayPending;
-FLAG GoFast;
-FLAG NonProgrammable;
+INSTANCE unsigned int OpCode;
+INSTANCE FLAG OpCodeDisplayPending;
+INSTANCE FLAG GoFast;
+INSTANCE FLAG NonProgrammable;
 
 /*
  *  Needed before definition
@@ -2548,7 +2548,7 @@ static int process(const int c) {
  */
 void process_keycode(int c)
 {
-	static int was_paused;
+	static INSTANCE int was_paused;
 	//volatile int cmdline_empty; // volatile because it's uninitialized in some cases
     int cmdline_empty = 0;        // Visual studio chokes in debug mode over the above
 
@@ -27,7 +27,7 @@ volatile FLAG WaitForLcd;
 #endif
 
 #ifdef USECURSES
-static unsigned char dots[400];
+static INSTANCE unsigned char dots[400];
 #ifdef __GNUC__
 #pragma GCC diagnostic ignored "-Wformat"
 #pragma GCC diagnostic ignored "-Wformat-extra-args"
@@ -212,6 +212,9 @@ void reset_disp(void) {
 // Console
 #ifdef USECURSES
 	int i;
+
+	if (headless_mode)
+		return;
         for (i=0; i<400; i++)
 		if (i != RCL_annun && i != BATTERY && i != LIT_EQ )
 			clr_dot(i);
@@ -219,6 +222,8 @@ void reset_disp(void) {
 	erase();
         MOVE(0, 4);
 #else
+        if (headless_mode)
+                return;
         putchar('\r');
         for (i=0; i<70; i++)
                 putchar(' ');
@@ -518,6 +523,8 @@ void finish_display(void) {
 	}
 #else
 #ifdef USECURSES
+        if (headless_mode)
+                return;
         show_disp();
         MOVE(0, 0);
         refresh();
@@ -528,7 +535,8 @@ void finish_display(void) {
         void updateScreen();
         updateScreen();
 #else
-        putchar('\r');
+        if (! headless_mode)
+                putchar('\r');
 #endif
 #endif
 }
@@ -540,7 +548,7 @@ void finish_display(void) {
 extern const char *pretty(unsigned char);
 
 static char *cleanse(const char *s) {
-        static char res[50];
+        static INSTANCE char res[50];
         char *p;
 
         for (p=res; *s != '\0'; s++) {
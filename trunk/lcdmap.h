@@ -0,0 +1,165 @@
+/* This file is part of 34S.
+ * 
+ * 34S is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * 34S is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with 34S.  If not, see <http://www.gnu.org/licenses/>.
+ * 
+ * 
+ * This file is automatically generated.
+ * Changes will not be preserved.
+ */
+
+/* LCD graphics map
+ */
+
+	M(0,	16,  7),
+	M(1,	16,  6),
+	M(2,	24,  7),
+	M(3,	16,  8),
+	M(4,	24,  6),
+	M(5,	32,  6),
+	M(6,	32,  7),
+	M(7,	40,  8),
+	M(8,	40,  7),
+	M(9,	16,  9),
+	M(10,	24,  8),
+	M(11,	24,  9),
+	M(12,	24, 10),
+	M(13,	32,  8),
+	M(14,	32,  9),
+	M(15,	32, 10),
+	M(16,	40, 10),
+	M(17,	40,  9),
+	M(18,	16, 11),
+	M(19,	16, 10),
+	M(20,	24, 11),
+	M(21,	16, 12),
+	M(22,	32, 11),
+	M(23,	40, 11),
+	M(24,	24, 12),
+	M(25,	32, 12),
+	M(26,	40, 12),
+	M(27,	16, 14),
+	M(28,	16, 13),
+	M(29,	24, 13),
+	M(30,	24, 14),
+	M(31,	32, 13),
+	M(32,	40, 13),
+	M(33,	32, 14),
+	M(34,	32, 15),
+	M(35,	40, 14),
+	M(36,	16, 16),
+	M(37,	16, 15),
+	M(38,	24, 16),
+	M(39,	16, 17),
+	M(40,	24, 15),
+	M(41,	40, 15),
+	M(42,	32, 16),
+	M(43,	40, 17),
+	M(44,	40, 16),
+	M(45,	16, 18),
+	M(46,	24, 17),
+	M(47,	24, 18),
+	M(48,	24, 19),
+	M(49,	32, 17),
+	M(50,	32, 18),
+	M(51,	32, 19),
+	M(52,	40, 19),
+	M(53,	40, 18),
+	M(54,	16, 20),
+	M(55,	16, 19),
+	M(56,	24, 20),
+	M(57,	16, 21),
+	M(58,	32, 20),
+	M(59,	40, 20),
+	M(60,	24, 21),
+	M(61,	32, 21),
+	M(62,	40, 21),
+	M(63,	16, 23),
+	M(64,	16, 22),
+	M(65,	24, 22),
+	M(66,	24, 23),
+	M(67,	32, 22),
+	M(68,	40, 22),
+	M(69,	32, 23),
+	M(70,	32, 24),
+	M(71,	40, 23),
+	M(72,	16, 25),
+	M(73,	16, 24),
+	M(74,	24, 25),
+	M(75,	16, 26),
+	M(76,	24, 24),
+	M(77,	40, 24),
+	M(78,	32, 25),
+	M(79,	40, 26),
+	M(80,	40, 25),
+	M(81,	16, 27),
+	M(82,	24, 26),
+	M(83,	24, 27),
+	M(84,	24, 28),
+	M(85,	32, 26),
+	M(86,	32, 27),
+	M(87,	32, 28),
+	M(88,	40, 28),
+	M(89,	40, 27),
+	M(90,	16, 29),
+	M(91,	16, 28),
+	M(92,	24, 29),
+	M(93,	16, 30),
+	M(94,	32, 29),
+	M(95,	40, 29),
+	M(96,	24, 30),
+	M(97,	32, 30),
+	M(98,	40, 30),
+	M(99,	20,  0),
+	M(100,	16, 31),
+	M(101,	24, 31),
+	M(102,	28,  0),
+	M(103,	32, 31),
+	M(104,	40, 31),
+	M(105,	36,  0),
+	M(106,	44,  1),
+	M(107,	44,  0),
+	M(108,	20,  2),
+	M(109,	20,  1),
+	M(110,	36,  2),
+	M(111,	28,  2),
+	M(112,	36,  1),
+	M(113,	44,  2),
+	M(114,	44,  3),
+	M(115,	20,  4),
+	M(116,	20,  3),
+	M(117,	28,  3),
+	M(118,	28,  4),
+	M(119,	36,  3),
+	M(120,	44,  4),
+	M(121,	36,  4),
+	M(122,	28,  6),
+	M(123,	20,  5),
+	M(124,	28,  5),
+	M(125,	36,  6),
+	M(126,	36,  5),
+	M(127,	44,  5),
+	M(128,	44,  6),
+	M(MANT_SIGN,	40,  6),
+	M(EXP_SIGN,	28,  1),
+	M(BIG_EQ,	12,  7),
+	M(LIT_EQ,	68,  7),
+	M(DOWN_ARR,	 4,  7),
+	M(INPUT,	76,  7),
+	M(BATTERY,	60,  7),
+	M(BEG,	52,  7),
+	M(STO_annun,	44,  7),
+	M(RCL_annun,	36,  7),
+	M(RAD,	28,  7),
+	M(DEG,	20,  7),
+	M(RPN,	20,  6),
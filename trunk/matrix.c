@@ -292,11 +292,33 @@ decNumber *matrix_getrc(decNumber *res, const decNumber *m) {
 	return res;
 }
 
+#ifdef INCLUDE_PACKED_ARITHMETIC
+/* r = a + b * k, or just b * k if a is NULL, straight from the packed
+ * elements.  Zero is returned if decNumber has to do it.
+ */
+static int packed_madd(decimal64 *r, const decimal64 *a, const decimal64 *b, const struct binnum *k) {
+	struct binnum x, t, u;
+
+	if (! binnum_from_packed(&x, (const REGISTER *) b, 0) || ! binnum_multiply(&t, &x, k))
+		return 0;
+	if (a != NULL) {
+		if (! binnum_from_packed(&x, (const REGISTER *) a, 0) || ! binnum_add(&u, &x, &t, 0))
+			return 0;
+		t = u;
+	}
+	return packed_from_binnum((REGISTER *) r, &t, 0, get_rounding_mode(), 0);
+}
+#endif
+
 // a = a + b * k -- generalised matrix add and subtract
 decNumber *matrix_genadd(decNumber *r, const decNumber *k, const decNumber *b, const decNumber *a) {
 	int arows, acols, brows, bcols;
 	decNumber s, t, u;
 	int i;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+	struct binnum kb;
+	const int packed = binnum_from_number(&kb, k);
+#endif
 
 	decimal64 *abase = matrix_decomp(a, &arows, &acols);
 	decimal64 *bbase = matrix_decomp(b, &brows, &bcols);
@@ -307,6 +329,10 @@ decNumber *matrix_genadd(decNumber *r, const decNumber *k, const decNumber *b, c
 		return NULL;
 	}
 	for (i=0; i<arows*acols; i++) {
+#ifdef INCLUDE_PACKED_ARITHMETIC
+		if (packed && packed_madd(abase + i, abase + i, bbase + i, &kb))
+			continue;
+#endif
 		decimal64ToNumber(bbase + i, &s);
 		dn_multiply(&t, &s, k);
 		decimal64ToNumber(abase + i, &s);
@@ -317,12 +343,82 @@ decNumber *matrix_genadd(decNumber *r, const decNumber *k, const decNumber *b, c
 }
 
 
+#ifdef INCLUDE_MATRIX_WORKSPACE
+/* Unpack a matrix into a workspace of decNumbers.  Transposed, the columns
+ * become contiguous which suits the right hand side of a product.
+ */
+static void matrix_unpack(decNumber *w, const decimal64 *base, int rows, int cols, int transpose) {
+	int i, j;
+
+	for (i=0; i<rows; i++)
+		for (j=0; j<cols; j++)
+			decimal64ToNumber(base++, w + (transpose ? matrix_idx(j, i, rows) : matrix_idx(i, j, cols)));
+}
+
+/* The dot product of two vectors from a workspace.  The products are exact
+ * and the sum is carried at the full working precision.
+ */
+static void matrix_dot(decNumber *sum, const decNumber *a, const decNumber *b, int n) {
+	decNumber u;
+
+	decNumberZero(sum);
+	while (n-- > 0) {
+		dn_multiply(&u, a++, b++);
+		dn_add(sum, sum, &u);
+	}
+}
+
+#ifdef INCLUDE_PACKED_ARITHMETIC
+/* The same straight from the packed elements into binary coefficients.
+ * Zero is returned if one of them is special.
+ */
+static int matrix_unpack_binnum(struct binnum *w, const decimal64 *base, int rows, int cols, int transpose) {
+	int i, j;
+
+	for (i=0; i<rows; i++)
+		for (j=0; j<cols; j++)
+			if (! binnum_from_packed(w + (transpose ? matrix_idx(j, i, rows) : matrix_idx(i, j, cols)), (const REGISTER *) base++, 0))
+				return 0;
+	return 1;
+}
+
+/* A dot product that is exact at Ctx precision throughout, so decNumber
+ * would get the same.  Zero is returned if it has to do it.
+ */
+static int matrix_dot_binnum(struct binnum *sum, const struct binnum *a, const struct binnum *b, int n) {
+	struct binnum u, s;
+
+	sum->c = 0;
+	sum->e = 0;
+	sum->digits = 1;
+	sum->neg = 0;
+	while (n-- > 0) {
+		if (! binnum_multiply(&u, a++, b++) || ! binnum_add(&s, sum, &u, 0))
+			return 0;
+		*sum = s;
+	}
+	return 1;
+}
+#endif
+#endif
+
 // Matrix multiply c = a * b, c can be a or b or overlap either
 decNumber *matrix_multiply(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *c) {
 	int arows, acols, brows, bcols;
-	decNumber sum, s, t, u;
+	decNumber sum;
 	int creg;
-	int i, j, k;
+	int i, j;
+#ifdef INCLUDE_MATRIX_WORKSPACE
+	decNumber wa[MAX_DIMENSION], wb[MAX_DIMENSION];
+	int unpacked = 0;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+	struct binnum ba[MAX_DIMENSION], bb[MAX_DIMENSION], bsum;
+	int packed;
+#endif
+#else
+	decNumber s, t, u;
+	int k;
+#endif
 	decimal64 result[MAX_DIMENSION];
 	decimal64 *rp = result;
 	decimal64 *abase = matrix_decomp(a, &arows, &acols);
@@ -339,6 +435,28 @@ decNumber *matrix_multiply(decNumber *r, const decNumber *a, const decNumber *b,
 		return NULL;
 
         busy();
+#ifdef INCLUDE_MATRIX_WORKSPACE
+#ifdef INCLUDE_PACKED_ARITHMETIC
+	packed = matrix_unpack_binnum(ba, abase, arows, acols, 0) && matrix_unpack_binnum(bb, bbase, brows, bcols, 1);
+#endif
+	for (i=0; i<arows; i++)
+		for (j=0; j<bcols; j++) {
+#ifdef INCLUDE_PACKED_ARITHMETIC
+			if (packed && matrix_dot_binnum(&bsum, ba + i * acols, bb + j * brows, acols)
+					&& packed_from_binnum((REGISTER *) rp, &bsum, 0, get_rounding_mode(), 0)) {
+				rp++;
+				continue;
+			}
+#endif
+			if (! unpacked) {
+				matrix_unpack(wa, abase, arows, acols, 0);
+				matrix_unpack(wb, bbase, brows, bcols, 1);
+				unpacked = 1;
+			}
+			matrix_dot(&sum, wa + i * acols, wb + j * brows, acols);
+			packed_from_number(rp++, &sum);
+		}
+#else
 	for (i=0; i<arows; i++)
 		for (j=0; j<bcols; j++) {
 			decNumberZero(&sum);
@@ -350,6 +468,7 @@ decNumber *matrix_multiply(decNumber *r, const decNumber *a, const decNumber *b,
 			}
 			packed_from_number(rp++, &sum);
 		}
+#endif
 	xcopy(get_reg_n(creg), result, sizeof(decimal64) * arows * bcols);
 	return r;
 }
@@ -394,6 +513,10 @@ void matrix_rowops(enum nilop op) {
 	decimal64 *base, *r1, *r2;
 	int rows, cols;
 	int i;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+	struct binnum k;
+	int packed;
+#endif
 
 	getXYZT(&m, &ydn, &zdn, &t);
 	base = matrix_decomp(&m, &rows, &cols);
@@ -408,7 +531,16 @@ badrow:		err(ERR_RANGE);
 	r1 = base + i * cols;
 
 	if (op == OP_MAT_ROW_MUL) {
+#ifdef INCLUDE_PACKED_ARITHMETIC
+		packed = binnum_from_number(&k, &zdn);
+#endif
 		for (i=0; i<cols; i++) {
+#ifdef INCLUDE_PACKED_ARITHMETIC
+			if (packed && packed_madd(r1, NULL, r1, &k)) {
+				r1++;
+				continue;
+			}
+#endif
 			decimal64ToNumber(r1, &t);
 			dn_multiply(&m, &zdn, &t);
 			packed_from_number(r1++, &m);
@@ -423,7 +555,17 @@ badrow:		err(ERR_RANGE);
 			for (i=0; i<cols; i++)
 				swap_reg((REGISTER *) r1++, (REGISTER *) r2++);
 		} else {
+#ifdef INCLUDE_PACKED_ARITHMETIC
+			packed = binnum_from_number(&k, &t);
+#endif
 			for (i=0; i<cols; i++) {
+#ifdef INCLUDE_PACKED_ARITHMETIC
+				if (packed && packed_madd(r1, r1, r2, &k)) {
+					r1++;
+					r2++;
+					continue;
+				}
+#endif
 				decimal64ToNumber(r1, &ydn);
 				decimal64ToNumber(r2++, &zdn);
 				dn_multiply(&m, &zdn, &t);
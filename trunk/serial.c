@@ -436,6 +436,7 @@ void recv_any( enum nilop op )
 		 *  Copy the data and recompute the checksums
 		 */
 		xcopy( dest, buffer, length );
+		label_index_invalidate( REGION_RAM );
 	done:
 		checksum_all();
 
@@ -29,7 +29,7 @@
 /*
  *  Define register block
  */
-STAT_DATA *StatRegs;
+INSTANCE STAT_DATA *StatRegs;
 
 #define sigmaN		(StatRegs->sN)
 #define sigmaX		(StatRegs->sX)
@@ -49,7 +49,7 @@ STAT_DATA *StatRegs;
 /*
  *  Actual size of this block (may be zero)
  */
-SMALL_INT SizeStatRegs;
+INSTANCE SMALL_INT SizeStatRegs;
 
 /*
  *  Handle block (de)allocation
@@ -355,12 +355,14 @@ void sigma_val(enum nilop op) {
 	}
 	else if (op < OP_sigmaX) {
 		decimal128 *d = (&sigmaX2Y) + (op - OP_sigmaX2Y);
+		undo_log(x, sizeof(REGISTER));
 		if (dbl)
 			x->d = *d;
 		else
 			packed_from_packed128(&(x->s), d);
 	}
 	else {
+		undo_log(x, sizeof(REGISTER));
 		x->s = (&sigmaX)[op - OP_sigmaX];
 		if (dbl)
 			packed128_from_packed(&(x->d), &(x->s));
@@ -371,6 +373,8 @@ void sigma_sum(enum nilop op) {
 	REGISTER *const x = StackBase;
 	REGISTER *const y = get_reg_n(regY_idx);
 
+	undo_log(x, sizeof(REGISTER));
+	undo_log(y, sizeof(REGISTER));
 	if (SizeStatRegs == 0) {
 		x->s = y->s = get_const(OP_ZERO, 0)->s;
 	}
@@ -760,6 +764,77 @@ void stats_sto_random(enum nilop op) {
 	taus_seed(s);
 }
 
+#ifdef INCLUDE_FAST_INCOMPLETE
+/* The continued fraction for the incomplete beta function
+ *	1 / (1 + d1 / (1 + d2 / (1 + ...)))
+ * with each partial numerator scaled by the denominators around it:
+ *	a / (a + p1 / (a+1 + p2 / (a+2 + ...)))
+ * where p(2m) = m (b-m) x and p(2m+1) = -(a+m) (a+b+m) x.  The numerators
+ * and denominators of its convergents follow from the three term recurrence
+ * A(n) = (a+n) A(n-1) + p(n) A(n-2), which needs a single division every
+ * other term where the Lentz method needs three a term.  Their magnitude is
+ * trimmed by exact powers of ten so that nothing overflows.
+ */
+static void betacf_step(decNumber *A, decNumber *A1, decNumber *B, decNumber *B1, const decNumber *q, const decNumber *p) {
+	decNumber s, t;
+
+	dn_multiply(&s, q, A);
+	dn_multiply(&t, p, A1);
+	decNumberCopy(A1, A);
+	dn_add(A, &s, &t);
+	dn_multiply(&s, q, B);
+	dn_multiply(&t, p, B1);
+	decNumberCopy(B1, B);
+	dn_add(B, &s, &t);
+}
+
+static void betacf(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *x) {
+	decNumber A, A1, B, B1, apb, m, q, p, t, u, oldr;
+	int i, e;
+
+	dn_add(&apb, a, b);
+	decNumberCopy(&A, a);
+	dn_1(&A1);
+	dn_1(&B);
+	decNumberZero(&B1);
+	decNumberZero(&m);
+	decNumberZero(&oldr);
+	dn_p1(&q, a);
+	for (i=0; i<500; i++) {
+		if (i != 0) {
+			dn_inc(&m);
+			dn_subtract(&t, b, &m);
+			dn_multiply(&u, &t, &m);
+			dn_multiply(&p, &u, x);		// p = m (b-m) x
+			dn_inc(&q);
+			betacf_step(&A, &A1, &B, &B1, &q, &p);
+			dn_inc(&q);
+		}
+		dn_add(&t, a, &m);
+		dn_add(&u, &apb, &m);
+		dn_multiply(&p, &t, &u);
+		dn_multiply(&t, &p, x);
+		dn_minus(&p, &t);			// p = -(a+m) (a+b+m) x
+		betacf_step(&A, &A1, &B, &B1, &q, &p);
+
+		e = A.exponent + A.digits;
+		if (e > 1000 || e < -1000) {
+			dn_mulpow10(&A, &A, -e);
+			dn_mulpow10(&A1, &A1, -e);
+			dn_mulpow10(&B, &B, -e);
+			dn_mulpow10(&B1, &B1, -e);
+		}
+		if (! dn_eq0(&A)) {
+			dn_divide(&t, &B, &A);
+			if (dn_eq(&t, &oldr))
+				break;
+			decNumberCopy(&oldr, &t);
+		}
+		busy();
+	}
+	dn_multiply(r, &oldr, a);
+}
+#else
 static void check_low(decNumber *d) {
 	if (dn_abs_lt(d, &const_1e_32))
 		decNumberCopy(d, &const_1e_32);
@@ -825,6 +900,73 @@ static void betacf(decNumber *r, const decNumber *a, const decNumber *b, const d
 		busy();
 	}
 }
+#endif
+
+#ifdef INCLUDE_FAST_INCOMPLETE
+/* a (ln u - (u - 1)) for the ratio u of x to its mean
+ */
+static void beta_term(decNumber *r, const decNumber *a, const decNumber *u) {
+	decNumber t, v;
+
+	dn_m1(&t, u);
+	if (dn_abs_lt(&t, &const_0_5))
+		decNumberLn1pmx(&v, &t);
+	else {
+		dn_ln(&v, u);
+		dn_subtract(&v, &v, &t);
+	}
+	dn_multiply(r, a, &v);
+}
+
+/* The factor x^a (1-x)^b / B(a, b).  Small parameters take the gamma
+ * functions themselves, which come from the table for the integer and half
+ * integer parameters of most distributions.  Otherwise it is formed
+ * relative to the mean x0 = a / (a+b):
+ *	sqrt(ab / (2 PI (a+b))) exp(a (ln u - u + 1) + b (ln v - v + 1)
+ *		+ ln gamma*(a+b) - ln gamma*(a) - ln gamma*(b))
+ * with u = x / x0 and v = (1-x) / (1-x0).  The terms linear in u and v
+ * cancel and the large logarithms of a, b and a+b never appear.
+ */
+static void beta_factor(decNumber *r, const decNumber *a, const decNumber *b, const decNumber *x, const decNumber *y) {
+	decNumber apb, s, t, u;
+
+	dn_add(&apb, a, b);
+	if (dn_lt(a, &const_20) && dn_lt(b, &const_20)) {
+		dn_ln(&t, x);
+		dn_multiply(&s, &t, a);
+		dn_ln(&t, y);
+		dn_multiply(&u, &t, b);
+		dn_add(&t, &s, &u);
+		dn_exp(&s, &t);
+		decNumberGamma(&t, &apb);
+		dn_multiply(&u, &s, &t);
+		decNumberGamma(&t, a);
+		dn_divide(&s, &u, &t);
+		decNumberGamma(&t, b);
+		dn_divide(r, &s, &t);
+		return;
+	}
+	dn_multiply(&t, x, &apb);
+	dn_divide(&u, &t, a);
+	beta_term(&s, a, &u);
+	dn_multiply(&t, y, &apb);
+	dn_divide(&u, &t, b);
+	beta_term(&t, b, &u);
+	dn_add(&s, &s, &t);
+	decNumberLnGammaStar(&t, &apb);
+	dn_add(&s, &s, &t);
+	decNumberLnGammaStar(&t, a);
+	dn_subtract(&s, &s, &t);
+	decNumberLnGammaStar(&t, b);
+	dn_subtract(&u, &s, &t);
+	dn_exp(&s, &u);
+	dn_multiply(&t, a, b);
+	dn_divide(&u, &t, &apb);
+	dn_sqrt(&t, &u);
+	dn_multiply(&u, &t, &const_recipsqrt2PI);
+	dn_multiply(r, &s, &u);
+}
+#endif
 
 /* Regularised incomplete beta function Ix(a, b)
  */
@@ -838,6 +980,12 @@ decNumber *betai(decNumber *r, const decNumber *b, const decNumber *a, const dec
 	}
 	if (dn_eq0(x) || dn_eq0(&t))
 		limit = 1;
+#ifdef INCLUDE_FAST_INCOMPLETE
+	else {
+		dn_1m(&y, x);
+		beta_factor(&w, a, b, x, &y);
+	}
+#else
 	else {
 		decNumberLnBeta(&u, a, b);
 		dn_ln(&v, x);			// v = ln(x)
@@ -849,6 +997,7 @@ decNumber *betai(decNumber *r, const decNumber *b, const decNumber *a, const dec
 		dn_add(&u, &t, &v);		// u = lng(...)+a.ln(x)+b.ln(1-x)
 		dn_exp(&w, &u);
 	}
+#endif
 	dn_add(&v, a, b);
 	dn_p2(&u, &v);				// u = a+b+2
 	dn_p1(&t, a);				// t = a+1
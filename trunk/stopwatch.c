@@ -47,50 +47,50 @@
 #define StopWatchKeyticks         (StateWhileOn._keyticks)
 #define STOPWATCH_APD_TICKS 65535 // Largest unsigned short possible in 32 bits. 1 hour 49 min
 
-TStopWatchStatus StopWatchStatus; // ={ 0, 1, 0, 0, };
+INSTANCE TStopWatchStatus StopWatchStatus; // ={ 0, 1, 0, 0, };
 
 /*
  *  KeyCallback is used to call the StopWatch from the main loop
  * And set to NULL when the StopWatch is not running
  */
-int (*KeyCallback)(int)=(int (*)(int)) NULL;
+INSTANCE int (*KeyCallback)(int)=(int (*)(int)) NULL;
 
 /*
  *  Stopwatch uses the ticker count. This is the starting point
  */
-unsigned long FirstTicker;
+INSTANCE unsigned long FirstTicker;
 
 /*
  * When resetting after a Sigma+ or a RoundTime storage, we original FirstTicker
  * here so we can compute TotalStopWatch the exact same way as StopWatch
  */
-unsigned long TotalFirstTicker;
+INSTANCE unsigned long TotalFirstTicker;
 
 /*
  * Current total stopwatch value, in ticker count. Usually set to getTicker() - TotalFirstTicker
  */
-unsigned long TotalStopWatch;
+INSTANCE unsigned long TotalStopWatch;
 
 /*
  * Current stopwatch value, in ticker count. Usually set to getTicker() - FirstTicker
  */
-unsigned long StopWatch;
+INSTANCE unsigned long StopWatch;
 
 /*
  * Index on memory to store split time
  */
-unsigned char StopWatchMemory;
+INSTANCE unsigned char StopWatchMemory;
 
 /*
  * Used to choose a memory index to store split time in
  */
-signed char StopWatchMemoryFirstDigit;
-signed char RclMemory;
+INSTANCE signed char StopWatchMemoryFirstDigit;
+INSTANCE signed char RclMemory;
 
 /*
  * Use to display the chosen memory for a while
  */
-unsigned char RclMemoryRemanentDisplay;
+INSTANCE unsigned char RclMemoryRemanentDisplay;
 
 #define STOPWATCH_RS K63
 #define STOPWATCH_EXIT K60
@@ -33,7 +33,7 @@ extern void stopwatch(enum nilop op);
 /*
  * See stopwatch.c for details on KeyCallback
  */
-extern int (*KeyCallback)(int);
+extern INSTANCE int (*KeyCallback)(int);
 
 /* Stopwatch needs a few boolean to keep track of its status
  * this is the lowest memory footprint solution
@@ -47,7 +47,7 @@ typedef struct _stopwatch_status {
 	int sigma_display_mode:1;
 } TStopWatchStatus;
 
-extern TStopWatchStatus StopWatchStatus;
+extern INSTANCE TStopWatchStatus StopWatchStatus;
 #define StopWatchRunning (StopWatchStatus.running)
 
 /*
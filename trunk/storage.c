@@ -64,37 +64,37 @@
 /*
  *  Setup the persistent RAM
  */
-PERSISTENT_RAM TPersistentRam PersistentRam;
+PERSISTENT_RAM INSTANCE TPersistentRam PersistentRam;
 
 /*
  *  Data that is saved in the SLCD controller during deep sleep
  */
-SLCDCMEM TStateWhileOn StateWhileOn;
+SLCDCMEM INSTANCE TStateWhileOn StateWhileOn;
 
 /*
  *  A private register area for XROM code in volatile RAM
  *  It replaces the local registers and flags if active.
  */
-TXromParams XromParams;
-VOLATILE_RAM TXromLocal XromLocal;
+INSTANCE TXromParams XromParams;
+VOLATILE_RAM INSTANCE TXromLocal XromLocal;
 
 /* Private space for four registers temporarily
  */
-VOLATILE_RAM REGISTER XromA2D[4];
+VOLATILE_RAM INSTANCE REGISTER XromA2D[4];
 
 /*
  *  The backup flash area:
  *  2 KB for storage of programs and registers
  *  Same data as in persistent RAM but in flash memory
  */
-BACKUP_FLASH TPersistentRam BackupFlash;
+BACKUP_FLASH INSTANCE TPersistentRam BackupFlash;
 
 #ifndef REALBUILD
 /*
  *  We need to define the Library space here.
  *  On the device the linker takes care of this.
  */
-FLASH_REGION UserFlash;
+INSTANCE FLASH_REGION UserFlash;
 #endif
 
 /*
@@ -182,6 +182,7 @@ static void stoend( void )
 {
 	ProgSize = 1;
 	Prog[ 0 ] = ( OP_NIL | OP_END );
+	label_index_invalidate( REGION_RAM );
 }
 
 
@@ -232,6 +233,7 @@ void clrprog( void )
 		if ( ProgSize == 0 ) {
 			stoend();
 		}
+		label_index_invalidate( REGION_RAM );
 	}
 	set_pc( ProgBegin - 1 );
 	update_program_bounds( 1 );
@@ -304,6 +306,7 @@ void stoprog( opcode c ) {
 		Prog_1[pc + 1] = c >> 16;
 	Prog_1[pc] = c;
 	State.pc = pc;
+	label_index_insert( pc, c );
 }
 
 
@@ -322,6 +325,7 @@ void delprog( void )
 		return;
 
 	off = isDBL( Prog_1[ pc ]) ? 2 : 1;
+	label_index_delete( pc, getprog( pc ) );
 	ProgSize -= off;
 	ProgEnd -= off;
 	for ( i = pc; i <= (int) ProgSize; ++i )
@@ -379,6 +383,7 @@ int append_program( const s_opcode *source, int length )
 	pc = ProgSize + 1;
 	ProgSize += length;
 	xcopy( Prog_1 + pc, source, length << 1 );
+	label_index_update( pc, ProgSize );
 	set_pc( pc );
 	return 0;
 }
@@ -535,6 +540,7 @@ void init_library( void )
 		lib.crc = MAGIC_MARKER;
 		xset( lib.prog, 0xff, sizeof( lib.prog ) );
 		program_flash( &UserFlash, &lib, 1 );
+		label_index_invalidate( REGION_LIBRARY );
 	}
 }
 
@@ -566,6 +572,7 @@ static int flash_append( int destination_step, const s_opcode *source, int count
 		xcopy( buffer, dest - offset_in_page, offset_in_page );
 		xcopy( buffer + offset_in_page, src, bytes );
 		if ( program_flash( dest - offset_in_page, buffer, 1 ) ) {
+			label_index_invalidate( REGION_LIBRARY );
 			return 1;
 		}
 		src += bytes;
@@ -579,6 +586,7 @@ static int flash_append( int destination_step, const s_opcode *source, int count
 		 */
 		count = ( count + ( PAGE_SIZE - 1 ) ) >> 8;
 		if ( program_flash( dest, src, count ) ) {
+			label_index_invalidate( REGION_LIBRARY );
 			return 1;
 		}
 	}
@@ -589,7 +597,13 @@ static int flash_append( int destination_step, const s_opcode *source, int count
 	xcopy( fr, &UserFlash, PAGE_SIZE );
 	fr->size = size;
 	checksum_region( &UserFlash, fr );
-	return program_flash( &UserFlash, fr, 1 );
+	if ( program_flash( &UserFlash, fr, 1 ) ) {
+		label_index_invalidate( REGION_LIBRARY );
+		return 1;
+	}
+	label_index_update( addrLIB( destination_step + 1, REGION_LIBRARY ),
+			    addrLIB( size, REGION_LIBRARY ) );
+	return 0;
 }
 
 
@@ -624,6 +638,7 @@ void flash_backup( enum nilop op )
 		else {
 			DispMsg = "Saved";
 		}
+		label_index_invalidate( REGION_BACKUP );
 	}
 }
 
@@ -636,6 +651,7 @@ void flash_restore( enum nilop op )
 		}
 		else {
 			xcopy( &PersistentRam, &BackupFlash, sizeof( PersistentRam ) );
+			label_index_invalidate( REGION_RAM );
 			init_state();
 			DispMsg = "Restored";
 		}
@@ -953,6 +969,7 @@ void load_statefile(const char *filename )
 		fread( &UserFlash, sizeof( UserFlash ), 1, f );
 		fclose( f );
 	}
+	label_index_invalidate( -1 );
 	init_library();
 
 #if !defined(QTGUI) && !defined(IOS)
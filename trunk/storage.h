@@ -35,8 +35,8 @@ typedef struct _flash_region {
         s_opcode prog[ NUMPROG_FLASH ];
 } FLASH_REGION;
 
-extern FLASH_REGION UserFlash;
-extern TPersistentRam BackupFlash;
+extern INSTANCE FLASH_REGION UserFlash;
+extern INSTANCE TPersistentRam BackupFlash;
 
 #ifndef REALBUILD
 // Flag for "Export Program..."
@@ -63,11 +63,15 @@ extern unsigned long long strtoull(const char *, char **, int);
  */
 #define TICKS_PER_FLASH	(5)
 
+#ifndef RUN_QUANTUM
+#define RUN_QUANTUM	(1)
+#endif
+
 /*
  *  A program is running
  */
-FLAG Running;
-FLAG XromRunning;
+INSTANCE FLAG Running;
+INSTANCE FLAG XromRunning;
 
 #ifndef CONSOLE
 /*
@@ -79,68 +83,68 @@ FLAG JustStopped;
 /*
  *  Count down counter for a programmed pause
  */
-volatile unsigned char Pause;
+INSTANCE volatile unsigned char Pause;
 
 /*
  *  Some long running function has called busy();
  */
-FLAG Busy;
+INSTANCE FLAG Busy;
 
 /*
  *  Error code
  */
-SMALL_INT Error;
+INSTANCE SMALL_INT Error;
 
 /*
  *  Indication of PC wrap around
  */
-FLAG PcWrapped;
+INSTANCE FLAG PcWrapped;
 
 /*
  *  Currently executed function
  */
-s_opcode XeqOpCode;
+INSTANCE s_opcode XeqOpCode;
 
 /*
  *  Temporary display (not X)
  */
-SMALL_INT ShowRegister;
+INSTANCE SMALL_INT ShowRegister;
 
 /*
  *  User code being called from XROM
  */
-SMALL_INT XromUserPc;
-SMALL_INT UserLocalRegs;
+INSTANCE SMALL_INT XromUserPc;
+INSTANCE SMALL_INT UserLocalRegs;
 
 /* We need various different math contexts.
  * More efficient to define these globally and reuse them as needed.
  */
-decContext Ctx;
+INSTANCE decContext Ctx;
 
 /*
  * A buffer for instruction display
  */
-char TraceBuffer[25];
+INSTANCE char TraceBuffer[25];
 
 /*
  *  Total Size of the return stack
  */
-SMALL_INT RetStkSize;
+INSTANCE SMALL_INT RetStkSize;
 
 /*
  *  Number of remaining program steps
  */
-SMALL_INT ProgFree;
+INSTANCE SMALL_INT ProgFree;
 
 /*
  * The actual top of the return stack
  */
-unsigned short *RetStk;
+INSTANCE unsigned short *RetStk;
 
 /*
  *  The location of the RPN stack
  */
-REGISTER *StackBase;
+INSTANCE REGISTER *StackBase;
 
 #ifdef INFRARED
 /*
@@ -153,7 +157,7 @@ FLAG Tracing;
 *	Indicates that a coordinate converstion has just happened
 */
 #ifdef RP_PREFIX
-SMALL_INT RectPolConv; // 1 - R->P just done; 2 - P->R just done
+INSTANCE SMALL_INT RectPolConv; // 1 - R->P just done; 2 - P->R just done
 #endif
 
 /*
@@ -264,12 +268,19 @@ static void raw_set_pc(unsigned int pc) {
 /*
  *  Where do the program regions start?
  */
+#ifdef INCLUDE_THREAD_INSTANCES
+/* Thread local data has no constant address, xeq_init_contexts() fills
+ * in the table for every thread.
+ */
+static INSTANCE const s_opcode *RegionTab[REGION_XROM + 1];
+#else
 static const s_opcode *const RegionTab[] = {
 	Prog,
 	UserFlash.prog,
 	BackupFlash._prog,
 	xrom
 };
+#endif
 
 /*
  *  Size of a program segment
@@ -309,6 +320,128 @@ opcode getprog(unsigned int pc) {
 }
 
 
+#ifdef INCLUDE_DECODE_CACHE
+/*
+ *  Decoded program cache
+ *
+ *  For every step of a region the assembled opcode and the address of the
+ *  following step.  A zero successor marks the steps that need the general
+ *  code in incpc(): END statements, the last step of a region and the
+ *  second word of double length instructions.
+ */
+struct decoded_step {
+	opcode op;
+	unsigned short int next;
+#ifdef INCLUDE_FUSED_STEPS
+	unsigned char fuse;
+#endif
+};
+
+#ifdef INCLUDE_FUSED_STEPS
+/*
+ *  Pairs of steps executed together by xeq_fused().  The kind is stored
+ *  with the first step of the pair.
+ */
+enum fused_kind {
+	FUSE_NONE = 0,
+	FUSE_RCL_ARITH,		// RCL nn followed by + - * /
+	FUSE_SWAP_ARITH,	// x<>y followed by + - * /
+};
+
+static unsigned char fused_kind(const opcode first, const opcode second) {
+	switch (second) {
+	case OP_DYA | OP_ADD:
+	case OP_DYA | OP_SUB:
+	case OP_DYA | OP_MUL:
+	case OP_DYA | OP_DIV:
+		break;
+	default:
+		return FUSE_NONE;
+	}
+	if (! isRARG(first) || (first & RARG_IND))
+		return FUSE_NONE;
+	if (RARG_CMD(first) == RARG_RCL)
+		return FUSE_RCL_ARITH;
+	if (RARG_CMD(first) == RARG_SWAPX && (first & RARG_MASK) == regY_idx)
+		return FUSE_SWAP_ARITH;
+	return FUSE_NONE;
+}
+#endif
+
+static INSTANCE struct {
+	struct decoded_step *steps;
+	int size;
+	int valid;
+} DecodeCache[REGION_XROM + 1];
+
+#ifdef INCLUDE_COMPILED_PROGRAMS
+/*
+ *  A program translated to C.  It is used only while its region holds
+ *  exactly the code that was translated.  Whenever a program changes the
+ *  region is checked again.
+ */
+static const struct compiled_program *Compiled;
+static INSTANCE signed char CompiledValid = -1;
+#endif
+
+static void decode_cache_invalidate(int region) {
+	int i;
+
+	for (i = 0; i <= REGION_XROM; ++i)
+		if (region < 0 || region == i)
+			DecodeCache[i].valid = 0;
+#ifdef INCLUDE_COMPILED_PROGRAMS
+	CompiledValid = -1;
+#endif
+}
+
+static void decode_region(const int region) {
+	const s_opcode *const base = RegionTab[region];
+	const int size = sizeLIB(region);
+	struct decoded_step *steps = DecodeCache[region].steps;
+	int offset, width;
+
+	if (size > DecodeCache[region].size) {
+		steps = (struct decoded_step *) realloc(steps, size * sizeof(struct decoded_step));
+		if (steps == NULL)
+			return;
+		DecodeCache[region].steps = steps;
+		DecodeCache[region].size = size;
+	}
+	xset(steps, 0, size * sizeof(struct decoded_step));
+	for (offset = 0; offset < size; offset += width) {
+		const opcode op = get_opcode(base + offset);
+		width = 1 + isDBL(op);
+		steps[offset].op = op;
+		if (op != (OP_NIL | OP_END) && offset + width < size)
+			steps[offset].next = addrLIB(offset + width + 1, region);
+	}
+#ifdef INCLUDE_FUSED_STEPS
+	for (offset = 0; offset < size; offset += width) {
+		width = 1 + isDBL(steps[offset].op);
+		if (steps[offset].next != 0 && steps[offset + width].next != 0)
+			steps[offset].fuse = fused_kind(steps[offset].op, steps[offset + width].op);
+	}
+#endif
+	DecodeCache[region].valid = 1;
+}
+
+/* The decoded step at pc or NULL if it has to be handled the slow way */
+static const struct decoded_step *decoded_step(const unsigned int pc) {
+	const int region = nLIB(pc);
+	const int offset = offsetLIB(pc);
+	const struct decoded_step *d;
+
+	if (! DecodeCache[region].valid)
+		decode_region(region);
+	if (! DecodeCache[region].valid || offset < 0 || offset >= sizeLIB(region))
+		return NULL;
+	d = DecodeCache[region].steps + offset;
+	return d->next != 0 ? d : NULL;
+}
+#endif
+
+
 /* 
  * Return the physical start-address of the current program
  */
@@ -565,7 +698,7 @@ static void error(const char *fmt, ...) {
 
 /* Real rounding mode access routine
  */
-static enum rounding get_rounding_mode() {
+enum rounding get_rounding_mode(void) {
 	static const unsigned char modes[DEC_ROUND_MAX] = {
 		DEC_ROUND_HALF_EVEN, DEC_ROUND_HALF_UP, DEC_ROUND_HALF_DOWN,
 		DEC_ROUND_UP, DEC_ROUND_DOWN,
@@ -639,11 +772,23 @@ void rarg_round(unsigned int arg, enum rarg op) {
  * A value is bogus if it is infinite, NaN *and* flag D is not set.
  * If flag D is set, these values are allowed through just fine.
  */
+/* A finite value more than one decade below the overflow threshold
+ * can't round to infinity when it is packed into a register.
+ */
+static int safe_to_store(const decNumber *x) {
+	return ! decNumberIsSpecial(x)
+		&& x->exponent + x->digits <= (is_dblmode() ? DECIMAL128_Emax : DECIMAL64_Emax);
+}
+
 static int check_special(const decNumber *x) {
 	decNumber y;
 	decimal64 z;
 	decimal128 d;
-	if (is_dblmode()) {
+	const int dbl = is_dblmode();
+
+	if (safe_to_store(x))
+		return 0;
+	if (dbl) {
 		packed128_from_number(&d, x);
 		decimal128ToNumber(&d, &y);
 	}
@@ -681,8 +826,101 @@ static REGISTER *get_stack_top(void) {
 	return get_stack(stack_size()-1);
 }
 
+#ifdef INCLUDE_UNDO_JOURNAL
+/*
+ *  Undo journal for xeq().
+ *  Each active xeq() frame covers the same window that used to be copied
+ *  in full before every instruction.  The window is split into eight byte
+ *  slots.  The first write to a slot saves its old contents, an error puts
+ *  back only the saved slots.
+ */
+#define UNDO_SIZE	(sizeof(REGISTER) * (STACK_SIZE+2))
+#define UNDO_SLOTS	(UNDO_SIZE / sizeof(decimal64))
+#define UNDO_ALL	((1UL << UNDO_SLOTS) - 1)
+
+struct undo_journal {
+	struct undo_journal *outer;
+	decimal64 *base;
+	unsigned long saved;
+	decimal64 save[UNDO_SLOTS];
+};
+
+static INSTANCE struct undo_journal *Journal;
+
+static void undo_begin(struct undo_journal *j) {
+	j->outer = Journal;
+	j->base = &(StackBase->s);
+	j->saved = 0;
+	Journal = j;
+}
+
+static void undo_end(struct undo_journal *j) {
+	Journal = j->outer;
+}
+
+/*
+ *  Put back what the failed instruction has overwritten.
+ *  If the stack has moved meanwhile the whole window has been saved
+ *  and goes to the new location, like the full copy did.
+ */
+static void undo_rollback(struct undo_journal *j) {
+	unsigned long saved = j->saved;
+	int i;
+
+	if (saved == UNDO_ALL)
+		xcopy(StackBase, j->save, UNDO_SIZE);
+	else
+		for (i = 0; saved != 0; ++i, saved >>= 1)
+			if (saved & 1)
+				j->base[i] = j->save[i];
+}
+
+/*
+ *  Called before n bytes at p are written.
+ *  Every active frame saves the slots of its window that are hit for the
+ *  first time.
+ */
+void undo_log(const void *p, int n) {
+	struct undo_journal *j;
+	const char *const start = (const char *) p;
+
+	for (j = Journal; j != NULL; j = j->outer) {
+		const char *const base = (const char *) j->base;
+		int lo, hi;
+
+		if (start + n <= base || start >= base + UNDO_SIZE || j->saved == UNDO_ALL)
+			continue;
+		lo = start < base ? 0 : (int) (start - base) / sizeof(decimal64);
+		hi = start + n >= base + UNDO_SIZE ? UNDO_SLOTS - 1
+						   : (int) (start + n - 1 - base) / sizeof(decimal64);
+		for (; lo <= hi; ++lo) {
+			const unsigned long bit = 1UL << lo;
+
+			if ((j->saved & bit) == 0) {
+				j->save[lo] = j->base[lo];
+				j->saved |= bit;
+			}
+		}
+	}
+}
+#endif
+
+/*
+ *  Move the stack, e.g. on a precision or integer mode change or xIN/xOUT.
+ *  A pending undo needs the complete old stack in that case.
+ */
+static void set_stack_base(REGISTER *base) {
+	if (base != StackBase) {
+		undo_log(StackBase, sizeof(REGISTER) * (STACK_SIZE+2));
+		StackBase = base;
+	}
+}
+
 void copyreg(REGISTER *d, const REGISTER *s) {
-	xcopy(d, s, is_dblmode() ? sizeof(decimal128) : sizeof(decimal64));
+	const int n = is_dblmode() ? sizeof(decimal128) : sizeof(decimal64);
+
+	undo_log(d, n);
+	xcopy(d, s, n);
 }
 
 void copyreg_n(int d, int s) {
@@ -747,12 +985,80 @@ static void setlastXY(void) {
 }
 
 
+#ifdef INCLUDE_REGISTER_CACHE
+/*
+ *  Unpacked copies of recently used register values.
+ *  Entries are looked up by the packed contents of the register, so
+ *  stack lifts and drops, register moves and direct writes to register
+ *  memory need no bookkeeping: a changed register simply doesn't match.
+ */
+#define REG_CACHE_SIZE	16
+
+typedef union {
+	REGISTER r;
+	unsigned int w[4];
+} REG_KEY;
+
+struct reg_cache {
+	REG_KEY packed;
+	unsigned char mode;	// 0 = empty, 1 = decimal64, 2 = decimal128
+	decNumber dn;
+};
+
+static INSTANCE struct reg_cache RegCache[REG_CACHE_SIZE];
+
+/*
+ *  Find the cache entry for the value of a register.
+ *  key receives an aligned copy of the packed value and slot the entry
+ *  it belongs to.  Returns the entry if it holds that value.
+ */
+static struct reg_cache *reg_cache_find(const REGISTER *reg, REG_KEY *key, struct reg_cache **slot) {
+	const int dbl = is_dblmode();
+	struct reg_cache *c;
+	unsigned int h;
+
+	if (dbl)
+		key->r.d = reg->d;
+	else
+		key->r.s = reg->s;
+	h = key->w[0] ^ key->w[1];
+	if (dbl)
+		h ^= key->w[2] ^ key->w[3];
+	h ^= h >> 16;
+	h ^= h >> 8;
+	c = RegCache + (h & (REG_CACHE_SIZE - 1));
+	*slot = c;
+	if (c->mode != dbl + 1 || c->packed.w[0] != key->w[0] || c->packed.w[1] != key->w[1])
+		return NULL;
+	if (dbl && (c->packed.w[2] != key->w[2] || c->packed.w[3] != key->w[3]))
+		return NULL;
+	return c;
+}
+
+static void reg_cache_store(struct reg_cache *c, const REG_KEY *key, const decNumber *x) {
+	c->packed = *key;
+	c->mode = is_dblmode() + 1;
+	decNumberCopy(&(c->dn), x);
+}
+#endif
+
 decNumber *getRegister(decNumber *r, int index) {
 	const REGISTER *const reg = get_reg_n(index);
+#ifdef INCLUDE_REGISTER_CACHE
+	REG_KEY key;
+	struct reg_cache *slot;
+	const struct reg_cache *c = reg_cache_find(reg, &key, &slot);
+
+	if (c != NULL)
+		return decNumberCopy(r, &(c->dn));
+#endif
 	if (is_dblmode())
 		decimal128ToNumber(&(reg->d), r);
 	else
 		decimal64ToNumber(&(reg->s), r);
+#ifdef INCLUDE_REGISTER_CACHE
+	reg_cache_store(slot, &key, r);
+#endif
 	return r;
 }
 
@@ -762,10 +1068,31 @@ void setRegister(int index, const decNumber *x) {
 
 	if (! check_special(x)) {	/* This correctly deals with infinities and NaN based on flag D */
 		decNumberNormalize(&dn, x, &Ctx);
-		if (is_dblmode())
+		if (is_dblmode()) {
+			undo_log(reg, sizeof(decimal128));
 			packed128_from_number(&(reg->d), &dn);
-		else
+		}
+		else {
+			undo_log(reg, sizeof(decimal64));
 			packed_from_number(&(reg->s), &dn);
+		}
+#ifdef INCLUDE_REGISTER_CACHE
+		/* Remember the unpacked value if packing didn't change it */
+		if (! decNumberIsSpecial(&dn)) {
+			const int dbl = is_dblmode();
+			const int digits = dbl ? DECIMAL128_Pmax : DECIMAL64_Pmax;
+			const int emin = (dbl ? DECIMAL128_Emin : DECIMAL64_Emin) - digits + 1;
+			const int emax = (dbl ? DECIMAL128_Emax : DECIMAL64_Emax) - digits + 1;
+
+			if (dn.digits <= digits && dn.exponent >= emin && dn.exponent <= emax) {
+				REG_KEY key;
+				struct reg_cache *slot;
+
+				reg_cache_find(reg, &key, &slot);
+				reg_cache_store(slot, &key, &dn);
+			}
+		}
+#endif
 	}
 }
 
@@ -1173,7 +1500,7 @@ REGISTER *get_flash_reg_n(int n) {
  */
 REGISTER *get_const(int index, int dbl)
 {
-	static REGISTER result;
+	static INSTANCE REGISTER result;
 	const int i = cnsts[index].index;
 	if (dbl) {
 		if (i <= 1 || i >= 128)
@@ -1199,7 +1526,10 @@ long long int get_reg_n_int(int index) {
 }
 
 void set_reg_n_int(int index, long long int ll) {
-	xcopy(get_reg_n(index), &ll, sizeof(ll));
+	REGISTER *const reg = get_reg_n(index);
+
+	undo_log(reg, sizeof(ll));
+	xcopy(reg, &ll, sizeof(ll));
 }
 
 /* Get an integer from a register
@@ -1309,13 +1639,16 @@ void zero_regs(REGISTER *dest, int n) {
 #else
 	// This works for all modes
 	// no it doesn't -- it leaves varying values of zero around
-	xset(dest, 0, n << (3 + is_dblmode()));
+	n <<= 3 + is_dblmode();
+	undo_log(dest, n);
+	xset(dest, 0, n);
 #endif
 }
 
 void move_regs(REGISTER *dest, REGISTER *src, int n) {
 	if (is_dblmode())
 		n <<= 1;
+	undo_log(dest, n << 3);
 	xcopy(dest, src, n << 3);
 }
 
@@ -1410,6 +1743,42 @@ void cmdconst(unsigned int arg, enum rarg op) {
  * These two are pretty much the same so we define some utility routines first.
  */
 
+#ifdef INCLUDE_PACKED_ARITHMETIC
+/* Work out y + x, y - x or y * x straight from the packed registers.
+ * Zero is returned if decNumber has to do it.
+ */
+static int packed_dyadic(REGISTER *r, int y, int x, unsigned int f) {
+	const int dbl = is_dblmode();
+	struct binnum a, b, s;
+
+	if (f != OP_ADD && f != OP_SUB && f != OP_MUL)
+		return 0;
+	if (! binnum_from_packed(&a, get_reg_n(y), dbl) || ! binnum_from_packed(&b, get_reg_n(x), dbl))
+		return 0;
+	if (f == OP_MUL) {
+		if (! binnum_multiply(&s, &a, &b))
+			return 0;
+	} else if (! binnum_add(&s, &a, &b, f == OP_SUB))
+		return 0;
+	return packed_from_binnum(r, &s, dbl, get_rounding_mode(), 1);
+}
+
+/* Change the sign of a register, 0 - x like dn_minus()
+ */
+static int packed_minus(REGISTER *r, int x) {
+	const int dbl = is_dblmode();
+	struct binnum a, zero, s;
+
+	if (! binnum_from_packed(&a, get_reg_n(x), dbl))
+		return 0;
+	zero.c = 0;
+	zero.e = a.e;
+	zero.digits = 1;
+	zero.neg = 0;
+	return binnum_add(&s, &zero, &a, 1) && packed_from_binnum(r, &s, dbl, get_rounding_mode(), 1);
+}
+#endif
+
 /* Do a basic STO/RCL arithmetic operation.
  */
 static int storcl_op(unsigned short opr, int index, decNumber *r, int rev) {
@@ -1498,7 +1867,15 @@ void cmdsto(unsigned int arg, enum rarg op) {
 			set_reg_n_int(arg, r);
 		} else {
 			decNumber r;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+			// STO and RCL operators are in dyadic order
+			REGISTER p;
 
+			if (packed_dyadic(&p, arg, regX_idx, op - RARG_STO)) {
+				copyreg(get_reg_n(arg), &p);
+				return;
+			}
+#endif
 			if (storcl_op(op - RARG_STO, arg, &r, 0))
 				illegal(op);
 			setRegister(arg, &r);
@@ -1524,7 +1901,15 @@ static void do_rcl(int index, enum rarg op) {
 			setX_int(r);
 		} else {
 			decNumber r;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+			REGISTER p;
 
+			if (packed_dyadic(&p, regX_idx, index, op - RARG_RCL)) {
+				setlastX();
+				copyreg(StackBase, &p);
+				return;
+			}
+#endif
 			if (storcl_op(op - RARG_RCL, index, &r, 1))
 				illegal(op);
 			setlastX();
@@ -1935,6 +2320,186 @@ static void retstk_up(void)
 }
 
 
+#ifdef INCLUDE_LABEL_INDEX
+/*
+ *  Label index
+ *
+ *  For each program region a table of all the labels sorted by opcode
+ *  and address.  The tables are built on first use and are kept up to
+ *  date by the routines that change program memory.  The same calls
+ *  throw away the decoded steps of the region.
+ */
+struct label_entry {
+	opcode op;
+	unsigned short int pc;
+};
+
+static INSTANCE struct label_index {
+	struct label_entry *table;
+	int count, max;
+	int valid;
+} LabelIndex[REGION_XROM + 1];
+
+static int is_label_opcode(const opcode op) {
+	if (isDBL(op))
+		return opDBL(op) == DBL_LBL;
+	return isRARG(op) && RARG_CMD(op) == RARG_LBL;
+}
+
+/* Index of the first entry not less than (op, pc) */
+static int label_index_search(const struct label_index *li, const opcode op, const unsigned int pc) {
+	int lo = 0, hi = li->count;
+
+	while (lo < hi) {
+		const int mid = (lo + hi) >> 1;
+		const struct label_entry *e = li->table + mid;
+		if (e->op < op || (e->op == op && e->pc < pc))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+static void label_index_add(struct label_index *li, const opcode op, const unsigned int pc) {
+	const int i = label_index_search(li, op, pc);
+
+	if (li->count == li->max) {
+		struct label_entry *t = (struct label_entry *) realloc(li->table, (li->max + 32) * sizeof(struct label_entry));
+		if (t == NULL) {
+			li->valid = 0;
+			return;
+		}
+		li->table = t;
+		li->max += 32;
+	}
+	memmove(li->table + i + 1, li->table + i, (li->count - i) * sizeof(struct label_entry));
+	li->table[i].op = op;
+	li->table[i].pc = pc;
+	++li->count;
+}
+
+/* Add the labels between from and to (inclusive), both in the same region */
+static void label_index_scan(struct label_index *li, unsigned int from, const unsigned int to) {
+	while (li->valid && from <= to) {
+		const opcode op = getprog(from);
+		if (is_label_opcode(op))
+			label_index_add(li, op, from);
+		from += 1 + isDBL(op);
+	}
+}
+
+static struct label_index *label_index_get(const int region) {
+	struct label_index *li = LabelIndex + region;
+	const unsigned int base = region == REGION_RAM ? 0 : addrLIB(0, region);
+
+	if (! li->valid) {
+		li->count = 0;
+		li->valid = 1;
+		label_index_scan(li, base + 1, base + sizeLIB(region));
+	}
+	return li;
+}
+
+/* Forget a region or, if negative, all of them.
+ * Must be called whenever program memory is changed wholesale.
+ */
+void label_index_invalidate(int region) {
+	int i;
+
+#ifdef INCLUDE_DECODE_CACHE
+	decode_cache_invalidate(region);
+#endif
+	for (i = 0; i <= REGION_XROM; ++i)
+		if (region < 0 || region == i)
+			LabelIndex[i].valid = 0;
+}
+
+/* Move the entries at or after pc by the given number of words */
+static void label_index_move(struct label_index *li, const unsigned int pc, const int distance) {
+	int i;
+
+	for (i = 0; i < li->count; ++i)
+		if (li->table[i].pc >= pc)
+			li->table[i].pc += distance;
+}
+
+/* Op has been stored at pc, everything from there on moved up */
+void label_index_insert(unsigned int pc, opcode op) {
+	struct label_index *li = LabelIndex + nLIB(pc);
+
+#ifdef INCLUDE_DECODE_CACHE
+	decode_cache_invalidate(nLIB(pc));
+#endif
+	if (li->valid) {
+		label_index_move(li, pc, 1 + isDBL(op));
+		if (is_label_opcode(op))
+			label_index_add(li, op, pc);
+	}
+}
+
+/* Op at pc is about to be deleted, everything after it moves down */
+void label_index_delete(unsigned int pc, opcode op) {
+	struct label_index *li = LabelIndex + nLIB(pc);
+
+#ifdef INCLUDE_DECODE_CACHE
+	decode_cache_invalidate(nLIB(pc));
+#endif
+	if (li->valid) {
+		if (is_label_opcode(op)) {
+			const int i = label_index_search(li, op, pc);
+			if (i < li->count && li->table[i].op == op && li->table[i].pc == pc) {
+				--li->count;
+				memmove(li->table + i, li->table + i + 1, (li->count - i) * sizeof(struct label_entry));
+			}
+		}
+		label_index_move(li, pc + 1, -1 - isDBL(op));
+	}
+}
+
+/* The steps from 'from' to 'to' have been rewritten and anything
+ * beyond 'to' is gone
+ */
+void label_index_update(unsigned int from, unsigned int to) {
+	struct label_index *li = LabelIndex + nLIB(from);
+	int i, j;
+
+#ifdef INCLUDE_DECODE_CACHE
+	decode_cache_invalidate(nLIB(from));
+#endif
+	if (li->valid) {
+		for (i = j = 0; i < li->count; ++i)
+			if (li->table[i].pc < from)
+				li->table[j++] = li->table[i];
+		li->count = j;
+		label_index_scan(li, from, to);
+	}
+}
+
+/* Search the index for label l like find_opcode_from() would: starting
+ * at pc, wrapping around within top and bottom.
+ */
+static unsigned int label_index_find(const unsigned int pc, const opcode l, const unsigned int top, const unsigned int bottom) {
+	const struct label_index *li = label_index_get(nLIB(top));
+	unsigned int start = pc;
+	int i;
+
+	if (pc < top || pc > bottom) {
+		if (getprog(pc) == l)
+			return pc;
+		start = top;
+	}
+	i = label_index_search(li, l, start);
+	if (i < li->count && li->table[i].op == l && li->table[i].pc <= bottom)
+		return li->table[i].pc;
+	i = label_index_search(li, l, top);
+	if (i < li->count && li->table[i].op == l && li->table[i].pc < start)
+		return li->table[i].pc;
+	return 0;
+}
+#endif
+
+
 /* Search from the given position for the specified numeric label.
  */
 unsigned int find_opcode_from(unsigned int pc, const opcode l, const int flags) {
@@ -1945,6 +2510,14 @@ unsigned int find_opcode_from(unsigned int pc, const opcode l, const int flags)
 
 	count = 1 + find_section_bounds(pc, endp, &top);
 	count -= top;
+#ifdef INCLUDE_LABEL_INDEX
+	if (is_label_opcode(l)) {
+		pc = label_index_find(pc, l, top, top + count - 1);
+		if (pc != 0)
+			return pc;
+		count = 0;
+	}
+#endif
 	while (count--) {
 		// Wrap around doesn't hurt, we just limit the search to the number of possible steps
 		// If we don't find the label, we may search a little too far if many double word
@@ -3435,6 +4008,7 @@ void op_float(enum nilop op) {
 			else if (is_dblmode()) {
 				// expand the other registers which have been left
 				// in decimal64 format by the integer mode switch
+				undo_log(get_reg_n(i), sizeof(decimal128));
 				packed128_from_packed(&(get_reg_n(i)->d), Regs + i);
 			}
 		}
@@ -3443,7 +4017,7 @@ void op_float(enum nilop op) {
 		UState.fract = 0;
 		State2.hms = (op == OP_HMS) ? 1 : 0;
 	}
-	StackBase = get_reg_n(regX_idx);
+	set_stack_base(get_reg_n(regX_idx));
 }
 
 /*  Switch to integer mode.
@@ -3461,6 +4035,7 @@ static void switch_to_int(void) {
 		}
 		else if (dbl) {
 			// compress the other registers to save them while integer mode is active
+			undo_log(Regs + i, sizeof(decimal64));
 			packed_from_packed128(Regs + i, &(get_reg_n(i)->d));
 		}
 	}
@@ -3496,6 +4071,7 @@ void op_fract(enum nilop op) {
 /* Save and restore user state.
  */
 void cmdsavem(unsigned int arg, enum rarg op) {
+	undo_log( get_reg_n(arg), sizeof(unsigned long long int) );
 	xcopy( get_reg_n(arg), &UState, sizeof(unsigned long long int) );
 }
 
@@ -3719,10 +4295,18 @@ static void specials(const opcode op) {
 			set_lift();
 		} else {
 			decNumber x, r;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+			REGISTER p;
 
-			getX(&x);
-			dn_minus(&r, &x);
-			setX(&r);
+			if (packed_minus(&p, regX_idx))
+				copyreg(StackBase, &p);
+			else
+#endif
+			{
+				getX(&x);
+				dn_minus(&r, &x);
+				setX(&r);
+			}
 			set_lift();
 		}
 		break;
@@ -3822,6 +4406,7 @@ void op_double(enum nilop op) {
 			if (! intm) {
 				// Convert X to K to double precision
 				// Avoid this in integer mode
+				undo_log(get_stack(0), (STACK_SIZE + EXTRA_REG) * sizeof(decimal128));
 				for (i = 0; i < STACK_SIZE + EXTRA_REG; ++i)
 					packed128_from_packed(&(get_stack(i)->d), Regs + regX_idx + i);
 			}
@@ -3830,6 +4415,7 @@ void op_double(enum nilop op) {
 			if (! intm) {
 				// Convert X to K to single precision
 				// Avoid this in integer mode
+				undo_log(Regs + regX_idx, (STACK_SIZE + EXTRA_REG) * sizeof(decimal64));
 				for (i = STACK_SIZE + EXTRA_REG - 1; i >= 0; --i)
 					packed_from_packed128(Regs + regX_idx + i, &(get_stack(i)->d));
 			}
@@ -3838,7 +4424,7 @@ void op_double(enum nilop op) {
 				cmdregs(TOPREALREG, RARG_REGS);
 		}
 	}
-	StackBase = get_reg_n(regX_idx);
+	set_stack_base(get_reg_n(regX_idx));
 	if (intm) {
 		// Do the necessary conversions from integer mode
 		op_float(OP_FLOAT_XIN);
@@ -3914,9 +4500,15 @@ void XisPrime(enum nilop op) {
 		getX(&x);
 		if (decNumberIsSpecial(&x))
 			sgn = 1; // not prime
-		else if (dn_ge(&x, &const_2pow64))
+		else if (dn_ge(&x, &const_2pow64)) {
+#ifdef INCLUDE_FAST_PRIMES
+			err(ERR_DOMAIN);
+			return;
+#else
 			// isPrime() reports domain error for numbers with bit 63 set
 			i = 0xFFFFFFFFFFFFFFFFull;
+#endif
+		}
 	}
 	fin_tst(sgn == 0 && isPrime(i));
 }
@@ -4064,9 +4656,26 @@ void op_regclr(enum nilop op) {
 	zero_regs(get_reg_n(s), n);
 }
 
+/* Test register index against the pivot, less than for sense < 0 and
+ * greater than for sense > 0.
+ */
+static int regsort_test(int index, const REGISTER *pp, const decNumber *pivot, int sense) {
+	decNumber a;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+	const int dbl = is_dblmode();
+	struct binnum x, y;
+
+	if (binnum_from_packed(&x, get_reg_n(index), dbl) && binnum_from_packed(&y, pp, dbl))
+		return binnum_compare(&x, &y) == sense;
+#endif
+	getRegister(&a, index);
+	return sense < 0 ? dn_lt(&a, pivot) : dn_gt(&a, pivot);
+}
+
 void op_regsort(enum nilop op) {
 	int s, n;
-	decNumber pivot, a;
+	decNumber pivot;
+	REGISTER pp;
 	int beg[10], end[10], i;
 
 	if (reg_decode(&s, &n, NULL, 0) || n == 1)
@@ -4082,18 +4691,17 @@ void op_regsort(enum nilop op) {
 		if (L<R) {
 			const int pvt = s + L;
 			getRegister(&pivot, pvt);
+			copyreg(&pp, get_reg_n(pvt));
 			while (L<R) {
 				while (L<R) {
-					getRegister(&a, s + R);
-					if (dn_lt(&a, &pivot))
+					if (regsort_test(s + R, &pp, &pivot, -1))
 						break;
 					R--;
 				}
 				if (L<R)
 					copyreg_n(s + L++, s + R);
 				while (L<R) {
-					getRegister(&a, s + L);
-					if (dn_gt(&a, &pivot))
+					if (regsort_test(s + L, &pp, &pivot, 1))
 						break;
 					L++;
 				}
@@ -4251,6 +4859,263 @@ static long long int intResult(decNumber *r) {
 }
 
 
+#ifdef INCLUDE_GUARD_DIGITS
+/*
+ *  Single precision results of the costlier real functions are first
+ *  evaluated to GUARD_DIGITS digits.  The result stands if it rounds alike
+ *  at both ends of a bound on its error, otherwise the function is evaluated
+ *  again at full precision.  The bounds come from comparing against full
+ *  precision with a wide margin: logarithms and arc tangents stay within ten
+ *  units of the last guard digit, exponentials and powers within one unit
+ *  per unit of the logarithm of the result.  The Lanczos sum behind the gamma
+ *  functions loses about nine digits and shifts of the argument lose its
+ *  tail, so these use more guard digits and bound the absolute error of the
+ *  log gamma by the sensitivity to the argument.
+ */
+#define GUARD_DIGITS		26
+#define GUARD_GAMMA_DIGITS	30
+
+enum guard_class {
+	GUARD_NONE, GUARD_RELATIVE, GUARD_EXPONENTIAL, GUARD_LNGAMMA, GUARD_GAMMA
+};
+
+static enum guard_class guard_class(unsigned int operands, unsigned int f) {
+	if (is_dblmode())
+		return GUARD_NONE;
+	if (operands == 2)
+		return f == OP_POW ? GUARD_EXPONENTIAL : GUARD_NONE;
+	switch (f) {
+	case OP_LN:	case OP_LOG:	case OP_LG2:	case OP_ATAN:
+		return GUARD_RELATIVE;
+	case OP_EXP:	case OP_2POWX:	case OP_10POWX:
+		return GUARD_EXPONENTIAL;
+	case OP_LNGAMMA:
+		return GUARD_LNGAMMA;
+	case OP_GAMMA:	case OP_FACT:
+		return GUARD_GAMMA;
+	}
+	return GUARD_NONE;
+}
+
+/* |x| < 10^magnitude(x) */
+static int magnitude(const decNumber *x) {
+	return x->exponent + x->digits;
+}
+
+static int digits_of(int n) {
+	int d = 1;
+
+	while (n >= 10) {
+		n /= 10;
+		d++;
+	}
+	return d;
+}
+
+static int imax(int a, int b) {
+	return a > b ? a : b;
+}
+
+/* Power of ten bounding the absolute error of the log gamma of x in units
+ * of the last guard digit: the Lanczos sum plus 100 max(1, |x|) times the
+ * derivative, which grows like ln |x|, 1/|x| near zero and 1/d at a distance
+ * d from a negative integer.
+ */
+static int lngamma_bound(const decNumber *x) {
+	const int mx = magnitude(x);
+	const int t = imax(mx, 0) + 2;
+	int k = imax(10, t + digits_of(3 * (abs(mx) + 1)));
+	decNumber d;
+
+	if (mx <= 0)
+		k = imax(k, 3 - mx);
+	if (decNumberIsNegative(x)) {
+		decNumberRound(&d, x);
+		dn_subtract(&d, x, &d);
+		k = imax(k, t + 1 - magnitude(&d));
+	}
+	return k + 1;
+}
+
+/* Does the guard result r round alike at both ends of its error bound?
+ */
+static int guard_accept(enum guard_class c, const decNumber *r, const decNumber *x, unsigned int f, int digits) {
+	decContext ctx64;
+	decNumber e, lo, hi, x1;
+	int k;
+
+	if (decNumberIsSpecial(r))
+		return 1;
+	switch (c) {
+	case GUARD_RELATIVE:
+	case GUARD_EXPONENTIAL:
+		if (dn_eq0(r))
+			return 1;
+		k = magnitude(r) + 3;
+		if (c == GUARD_EXPONENTIAL)
+			k += digits_of(3 * (abs(magnitude(r)) + 1));
+		break;
+	default:
+		if (f == OP_FACT)
+			x = dn_p1(&x1, x);
+		k = lngamma_bound(x);
+		if (c == GUARD_GAMMA)
+			k += magnitude(r);
+		break;
+	}
+	decNumberZero(&e);
+	e.lsu[0] = 1;
+	e.exponent = k + 1 - digits;
+
+	decContextDefault(&ctx64, DEC_INIT_DECIMAL64);
+	ctx64.round = get_rounding_mode();
+	dn_subtract(&lo, r, &e);
+	dn_add(&hi, r, &e);
+	decNumberPlus(&lo, &lo, &ctx64);
+	decNumberPlus(&hi, &hi, &ctx64);
+	return dn_eq(&lo, &hi);
+}
+
+/* Call a monadic (y == NULL) or dyadic real function, with guard digits
+ * first where that is worth it.
+ */
+static void *guarded_real(void (*fp)(void), unsigned int f, decNumber *r, const decNumber *y, const decNumber *x) {
+	const unsigned int operands = y == NULL ? 1 : 2;
+	const enum guard_class c = guard_class(operands, f);
+	const int digits = Ctx.digits;
+	int guard;
+	void *res;
+
+	if (c != GUARD_NONE) {
+		guard = c >= GUARD_LNGAMMA ? GUARD_GAMMA_DIGITS : GUARD_DIGITS;
+		Ctx.digits = guard;
+		res = operands == 1 ? ((FP_MONADIC_REAL) fp)(r, x) : ((FP_DYADIC_REAL) fp)(r, y, x);
+		Ctx.digits = digits;
+		if (res == NULL || guard_accept(c, r, x, f, guard))
+			return res;
+	}
+	return operands == 1 ? ((FP_MONADIC_REAL) fp)(r, x) : ((FP_DYADIC_REAL) fp)(r, y, x);
+}
+#endif
+
+#ifdef INCLUDE_RESULT_CACHE
+/*
+ *  Results of the costlier pure real functions.  Iterative routines often
+ *  evaluate these again on the very same arguments, so the last results are
+ *  kept in a small two way set associative cache.  The key is the function,
+ *  the packed operand registers and the modes a result can depend on: angle
+ *  mode, double precision and rounding.  Only results without an error are
+ *  kept and a hit still goes through setX() so range errors are raised as
+ *  before.  Functions that read other registers, flags or the random number
+ *  generator are never cached.
+ */
+#define RESULT_CACHE_SETS	32
+
+struct result_cache_entry {
+	unsigned short fn;		// operands in the high byte, 0 when unused
+	unsigned char modes;
+	REGISTER x, y;
+	decNumber r;
+};
+
+static INSTANCE struct {
+	struct result_cache_entry way[2];
+	unsigned char last;		// way used most recently
+} ResultCache[RESULT_CACHE_SETS];
+
+INSTANCE unsigned int ResultCacheHits, ResultCacheMisses;
+
+static int result_cacheable(unsigned int operands, unsigned int f) {
+	if (operands == 2) {
+		switch (f) {
+		case OP_POW:	case OP_LOGXY:	case OP_ATAN2:	case OP_LNBETA:
+		case OP_GAMMAg:	case OP_GAMMAG:	case OP_GAMMAP:	case OP_GAMMAQ:
+		case OP_COMB:	case OP_PERM:
+#ifdef INCLUDE_XROOT
+		case OP_XROOT:
+#endif
+			return 1;
+		}
+		return 0;
+	}
+	switch (f) {
+	case OP_LN:	case OP_EXP:	case OP_LOG:	case OP_LG2:
+	case OP_2POWX:	case OP_10POWX:	case OP_LN1P:	case OP_EXPM1:
+	case OP_SIN:	case OP_COS:	case OP_TAN:	case OP_SINC:
+	case OP_ASIN:	case OP_ACOS:	case OP_ATAN:
+	case OP_SINH:	case OP_COSH:	case OP_TANH:
+	case OP_ASINH:	case OP_ACOSH:	case OP_ATANH:
+	case OP_FACT:	case OP_GAMMA:	case OP_LNGAMMA:
+		return 1;
+	}
+	return 0;
+}
+
+void result_cache_clear(void) {
+	xset(ResultCache, 0, sizeof(ResultCache));
+	ResultCacheHits = ResultCacheMisses = 0;
+}
+
+/* Call a monadic (y == NULL) or dyadic real function on the stack operands
+ * unless the result is in the cache already.
+ */
+static void *cached_real(void (*fp)(void), unsigned int f, decNumber *r, const decNumber *y, const decNumber *x) {
+	const unsigned int operands = y == NULL ? 1 : 2;
+	const int n = is_dblmode() ? sizeof(decimal128) : sizeof(decimal64);
+	const unsigned short fn = (operands << 8) | f;
+	const unsigned char modes = (get_trig_mode() << 4) | (is_dblmode() << 3) | get_rounding_mode();
+	const REGISTER *const rx = get_reg_n(regX_idx);
+	const REGISTER *const ry = get_reg_n(regY_idx);
+	unsigned int h = fn * 31 + modes;
+	struct result_cache_entry *e;
+	void *res;
+	int i;
+
+	if (! result_cacheable(operands, f))
+#ifdef INCLUDE_GUARD_DIGITS
+		return guarded_real(fp, f, r, y, x);
+#else
+		return operands == 1 ? ((FP_MONADIC_REAL) fp)(r, x) : ((FP_DYADIC_REAL) fp)(r, y, x);
+#endif
+
+	for (i = 0; i < n; i++) {
+		h = h * 31 + ((const unsigned char *) rx)[i];
+		if (operands == 2)
+			h = h * 7 + ((const unsigned char *) ry)[i];
+	}
+	h = (h ^ (h >> 11)) % RESULT_CACHE_SETS;
+
+	for (i = 0; i < 2; i++) {
+		e = &ResultCache[h].way[i];
+		if (e->fn == fn && e->modes == modes && memcmp(&e->x, rx, n) == 0
+				&& (operands == 1 || memcmp(&e->y, ry, n) == 0)) {
+			ResultCache[h].last = i;
+			ResultCacheHits++;
+			return decNumberCopy(r, &e->r);
+		}
+	}
+	ResultCacheMisses++;
+
+#ifdef INCLUDE_GUARD_DIGITS
+	res = guarded_real(fp, f, r, y, x);
+#else
+	res = operands == 1 ? ((FP_MONADIC_REAL) fp)(r, x) : ((FP_DYADIC_REAL) fp)(r, y, x);
+#endif
+	if (res != NULL && Error == ERR_NONE) {
+		i = 1 - ResultCache[h].last;
+		e = &ResultCache[h].way[i];
+		e->fn = fn;
+		e->modes = modes;
+		xcopy(&e->x, rx, n);
+		xcopy(&e->y, ry, n);
+		decNumberCopy(&e->r, r);
+		ResultCache[h].last = i;
+	}
+	return res;
+}
+#endif
+
+
 #ifndef UNIVERSAL_DISPATCH
 
 
@@ -4382,7 +5247,13 @@ static void monadic(const opcode op)
 				else {
 					decNumber x, r;
 					getX(&x);
+#if defined(INCLUDE_RESULT_CACHE)
+					if (NULL == cached_real((void (*)(void)) fp, f, &r, NULL, &x))
+#elif defined(INCLUDE_GUARD_DIGITS)
+					if (NULL == guarded_real((void (*)(void)) fp, f, &r, NULL, &x))
+#else
 					if (NULL == fp(&r, &x))
+#endif
 						set_NaN(&r);
 					setlastX();
 					setX(&r);
@@ -4457,8 +5328,24 @@ static void dyadic(const opcode op) {
 					return;
 				else {
 					decNumber x, y, r;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+					REGISTER p;
+
+					if (packed_dyadic(&p, regY_idx, regX_idx, f)) {
+						setlastX();
+						lower();
+						copyreg(StackBase, &p);
+						return;
+					}
+#endif
 					getXY(&x, &y);
+#if defined(INCLUDE_RESULT_CACHE)
+					if (NULL == cached_real((void (*)(void)) fp, f, &r, &y, &x))
+#elif defined(INCLUDE_GUARD_DIGITS)
+					if (NULL == guarded_real((void (*)(void)) fp, f, &r, &y, &x))
+#else
 					if (NULL == fp(&r, &y, &x))
+#endif
 						set_NaN(&r);
 					setlastX();
 					lower();
@@ -4774,11 +5661,23 @@ finish_niladic:
 			switch (operands) {
 			default:
 			case 1:
+#if defined(INCLUDE_RESULT_CACHE)
+				result = cached_real(function_pointer, f, &r1, NULL, &x);
+#elif defined(INCLUDE_GUARD_DIGITS)
+				result = guarded_real(function_pointer, f, &r1, NULL, &x);
+#else
 				result = ((FP_MONADIC_REAL)function_pointer)(&r1, &x);
+#endif
 				break;
 
 			case 2:
+#if defined(INCLUDE_RESULT_CACHE)
+				result = cached_real(function_pointer, f, &r1, &y, &x);
+#elif defined(INCLUDE_GUARD_DIGITS)
+				result = guarded_real(function_pointer, f, &r1, &y, &x);
+#else
 				result = ((FP_DYADIC_REAL)function_pointer)(&r1, &y, &x);
+#endif
 				break;
 
 			case 3:
@@ -5006,12 +5905,19 @@ static void multi(const opcode op) {
  */
 void xeq(opcode op) 
 {
+#ifdef INCLUDE_UNDO_JOURNAL
+	struct undo_journal journal;
+#else
 	REGISTER save[STACK_SIZE+2];
+#endif
 	const unsigned short flags = UserFlags[regA_idx >> 4];
 	const struct _ustate old = UState;
 	const unsigned char lift = get_lift();
 	const unsigned short old_pc = state_pc();
 	const int old_cl = *((int *)&CommandLine);
+#ifdef CONSOLE
+	const int profiling = profile_mode;
+#endif
 #ifdef INFRARED
 	int tracing;
 #endif
@@ -5026,9 +5932,15 @@ void xeq(opcode op)
 	}
 #endif
 
+#ifdef INCLUDE_UNDO_JOURNAL
+	undo_begin(&journal);
+#else
 	xcopy(save, StackBase, sizeof(save));
+#endif
 #ifdef CONSOLE
 	instruction_count++;
+	if (profiling)
+		profile_begin(op);
 #endif
 #ifndef REALBUILD
 	if (State2.trace && ! State2.sst) {
@@ -5074,13 +5986,20 @@ void xeq(opcode op)
 		while (get_key() >= 0) { } // Empty keyboard buffer
 	}
 #endif
+#ifdef INCLUDE_UNDO_JOURNAL
+	undo_end(&journal);
+#endif
 
 	if (Error != ERR_NONE) {
 		// deferred message (matrix code needs too much stack!)
 		error_message( Error );
 		// Repair stack and state
 		// Clear return stack
+#ifdef INCLUDE_UNDO_JOURNAL
+		undo_rollback(&journal);
+#else
 		xcopy(StackBase, save, sizeof(save));
+#endif
 		UserFlags[regA_idx >> 4] = flags;
 		UState = old;
 		State2.state_lift = lift;
@@ -5149,17 +6068,192 @@ void xeq(opcode op)
 	Tracing = tracing;
 	print_trace( op, 1 );
 #endif
+#ifdef CONSOLE
+	if (profiling)
+		profile_end();
+#endif
+}
+
+#ifdef INCLUDE_FUSED_STEPS
+/* Execute a fused pair of steps in one go.  The result is exactly what
+ * the two steps would have left behind one after the other, including
+ * stack lift and last X.  Nothing is touched and zero is returned when
+ * the pair has to run step by step after all: anything but real mode,
+ * tracing or profiling, an argument out of range or a result that would
+ * raise an error.
+ */
+static int xeq_fused(const struct decoded_step *d) {
+	const opcode op = d[1].op;
+	const unsigned int f = argKIND(op);
+	FP_DYADIC_REAL fp;
+	decNumber x, y, r;
+	REGISTER l;
+	int keep_stack = 0;
+	int ix, iy;
+#ifdef INCLUDE_PACKED_ARITHMETIC
+	REGISTER p;
+	int packed;
+#endif
+
+	if (Error != ERR_NONE || CmdLineLength || is_intmode() || State2.trace)
+		return 0;
+#ifdef CONSOLE
+	if (profile_mode)
+		return 0;
+#endif
+#ifdef INFRARED
+	if (get_user_flag(T_FLAG))
+		return 0;
+#endif
+#if INTERRUPT_XROM_TICKS > 0
+	if (OnKeyTicks >= INTERRUPT_XROM_TICKS)
+		return 0;
+#endif
+	if (isNULL(dyfuncs[f].dydreal))
+		return 0;
+	fp = (FP_DYADIC_REAL) EXPAND_ADDRESS(dyfuncs[f].dydreal);
+	if (check_for_xrom_address(fp) != NULL)
+		return 0;
+
+	if (d->fuse == FUSE_RCL_ARITH) {
+		// RCL nn lifts the stack only if lift is enabled, the
+		// operation drops it again
+		const unsigned int arg = d->op & RARG_MASK;
+
+		if (arg > get_reg_limit(RARG_RCL, arg))
+			return 0;
+		copyreg(&l, get_reg_n(arg));
+		ix = arg;
+		keep_stack = get_lift();
+		iy = keep_stack ? regX_idx : regY_idx;
+	} else /* if (d->fuse == FUSE_SWAP_ARITH) */ {
+		copyreg(&l, get_reg_n(regY_idx));
+		ix = regY_idx;
+		iy = regX_idx;
+	}
+#ifdef INCLUDE_PACKED_ARITHMETIC
+	packed = packed_dyadic(&p, iy, ix, f);
+	if (! packed)
+#endif
+	{
+		getRegister(&x, ix);
+		getRegister(&y, iy);
+		if (NULL == fp(&r, &y, &x) || Error != ERR_NONE || ! safe_to_store(&r)) {
+			Error = ERR_NONE;
+			return 0;
+		}
+	}
+
+	copyreg(get_reg_n(regL_idx), &l);
+	if (keep_stack) {
+		// Lift followed by drop only duplicates the next to top level
+		const int n = stack_size();
+		copyreg(get_stack(n - 1), get_stack(n - 2));
+	} else
+		lower();
+#ifdef INCLUDE_PACKED_ARITHMETIC
+	if (packed)
+		copyreg(StackBase, &p);
+	else
+#endif
+		setX(&r);
+
+	set_lift();
+	XeqOpCode = (s_opcode) op;
+	Busy = 0;
+	State2.wascomplex = 0;
+#ifdef CONSOLE
+	instruction_count += 2;
+#endif
+	raw_set_pc(d[1].next);
+	reset_volatile_state();
+	return 1;
 }
+#endif
 
 /* Execute a single step and return.
  */
 static void xeq_single(void) {
-	const opcode op = getprog(state_pc());
+#ifdef CONSOLE
+	if (profile_mode)
+		profile_step(state_pc());
+#endif
+#ifdef INCLUDE_DECODE_CACHE
+	const struct decoded_step *d = decoded_step(state_pc());
+
+	if (d != NULL) {
+		const opcode op = d->op;
+		PcWrapped = 0;
+#ifdef INCLUDE_FUSED_STEPS
+		if (d->fuse != FUSE_NONE && xeq_fused(d))
+			return;
+#endif
+		raw_set_pc(d->next);
+		xeq(op);
+		return;
+	}
+#endif
+	{
+		const opcode op = getprog(state_pc());
+
+		incpc();
+		xeq(op);
+	}
+}
+
+#ifdef INCLUDE_COMPILED_PROGRAMS
+void set_compiled_program(const struct compiled_program *p) {
+	Compiled = p;
+	CompiledValid = -1;
+}
+
+unsigned short int region_crc(int region) {
+	return crc16(RegionTab[region], sizeLIB(region) * sizeof(s_opcode));
+}
 
-	incpc();
+/* Can the compiled program take over at pc?
+ */
+static int compiled_at(const unsigned int pc) {
+	if (Compiled == NULL || nLIB(pc) != Compiled->region || State2.trace)
+		return 0;
+#ifdef CONSOLE
+	if (profile_mode)
+		return 0;
+#endif
+	if (CompiledValid < 0)
+		CompiledValid = sizeLIB(Compiled->region) == Compiled->size
+				&& region_crc(Compiled->region) == Compiled->crc;
+	return CompiledValid;
+}
+
+/* One step of a compiled program.  The same as xeq_single() with the
+ * opcode and the address of the following step known in advance.
+ * Returns nonzero unless execution simply goes on with that step.
+ */
+int xeq_compiled(unsigned int next, opcode op) {
+	PcWrapped = 0;
+	raw_set_pc(next);
 	xeq(op);
+	return state_pc() != next || Pause || ! Running;
+}
+
+/* A pair of steps that xeq_single() can execute in one go.  If it
+ * doesn't, only the first one is done and the caller dispatches again.
+ */
+int xeq_compiled_pair(unsigned int next) {
+	xeq_single();
+	return state_pc() != next || Pause || ! Running;
 }
 
+int is_fused_pair(opcode first, opcode second) {
+#ifdef INCLUDE_FUSED_STEPS
+	return fused_kind(first, second) != FUSE_NONE;
+#else
+	return 0;
+#endif
+}
+#endif
+
 /* Continue execution trough xrom code
  */
 #ifdef REALBUILD
@@ -5212,7 +6306,25 @@ void xeqprog(void)
 		finish_display();
 
 		while (! Pause && Running) {
+#if RUN_QUANTUM > 1
+			const unsigned long ticker = Ticker;
+			int steps = RUN_QUANTUM;
+
+			do {
+				int done = 0;
+#ifdef INCLUDE_COMPILED_PROGRAMS
+				if (compiled_at(state_pc()))
+					done = Compiled->run(steps);
+#endif
+				if (done == 0) {
+					xeq_single();
+					done = 1;
+				}
+				steps -= done;
+			} while (steps > 0 && ! Pause && Running && Ticker == ticker);
+#else
 			xeq_single();
+#endif
 			if (is_key_pressed()) {
 				// Key press or heart beat
 				// xeq_xrom(); // Already done by dispatch_xrom()
@@ -5309,13 +6421,19 @@ void xeq_init_contexts(void) {
 	 *  Compute the sizes of the various memory portions
 	 */
 	short int s;
+#ifdef INCLUDE_THREAD_INSTANCES
+	RegionTab[REGION_RAM] = Prog;
+	RegionTab[REGION_LIBRARY] = UserFlash.prog;
+	RegionTab[REGION_BACKUP] = BackupFlash._prog;
+	RegionTab[REGION_XROM] = xrom;
+#endif
 	SizeStatRegs = State.have_stats ? sizeof(STAT_DATA) >> 1 : 0;	// in 16 bit words!
 	s = ((TOPREALREG - NumRegs) << 2) - SizeStatRegs;		// additional register space
 	RetStk = RetStkBase + s;					// Move RetStk up or down
 	RetStkSize = s + RET_STACK_SIZE - ProgSize;
 	ProgMax = s + RET_STACK_SIZE - MINIMUM_RET_STACK_SIZE;
 	ProgFree = ProgMax - ProgSize + RetStkPtr;
-	StackBase = get_reg_n(regX_idx);
+	set_stack_base(get_reg_n(regX_idx));
 
 	/*
 	 *  Initialise our standard contexts.
@@ -5521,6 +6639,7 @@ void store_a_to_d(enum nilop op) {
 		src = dest;
 		dest = XromA2D;
 	}
+	undo_log(dest, sizeof(REGISTER) * 4);
 	xcopy(dest, src, sizeof(REGISTER) * 4);
 }
 
@@ -5692,7 +6811,7 @@ void cmdxin(unsigned int arg, enum rarg op) {
 	else if (XromFlags.mode_double) {
 		// No conversion necessary
 		xcopy(XromStack, StackBase, sizeof(XromStack));
-		StackBase = XromStack;
+		set_stack_base(XromStack);
 #ifdef ENABLE_COPYLOCALS
 		if (XromFlags.copyLocals)
 			move_regs(get_reg_n(LOCAL_REG_BASE), previousLocals, num_locals);
@@ -5773,7 +6892,7 @@ void cmdxout(unsigned int arg, enum rarg op) {
 	intm = UState.intm = XromFlags.mode_int;
         UState.rounding_mode = XromFlags.rounding_mode;
 	UState.stack_depth = XromFlags.stack_depth;
-	StackBase = get_reg_n(regX_idx);
+	set_stack_base(get_reg_n(regX_idx));
 
 	// Last X handling and complex flag
 	if (XromFlags.setLastX) {
@@ -5825,6 +6944,7 @@ void cmdxout(unsigned int arg, enum rarg op) {
 		move_regs(StackBase, XromStack, i);
 	}
 	else {
+		undo_log(StackBase, XromOut * sizeof(decimal64));
 		while (i--)
 			packed_from_packed128(&(get_stack(i)->s), &(XromStack[i].d));
 	}
@@ -6011,8 +7131,10 @@ void cmdregs(unsigned int arg, enum rarg op) {
 	      length + (SizeStatRegs << 1));
 
 	// Clear the left space
-	if (distance < 0)
+	if (distance < 0) {
+		undo_log(Regs + TOPREALREG + distance, -distance << 3);
 		xset(Regs + TOPREALREG + distance, 0, -distance << 3);
+	}
 	NumRegs = arg;
 }
 
@@ -6107,6 +7229,7 @@ int init_34s(void)
 	if (cleared) {
 		reset();
 	}
+	label_index_invalidate(-1);
 	init_state();
 	xeq_init_contexts();
 	ShowRPN = 1;
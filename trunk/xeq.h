@@ -1175,6 +1175,38 @@ extern void decpc(void);
 extern unsigned int find_opcode_from(unsigned int pc, const opcode l, const int flags);
 extern unsigned int find_label_from(unsigned int, unsigned int, int);
 extern unsigned int findmultilbl(const opcode, int);
+#ifdef INCLUDE_LABEL_INDEX
+extern void label_index_invalidate(int region);
+extern void label_index_insert(unsigned int pc, opcode op);
+extern void label_index_delete(unsigned int pc, opcode op);
+extern void label_index_update(unsigned int from, unsigned int to);
+#else
+#define label_index_invalidate(region)
+#define label_index_insert(pc, op)
+#define label_index_delete(pc, op)
+#define label_index_update(from, to)
+#endif
+#ifdef INCLUDE_COMPILED_PROGRAMS
+/*
+ *  A program region translated to C by 'calc translate'.  run() executes
+ *  at most the given number of steps and returns how many it did.
+ */
+struct compiled_program {
+	int region;			// REGION_RAM or REGION_LIBRARY
+	unsigned short int size;	// Words in the region
+	unsigned short int crc;		// region_crc() of the translated code
+	int (*run)(int steps);
+};
+extern void set_compiled_program(const struct compiled_program *p);
+extern unsigned short int region_crc(int region);
+extern int xeq_compiled(unsigned int next, opcode op);
+extern int xeq_compiled_pair(unsigned int next);
+extern int is_fused_pair(opcode first, opcode second);
+#endif
+#ifdef INCLUDE_RESULT_CACHE
+extern INSTANCE unsigned int ResultCacheHits, ResultCacheMisses;
+extern void result_cache_clear(void);
+#endif
 extern void fin_tst(const int);
 
 extern const char *prt(opcode, char *);
@@ -1183,6 +1215,11 @@ extern const char *catcmd(opcode, char *);
 extern int stack_size(void);
 extern REGISTER *get_stack(int pos);
 extern void copyreg(REGISTER *d, const REGISTER *s);
+#ifdef INCLUDE_UNDO_JOURNAL
+extern void undo_log(const void *p, int n);
+#else
+#define undo_log(p, n)
+#endif
 extern void copyreg_n(int d, int s);
 
 extern REGISTER *get_reg_n(int);
@@ -1208,6 +1245,7 @@ extern void setXY(const decNumber *x, const decNumber *y);
 extern void setXYZ(const decNumber *x, const decNumber *y, const decNumber *z);
 extern void setlastX(void);
 
+extern enum rounding get_rounding_mode(void);
 extern void packed_from_number(decimal64 *r, const decNumber *x);
 extern void packed128_from_number(decimal128 *r, const decNumber *x);
 extern void packed_from_packed128(decimal64 *r, const decimal128 *s);
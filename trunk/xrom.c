@@ -0,0 +1,3235 @@
+#include "xrom.h"
+const XROM_DATA s_opcode xrom[] = {
+        0x3a73,
+        0x2a68,
+        0xa648,
+        0x0603,
+        0x001b,
+        0x0139,
+        0x020a,
+        0x020b,
+        0x2a73,
+        0x2c74,
+        0x6401,
+        0x2d68,
+        0x0303,
+        0x2a72,
+        0x2c70,
+        0x0303,
+        0x2b72,
+        0x0138,
+        0x019f,
+        0x220d,
+        0x9c06,
+        0x4d65,
+        0x6165,
+        0x4d65,
+        0x9201,
+        0x5265,
+        0x3165,
+        0x3570,
+        0x0181,
+        0x0182,
+        0x2373,
+        0x0017,
+        0x56db,
+        0x2a71,
+        0x0181,
+        0x0182,
+        0x2374,
+        0x0017,
+        0x56d2,
+        0x0180,
+        0x2d73,
+        0x001d,
+        0x5606,
+        0x7170,
+        0x58e6,
+        0x3a70,
+        0x58d4,
+        0x58dd,
+        0x5604,
+        0x2a73,
+        0x4d74,
+        0x7171,
+        0x58d8,
+        0x2372,
+        0x017f,
+        0x2a72,
+        0x0181,
+        0x0182,
+        0x0017,
+        0x56b7,
+        0x0180,
+        0x2368,
+        0x6175,
+        0x7570,
+        0x5638,
+        0xa7fa,
+        0x5075,
+        0x5698,
+        0x7972,
+        0x5602,
+        0x5946,
+        0x5602,
+        0x58d4,
+        0x7173,
+        0x236a,
+        0x2a68,
+        0x6401,
+        0x2a74,
+        0x6401,
+        0x4d65,
+        0x5606,
+        0x2a72,
+        0x2370,
+        0x2a68,
+        0x2373,
+        0x2a71,
+        0x5605,
+        0x2a72,
+        0x2371,
+        0x2a68,
+        0x2374,
+        0x2a70,
+        0x236b,
+        0x7673,
+        0x58b4,
+        0x2a6a,
+        0x2a6b,
+        0x2a72,
+        0x58a0,
+        0x58a9,
+        0x2372,
+        0x2a71,
+        0x2c70,
+        0x0205,
+        0x2a71,
+        0x0205,
+        0x2a70,
+        0x0205,
+        0x0309,
+        0x0290,
+        0xa705,
+        0x0303,
+        0x5165,
+        0x573b,
+        0xa700,
+        0x236c,
+        0x2a68,
+        0x2a71,
+        0x2a72,
+        0x017f,
+        0x0138,
+        0x2a68,
+        0x6401,
+        0x2a74,
+        0x6401,
+        0x4d65,
+        0x5604,
+        0xa700,
+        0x2375,
+        0x7170,
+        0x573e,
+        0x7471,
+        0x562e,
+        0xa764,
+        0x5075,
+        0x5654,
+        0x5894,
+        0x7173,
+        0x236a,
+        0x2a74,
+        0x0205,
+        0x2a73,
+        0x0205,
+        0x5265,
+        0x5605,
+        0x2a72,
+        0x2370,
+        0x2a68,
+        0x2373,
+        0x5604,
+        0x2a72,
+        0x2371,
+        0x2a68,
+        0x2374,
+        0x2a71,
+        0x5370,
+        0x5605,
+        0x3170,
+        0x2371,
+        0x2a74,
+        0x3173,
+        0x2374,
+        0x7673,
+        0x586f,
+        0x2a6a,
+        0x2a71,
+        0x2c70,
+        0x0205,
+        0x9102,
+        0x2a70,
+        0x2c65,
+        0x5366,
+        0x5748,
+        0x010e,
+        0x2b71,
+        0x5165,
+        0x574c,
+        0x3165,
+        0x574e,
+        0xa714,
+        0x5075,
+        0x5626,
+        0x2a68,
+        0x4d74,
+        0x5604,
+        0xa700,
+        0x2375,
+        0x7271,
+        0x5734,
+        0x2a75,
+        0x0189,
+        0x560e,
+        0x2a72,
+        0x2371,
+        0x2a68,
+        0x2374,
+        0x2a70,
+        0x001a,
+        0x5603,
+        0x2000,
+        0x0303,
+        0x5601,
+        0x2b64,
+        0xa70a,
+        0x0302,
+        0x5769,
+        0x2a72,
+        0x2370,
+        0x2a68,
+        0x2373,
+        0x2a71,
+        0x001a,
+        0x5602,
+        0x2b64,
+        0x5602,
+        0x2000,
+        0x0303,
+        0xa70a,
+        0x0301,
+        0x5777,
+        0x2a73,
+        0x0205,
+        0x2a74,
+        0x0205,
+        0x5065,
+        0x5607,
+        0x2a67,
+        0x236c,
+        0xa700,
+        0x3165,
+        0x2a70,
+        0x2a72,
+        0x5606,
+        0x2a67,
+        0x236c,
+        0xa700,
+        0x3165,
+        0x2a71,
+        0x2a72,
+        0x017f,
+        0x019c,
+        0x2214,
+        0x0139,
+        0xa700,
+        0x236c,
+        0x2a65,
+        0x2a71,
+        0x2a72,
+        0x0138,
+        0x2a74,
+        0x2a71,
+        0x5602,
+        0x2a73,
+        0x2a70,
+        0x2a64,
+        0xa700,
+        0x236c,
+        0x3f66,
+        0x0138,
+        0x0000,
+        0x2f66,
+        0xa6c9,
+        0x030a,
+        0x3f66,
+        0x5167,
+        0x0138,
+        0x5366,
+        0x0138,
+        0x0139,
+        0x2a70,
+        0x2b71,
+        0x2000,
+        0x0303,
+        0x7172,
+        0x0138,
+        0x2a71,
+        0x0000,
+        0x2c70,
+        0x2a74,
+        0x2c73,
+        0x0304,
+        0x2d74,
+        0x0302,
+        0x236a,
+        0x0138,
+        0x2a70,
+        0x2a74,
+        0x2a68,
+        0x2a73,
+        0x5811,
+        0x0138,
+        0x236a,
+        0x2a71,
+        0x2a73,
+        0x2a68,
+        0x2a74,
+        0x580a,
+        0x0138,
+        0x246a,
+        0x2a72,
+        0x2a73,
+        0x2a74,
+        0x2a68,
+        0x5803,
+        0x0138,
+        0x2b6a,
+        0x0139,
+        0x0107,
+        0x236b,
+        0x0107,
+        0x266b,
+        0x010a,
+        0x2565,
+        0x2566,
+        0x010e,
+        0x0303,
+        0x0017,
+        0x0138,
+        0x0304,
+        0x2d6b,
+        0x0139,
+        0x019f,
+        0x220d,
+        0x9c10,
+        0x776b,
+        0x7170,
+        0x3570,
+        0x0184,
+        0x6502,
+        0x3165,
+        0x0184,
+        0x6502,
+        0x4d65,
+        0x6503,
+        0x5265,
+        0x7171,
+        0x0183,
+        0x7172,
+        0x3165,
+        0x0183,
+        0x7173,
+        0x7472,
+        0x7573,
+        0x5604,
+        0xa700,
+        0xa702,
+        0x7272,
+        0x5614,
+        0x7572,
+        0x7473,
+        0x5607,
+        0x010b,
+        0x0301,
+        0x3166,
+        0x0302,
+        0x0205,
+        0x7175,
+        0x560a,
+        0x0183,
+        0x3165,
+        0x5265,
+        0x7174,
+        0x2b64,
+        0x7273,
+        0x0017,
+        0x7173,
+        0x7172,
+        0xa702,
+        0xa702,
+        0x0304,
+        0x2372,
+        0x3165,
+        0x2e6c,
+        0x2373,
+        0xa722,
+        0x0003,
+        0x01bc,
+        0x5607,
+        0xa709,
+        0x020b,
+        0x0206,
+        0x2c6c,
+        0x028f,
+        0xa702,
+        0x0302,
+        0x0000,
+        0x0210,
+        0x2374,
+        0x020a,
+        0x9101,
+        0x2375,
+        0x010e,
+        0x0205,
+        0x020e,
+        0x0203,
+        0xa702,
+        0x0301,
+        0x2376,
+        0x7573,
+        0x5604,
+        0xa701,
+        0xa700,
+        0x032e,
+        0x2374,
+        0x7575,
+        0x5604,
+        0xa701,
+        0x2f72,
+        0x2b64,
+        0x5608,
+        0x7473,
+        0x5604,
+        0x2000,
+        0x2e73,
+        0x0205,
+        0x5602,
+        0x2a74,
+        0x020a,
+        0x2e74,
+        0x0208,
+        0x7575,
+        0x2b64,
+        0x2b64,
+        0x2055,
+        0x0304,
+        0x0208,
+        0x2377,
+        0x3a7e,
+        0xa702,
+        0x2378,
+        0x337f,
+        0xa700,
+        0x2379,
+        0xa701,
+        0x237a,
+        0xa702,
+        0x2778,
+        0x2a78,
+        0x0228,
+        0x237b,
+        0x0216,
+        0x6064,
+        0x020a,
+        0x2056,
+        0x0303,
+        0x7472,
+        0x0209,
+        0x7572,
+        0x0228,
+        0x010c,
+        0x7575,
+        0x5602,
+        0x0216,
+        0x020b,
+        0x237c,
+        0x010e,
+        0x7472,
+        0x5603,
+        0x0216,
+        0x6064,
+        0x020a,
+        0x7475,
+        0x2e65,
+        0x7474,
+        0x0003,
+        0x237d,
+        0x2d72,
+        0x2b73,
+        0x5825,
+        0x2d7c,
+        0x317d,
+        0x2a73,
+        0x2a72,
+        0x7472,
+        0x5603,
+        0x2d66,
+        0x0302,
+        0x5602,
+        0x2e66,
+        0x0301,
+        0x5819,
+        0x7472,
+        0x2e7c,
+        0x7572,
+        0x2d7c,
+        0x2b7d,
+        0x2d7b,
+        0x0185,
+        0xa700,
+        0x2479,
+        0x7576,
+        0x561a,
+        0x617a,
+        0x0205,
+        0x2a79,
+        0x2d74,
+        0x0205,
+        0x5365,
+        0x5618,
+        0x8e65,
+        0x5611,
+        0xa723,
+        0x4e66,
+        0x560e,
+        0x2a7f,
+        0x5633,
+        0x0185,
+        0x5608,
+        0x7570,
+        0x726b,
+        0x0181,
+        0x0182,
+        0x0185,
+        0xa700,
+        0x716b,
+        0x0138,
+        0xa700,
+        0x0138,
+        0x617a,
+        0x2a7a,
+        0x2d78,
+        0x5177,
+        0x5754,
+        0x2a79,
+        0x247e,
+        0x7476,
+        0x5608,
+        0xa701,
+        0x7474,
+        0x0003,
+        0x2a73,
+        0x7472,
+        0x0301,
+        0x591b,
+        0x247e,
+        0x2a7e,
+        0x2d72,
+        0x2d78,
+        0x2056,
+        0x0303,
+        0x7471,
+        0x0003,
+        0x019c,
+        0x9b19,
+        0x2a79,
+        0x2b64,
+        0x2c7e,
+        0x0205,
+        0x2a75,
+        0x2d7e,
+        0x0205,
+        0x5265,
+        0x5603,
+        0x7176,
+        0x5c76,
+        0x577d,
+        0x2a66,
+        0x2a64,
+        0x0205,
+        0x2a65,
+        0x2c7f,
+        0x0205,
+        0x2a64,
+        0x9101,
+        0x5066,
+        0x5604,
+        0x3166,
+        0x0301,
+        0xa700,
+        0x2367,
+        0x3167,
+        0x019c,
+        0x9b19,
+        0x3a70,
+        0x236c,
+        0x3f66,
+        0x7570,
+        0x726b,
+        0x0138,
+        0xa700,
+        0x5601,
+        0x2023,
+        0x2a64,
+        0x570c,
+        0x019f,
+        0x220d,
+        0x9c05,
+        0x0185,
+        0x5638,
+        0x7170,
+        0x5898,
+        0xa701,
+        0x5874,
+        0x5633,
+        0xa710,
+        0x0303,
+        0x2371,
+        0xa72a,
+        0x9103,
+        0x2d70,
+        0x2372,
+        0xa700,
+        0x586a,
+        0x5629,
+        0xa71e,
+        0x0303,
+        0x2571,
+        0x000c,
+        0x0008,
+        0x000c,
+        0x000b,
+        0x000b,
+        0x2d70,
+        0x2572,
+        0xa702,
+        0x585d,
+        0x561c,
+        0x2571,
+        0xa706,
+        0x9103,
+        0x0303,
+        0x2572,
+        0xa703,
+        0x5855,
+        0x5616,
+        0x9103,
+        0x2472,
+        0xa704,
+        0x5850,
+        0x5611,
+        0xa77d,
+        0x0303,
+        0x2572,
+        0xa705,
+        0x584a,
+        0x560b,
+        0xa708,
+        0x0303,
+        0x2b72,
+        0xa7fc,
+        0x9102,
+        0x2d74,
+        0x2d74,
+        0x0304,
+        0x565c,
+        0x2023,
+        0x565a,
+        0xa70c,
+        0x2d74,
+        0x2d74,
+        0x020b,
+        0x2671,
+        0x2a71,
+        0x5653,
+        0x019f,
+        0x220d,
+        0x9c05,
+        0x0185,
+        0x570d,
+        0x7270,
+        0x5852,
+        0xa701,
+        0x582e,
+        0x5712,
+        0x2371,
+        0xa702,
+        0x582a,
+        0x5716,
+        0x2372,
+        0xa703,
+        0x5826,
+        0x563b,
+        0xa72d,
+        0x2d71,
+        0xa709,
+        0x2d72,
+        0x0302,
+        0x0301,
+        0xa73c,
+        0x2d74,
+        0x0304,
+        0x3171,
+        0xa715,
+        0x9102,
+        0x0303,
+        0xa706,
+        0x9102,
+        0x2d72,
+        0x0302,
+        0xa796,
+        0x2d70,
+        0x0301,
+        0x2372,
+        0xa704,
+        0x580e,
+        0x572b,
+        0xa719,
+        0x0303,
+        0x2572,
+        0xa705,
+        0x5808,
+        0x5731,
+        0x2b70,
+        0x2b72,
+        0xa7fc,
+        0x9101,
+        0x2d74,
+        0x0304,
+        0x561c,
+        0x2370,
+        0x2d74,
+        0x2b73,
+        0x0181,
+        0x0182,
+        0x0185,
+        0x0138,
+        0x3170,
+        0x0017,
+        0x560a,
+        0x0003,
+        0x2d74,
+        0x2b73,
+        0x0181,
+        0x0182,
+        0x0185,
+        0x0138,
+        0x7470,
+        0x0003,
+        0x2570,
+        0x2a70,
+        0x0139,
+        0xa708,
+        0x2d71,
+        0x2c72,
+        0xa70c,
+        0x2d74,
+        0x0304,
+        0x236c,
+        0xa700,
+        0x010c,
+        0x2a73,
+        0x316c,
+        0x0138,
+        0x2373,
+        0x010c,
+        0xf2a3,
+        0x0078,
+        0x560c,
+        0xf2a3,
+        0x0058,
+        0x5609,
+        0xf283,
+        0x0078,
+        0x5606,
+        0xf283,
+        0x0058,
+        0x5603,
+        0xa701,
+        0x9201,
+        0x5601,
+        0x0182,
+        0x2374,
+        0x0138,
+        0x019f,
+        0x220d,
+        0x9c04,
+        0x2373,
+        0x0185,
+        0x5638,
+        0x2370,
+        0x0204,
+        0x0181,
+        0x0182,
+        0x0185,
+        0x5632,
+        0x2371,
+        0xa700,
+        0x2372,
+        0x560e,
+        0x2a70,
+        0x0204,
+        0x0181,
+        0x0182,
+        0x0185,
+        0x5628,
+        0x2c72,
+        0x0000,
+        0x2b71,
+        0x0000,
+        0x2c71,
+        0x2c66,
+        0x3165,
+        0x3571,
+        0x5c70,
+        0x570f,
+        0x5617,
+        0x019f,
+        0x220d,
+        0x9c04,
+        0x2373,
+        0x0185,
+        0x5617,
+        0x2370,
+        0x0204,
+        0x0181,
+        0x0182,
+        0x0185,
+        0x5611,
+        0x2371,
+        0x5607,
+        0x2a70,
+        0x0204,
+        0x0181,
+        0x0182,
+        0x0185,
+        0x5609,
+        0x2671,
+        0x5c70,
+        0x5708,
+        0x2a73,
+        0x236c,
+        0xa700,
+        0x010c,
+        0x2a71,
+        0x0138,
+        0x2023,
+        0x2371,
+        0x5708,
+        0xa34a,
+        0x0017,
+        0xa400,
+        0x0000,
+        0x2b66,
+        0x0017,
+        0x6504,
+        0x0304,
+        0x0303,
+        0xa400,
+        0xa3ca,
+        0x0025,
+        0xa400,
+        0x010b,
+        0x3b68,
+        0x0604,
+        0x0603,
+        0xa400,
+        0xa349,
+        0x2d65,
+        0x9202,
+        0xa400,
+        0xa349,
+        0x2c65,
+        0x2e65,
+        0x9102,
+        0xa400,
+        0xa349,
+        0x2e65,
+        0x5704,
+        0xa34a,
+        0x2c65,
+        0x2e6c,
+        0x5708,
+        0xa34b,
+        0x2e65,
+        0x0208,
+        0x2e66,
+        0x0212,
+        0x570e,
+        0xa34a,
+        0x9202,
+        0x0003,
+        0x6164,
+        0x0304,
+        0xa400,
+        0xa34a,
+        0x001a,
+        0x2201,
+        0x3165,
+        0x001a,
+        0x2201,
+        0x2d65,
+        0x3165,
+        0x2b6c,
+        0x2000,
+        0x0303,
+        0x3165,
+        0x020a,
+        0xa503,
+        0xa400,
+        0x5709,
+        0xa3ca,
+        0x3d66,
+        0x3f66,
+        0x3b6c,
+        0x2100,
+        0x0603,
+        0x3f66,
+        0x050a,
+        0xa50b,
+        0xa400,
+        0x5709,
+        0xa3ca,
+        0x580a,
+        0x5607,
+        0xa3ca,
+        0x3568,
+        0x5806,
+        0x3a68,
+        0x6164,
+        0x0531,
+        0x0602,
+        0x0509,
+        0xa400,
+        0xa233,
+        0x6166,
+        0x0602,
+        0x0531,
+        0x3f66,
+        0x0531,
+        0x3f66,
+        0x0602,
+        0x0138,
+        0xa349,
+        0x0185,
+        0x6505,
+        0x0017,
+        0xa400,
+        0x5608,
+        0xa349,
+        0x0185,
+        0x6505,
+        0x001c,
+        0x6505,
+        0x0017,
+        0x6504,
+        0x7170,
+        0x9c03,
+        0x2370,
+        0xa707,
+        0x2371,
+        0xa723,
+        0x7470,
+        0xa719,
+        0x9202,
+        0x0003,
+        0x2a70,
+        0x5265,
+        0x5621,
+        0x204d,
+        0x2b70,
+        0x204e,
+        0x0301,
+        0x2009,
+        0x0303,
+        0x2372,
+        0x2464,
+        0x020a,
+        0x7670,
+        0x0003,
+        0x2a6c,
+        0xa703,
+        0x0304,
+        0x0302,
+        0x010c,
+        0x0003,
+        0x0212,
+        0x2d70,
+        0x2009,
+        0x0303,
+        0x2c65,
+        0x2b72,
+        0x2e65,
+        0x0301,
+        0x7672,
+        0x5604,
+        0xa506,
+        0x7172,
+        0x5a71,
+        0x570f,
+        0x6064,
+        0x5628,
+        0x7670,
+        0x5607,
+        0x0211,
+        0x0022,
+        0x560a,
+        0x0000,
+        0x0208,
+        0x0302,
+        0x5606,
+        0x0003,
+        0x0208,
+        0x0000,
+        0x0003,
+        0x0208,
+        0x0302,
+        0x010c,
+        0x2a70,
+        0x3165,
+        0x0209,
+        0x0304,
+        0x0302,
+        0x3165,
+        0x6164,
+        0x0304,
+        0x2a6c,
+        0x020b,
+        0x6164,
+        0x2d65,
+        0x2000,
+        0x0303,
+        0x0003,
+        0x6164,
+        0x0304,
+        0x0302,
+        0x7672,
+        0x5604,
+        0xa501,
+        0x7172,
+        0x5a71,
+        0x5718,
+        0xa400,
+        0xa3c9,
+        0x9c06,
+        0x3570,
+        0xa701,
+        0x2372,
+        0x2373,
+        0x0301,
+        0x0025,
+        0x5602,
+        0x0508,
+        0x3572,
+        0x010b,
+        0x0509,
+        0x3574,
+        0x3d72,
+        0x3674,
+        0x3c70,
+        0x3e74,
+        0x3772,
+        0x010f,
+        0x3a72,
+        0xa50b,
+        0xa400,
+        0x570c,
+        0xa349,
+        0x0209,
+        0x2d6c,
+        0xa400,
+        0xa3c9,
+        0x0509,
+        0x3d6c,
+        0xa400,
+        0xa34a,
+        0x0230,
+        0x2a6c,
+        0x2b66,
+        0x0230,
+        0x0304,
+        0x3165,
+        0x0230,
+        0x0303,
+        0xa400,
+        0xa3ca,
+        0x0530,
+        0x3a6c,
+        0x3b68,
+        0x0530,
+        0x0604,
+        0x3f66,
+        0x0530,
+        0x0603,
+        0xa400,
+        0xa3ca,
+        0x0531,
+        0x3a6c,
+        0x3b68,
+        0x0531,
+        0x0602,
+        0x3f66,
+        0x0531,
+        0x0601,
+        0xa400,
+        0xa349,
+        0x2000,
+        0x0303,
+        0x0229,
+        0x0225,
+        0x2b64,
+        0xa400,
+        0xa3c9,
+        0x0529,
+        0x6406,
+        0xa400,
+        0xa349,
+        0x2000,
+        0x0303,
+        0x2055,
+        0xa704,
+        0x0304,
+        0x0301,
+        0x0222,
+        0x0208,
+        0xa400,
+        0xa3c9,
+        0x2100,
+        0x0603,
+        0x2155,
+        0xa704,
+        0x0304,
+        0x0601,
+        0x0522,
+        0x0508,
+        0xa400,
+        0xa349,
+        0xa702,
+        0x020a,
+        0x0303,
+        0x0003,
+        0x6407,
+        0x2b64,
+        0xa400,
+        0xa349,
+        0x0183,
+        0x560a,
+        0x001a,
+        0x7170,
+        0x0216,
+        0x2000,
+        0x030e,
+        0x2050,
+        0x0303,
+        0x7470,
+        0x0003,
+        0xa400,
+        0xa701,
+        0x5265,
+        0x0003,
+        0xa400,
+        0xa349,
+        0x5818,
+        0x0185,
+        0x6508,
+        0x2d64,
+        0x6164,
+        0x2d6f,
+        0x2055,
+        0x0303,
+        0x020b,
+        0xa400,
+        0xa349,
+        0x7170,
+        0x5601,
+        0xa349,
+        0x580a,
+        0x0185,
+        0x6509,
+        0x0225,
+        0x2055,
+        0x0304,
+        0x7470,
+        0x0003,
+        0x2000,
+        0x0301,
+        0xa400,
+        0x2c6e,
+        0x640a,
+        0x2a6f,
+        0x640b,
+        0x0304,
+        0x0138,
+        0xa349,
+        0x640c,
+        0x2000,
+        0x0302,
+        0x2055,
+        0x0303,
+        0x0222,
+        0x2a6f,
+        0x640b,
+        0x0303,
+        0x2b6e,
+        0x640a,
+        0xa400,
+        0xa349,
+        0x5823,
+        0x0185,
+        0x6508,
+        0x0303,
+        0x0003,
+        0x0209,
+        0x2d6e,
+        0xa400,
+        0xa349,
+        0x581a,
+        0x0185,
+        0x6509,
+        0x0303,
+        0x001a,
+        0x650d,
+        0x0003,
+        0x0209,
+        0xa400,
+        0xa349,
+        0x5810,
+        0x0185,
+        0x6509,
+        0x0303,
+        0x001a,
+        0x6508,
+        0x0003,
+        0x0212,
+        0x0003,
+        0xa400,
+        0xa349,
+        0x640c,
+        0x640e,
+        0x5803,
+        0x0304,
+        0x0003,
+        0xa400,
+        0x2a6e,
+        0x650b,
+        0xa349,
+        0x5826,
+        0x001a,
+        0x6508,
+        0x0188,
+        0x6508,
+        0x2a6e,
+        0x640e,
+        0x0303,
+        0x0209,
+        0x2d6e,
+        0xa400,
+        0xa349,
+        0x581a,
+        0x0202,
+        0x0021,
+        0x650d,
+        0x0183,
+        0x6508,
+        0xa701,
+        0x2c6e,
+        0x3165,
+        0x0300,
+        0xa400,
+        0xa349,
+        0x580e,
+        0x5801,
+        0xa400,
+        0x001a,
+        0x650f,
+        0x0183,
+        0x6510,
+        0x0201,
+        0x6164,
+        0x2a6e,
+        0x640e,
+        0x0303,
+        0x0212,
+        0x0003,
+        0x0138,
+        0x2a6e,
+        0x6411,
+        0x010e,
+        0x0138,
+        0xa349,
+        0x5905,
+        0x001b,
+        0x6508,
+        0x640c,
+        0x0000,
+        0x640e,
+        0x2a6e,
+        0x640e,
+        0x0304,
+        0x6064,
+        0x0201,
+        0xa702,
+        0x5801,
+        0xa400,
+        0x9c03,
+        0x3570,
+        0x3372,
+        0x010e,
+        0x5804,
+        0x5072,
+        0x6171,
+        0x2a71,
+        0x0138,
+        0xba70,
+        0x6512,
+        0x6513,
+        0x572b,
+        0xa349,
+        0x581c,
+        0x0185,
+        0x6508,
+        0x0228,
+        0x0216,
+        0x2d6f,
+        0xa704,
+        0x0303,
+        0x020b,
+        0xa400,
+        0xa349,
+        0x5811,
+        0x0185,
+        0x6509,
+        0x001b,
+        0x6508,
+        0x0003,
+        0x5606,
+        0xa349,
+        0x5809,
+        0x0185,
+        0x6509,
+        0x001b,
+        0x6508,
+        0x0229,
+        0x6164,
+        0x2000,
+        0x0303,
+        0xa400,
+        0x2c6e,
+        0x640a,
+        0x2a6f,
+        0x640b,
+        0x2b64,
+        0x0304,
+        0x0138,
+        0xa349,
+        0x640c,
+        0x2b64,
+        0x6064,
+        0x022c,
+        0x2b64,
+        0x2a6f,
+        0x640b,
+        0x0303,
+        0x2a6e,
+        0x640a,
+        0x0301,
+        0xa400,
+        0xa349,
+        0x9c01,
+        0x2370,
+        0x0208,
+        0x5819,
+        0x2e70,
+        0xa400,
+        0xa349,
+        0x0185,
+        0x6509,
+        0x001b,
+        0x650d,
+        0x0208,
+        0x5615,
+        0xa349,
+        0x0185,
+        0x6509,
+        0x001b,
+        0x6508,
+        0x0208,
+        0x5613,
+        0xa349,
+        0x0017,
+        0xa400,
+        0x581d,
+        0x0209,
+        0xa400,
+        0xa349,
+        0x5801,
+        0xa400,
+        0x580d,
+        0x5821,
+        0x2e6f,
+        0x0138,
+        0xa349,
+        0x7170,
+        0x5601,
+        0xa349,
+        0x0185,
+        0x6509,
+        0x5803,
+        0x7670,
+        0x0003,
+        0x562b,
+        0x2a6e,
+        0x640a,
+        0x0302,
+        0x2a6f,
+        0x640b,
+        0x0304,
+        0x0138,
+        0xa349,
+        0x5801,
+        0xa400,
+        0x5831,
+        0x2a6f,
+        0x640b,
+        0x0303,
+        0x2a6e,
+        0x640a,
+        0x0301,
+        0x0138,
+        0xa349,
+        0x5801,
+        0xa400,
+        0x0216,
+        0x2000,
+        0x0303,
+        0x0003,
+        0x0209,
+        0x2057,
+        0x0304,
+        0x0138,
+        0xa349,
+        0x5801,
+        0xa400,
+        0x001a,
+        0x560d,
+        0x0216,
+        0x2000,
+        0x2665,
+        0x030f,
+        0x2d6c,
+        0x2050,
+        0x0303,
+        0x0138,
+        0xa349,
+        0x5801,
+        0xa400,
+        0x001a,
+        0x570c,
+        0x0216,
+        0x2000,
+        0x2665,
+        0x030e,
+        0x2050,
+        0x0303,
+        0x6164,
+        0x2000,
+        0x0303,
+        0x0138,
+        0xa349,
+        0x5801,
+        0xa400,
+        0x58b8,
+        0x9c02,
+        0x583e,
+        0x001a,
+        0x7170,
+        0x3165,
+        0x2370,
+        0xa702,
+        0x2371,
+        0x2a66,
+        0x0205,
+        0x010c,
+        0x6164,
+        0x9503,
+        0x001f,
+        0x5607,
+        0x6071,
+        0x010e,
+        0x9110,
+        0x0023,
+        0x5602,
+        0x010e,
+        0x5626,
+        0x010e,
+        0x010c,
+        0x0021,
+        0x5603,
+        0x5937,
+        0x2c70,
+        0x560a,
+        0x0216,
+        0x2000,
+        0x0303,
+        0x2000,
+        0x0310,
+        0x2d6c,
+        0x0003,
+        0x2000,
+        0x2c70,
+        0x0301,
+        0x3165,
+        0x5950,
+        0x0304,
+        0x0000,
+        0x0217,
+        0x2a67,
+        0x0216,
+        0x2464,
+        0x6164,
+        0x0303,
+        0xa706,
+        0x0304,
+        0x2000,
+        0x2d67,
+        0x2d66,
+        0x2d66,
+        0x0301,
+        0x0301,
+        0x0301,
+        0x5a71,
+        0x5724,
+        0x7670,
+        0x0003,
+        0x0138,
+        0x9c00,
+        0x0000,
+        0x0003,
+        0x6164,
+        0x0309,
+        0x4e6c,
+        0x7171,
+        0xa702,
+        0x9201,
+        0x3165,
+        0x5365,
+        0x5617,
+        0x010c,
+        0x0208,
+        0x2464,
+        0x0003,
+        0x0000,
+        0x6064,
+        0x2055,
+        0x0303,
+        0x2464,
+        0x020a,
+        0x2d67,
+        0x0208,
+        0x2464,
+        0x0003,
+        0x020a,
+        0x3165,
+        0xa784,
+        0x2464,
+        0x9203,
+        0x3165,
+        0x0304,
+        0x0301,
+        0x560d,
+        0x0000,
+        0x0003,
+        0x2000,
+        0x0301,
+        0x2055,
+        0x2464,
+        0x020a,
+        0x0303,
+        0x0000,
+        0x0217,
+        0xa705,
+        0x0304,
+        0x0301,
+        0x7671,
+        0x0003,
+        0x0138,
+        0xa349,
+        0x5828,
+        0x2a65,
+        0x0185,
+        0x6508,
+        0x001b,
+        0x6508,
+        0x3165,
+        0x0300,
+        0x2366,
+        0x0003,
+        0x0209,
+        0x2d66,
+        0x2e65,
+        0x2d6f,
+        0x2e6e,
+        0xa400,
+        0xa349,
+        0x5817,
+        0x3165,
+        0x001b,
+        0x650d,
+        0x0185,
+        0x6508,
+        0x3165,
+        0x0300,
+        0x0003,
+        0x0209,
+        0xa400,
+        0xa349,
+        0x580b,
+        0x3165,
+        0x001b,
+        0x6508,
+        0x0185,
+        0x650d,
+        0x3165,
+        0x0300,
+        0x0003,
+        0x0212,
+        0x0003,
+        0xa400,
+        0x2a6e,
+        0x5821,
+        0x0304,
+        0x2a6f,
+        0x581e,
+        0x0138,
+        0xa349,
+        0x5814,
+        0x5821,
+        0x0003,
+        0x2a6f,
+        0x5817,
+        0x020b,
+        0x0300,
+        0x2a6e,
+        0x5813,
+        0x0303,
+        0xa400,
+        0x001a,
+        0x6508,
+        0x650d,
+        0x0184,
+        0x6505,
+        0x001a,
+        0x2210,
+        0x0023,
+        0x2210,
+        0x0138,
+        0x0184,
+        0x6505,
+        0x001a,
+        0x6505,
+        0x0023,
+        0x6505,
+        0x0138,
+        0x0017,
+        0x2210,
+        0x001a,
+        0x2210,
+        0x0185,
+        0x2210,
+        0x0138,
+        0x0003,
+        0x0211,
+        0x0138,
+        0xa700,
+        0x0138,
+        0xa701,
+        0x0138,
+        0xa349,
+        0x5835,
+        0x5801,
+        0xa400,
+        0x001b,
+        0x5709,
+        0x2000,
+        0x2d6e,
+        0x2a64,
+        0xa6d2,
+        0x0208,
+        0x2000,
+        0x2d6c,
+        0x0003,
+        0xa6c6,
+        0x6064,
+        0x0303,
+        0x0301,
+        0x2a65,
+        0x0231,
+        0x0302,
+        0x2053,
+        0xa6d2,
+        0x0303,
+        0x0302,
+        0x0209,
+        0x0138,
+        0xa349,
+        0x581a,
+        0x5801,
+        0xa400,
+        0x001b,
+        0x5722,
+        0x0183,
+        0x5726,
+        0x2000,
+        0x0303,
+        0x2000,
+        0x2d6e,
+        0x0311,
+        0x0138,
+        0xa349,
+        0x580c,
+        0x5801,
+        0xa400,
+        0x001b,
+        0x5732,
+        0x0183,
+        0x5732,
+        0x2000,
+        0x0303,
+        0x2000,
+        0x2d6e,
+        0x0310,
+        0x0138,
+        0x2a6e,
+        0x5944,
+        0x0188,
+        0x2210,
+        0x010e,
+        0x0138,
+        0xa349,
+        0x5907,
+        0x5954,
+        0x0017,
+        0xa400,
+        0x9c02,
+        0x2370,
+        0xa706,
+        0x2371,
+        0xa713,
+        0x9201,
+        0x2a6e,
+        0x001e,
+        0x6064,
+        0x0003,
+        0x0300,
+        0x2055,
+        0x0304,
+        0x2a70,
+        0x5065,
+        0x5625,
+        0x59df,
+        0xa7de,
+        0x9203,
+        0x2e6e,
+        0x2366,
+        0x020a,
+        0x0303,
+        0x6164,
+        0x2c65,
+        0x0217,
+        0x2d6e,
+        0x2009,
+        0x2d6e,
+        0xa708,
+        0x0301,
+        0x3165,
+        0x5065,
+        0x561f,
+        0x2000,
+        0x0303,
+        0x0208,
+        0x2000,
+        0x2d6e,
+        0x6064,
+        0x0303,
+        0x0003,
+        0x2a70,
+        0x0003,
+        0x0211,
+        0x0301,
+        0x2000,
+        0x2d6e,
+        0x0231,
+        0x0301,
+        0x2464,
+        0x0003,
+        0x560c,
+        0x2d6e,
+        0x2000,
+        0x0303,
+        0x0208,
+        0x2000,
+        0x2d6e,
+        0x0231,
+        0x0301,
+        0x2464,
+        0x2e6e,
+        0x0209,
+        0x2464,
+        0x010c,
+        0x536e,
+        0x5605,
+        0x5959,
+        0x0000,
+        0x2e70,
+        0x0208,
+        0x5609,
+        0xa701,
+        0x0000,
+        0x2c70,
+        0x2a66,
+        0x5970,
+        0x2566,
+        0x0302,
+        0x2e70,
+        0x0211,
+        0x3165,
+        0x2a66,
+        0x5992,
+        0x3165,
+        0x0304,
+        0x2366,
+        0x0304,
+        0x2a6e,
+        0x6064,
+        0x6064,
+        0x2c67,
+        0x2e67,
+        0xa6d2,
+        0x2464,
+        0x0302,
+        0xa704,
+        0x0304,
+        0x2d65,
+        0x0003,
+        0x6164,
+        0x0304,
+        0x0003,
+        0x0301,
+        0xa500,
+        0xa400,
+        0x5a71,
+        0x572b,
+        0x2214,
+        0x9c03,
+        0x3570,
+        0x010f,
+        0x2372,
+        0x6414,
+        0x0000,
+        0x0216,
+        0x6064,
+        0xa706,
+        0x0304,
+        0x2e71,
+        0x0301,
+        0x2d71,
+        0x2b70,
+        0x2a72,
+        0x0138,
+        0xa349,
+        0x582f,
+        0x0188,
+        0x6508,
+        0x2a6e,
+        0x0208,
+        0x2d65,
+        0x2c6e,
+        0x3165,
+        0x6164,
+        0x0231,
+        0x0302,
+        0x0209,
+        0xa400,
+        0xa349,
+        0x5821,
+        0x0202,
+        0x0021,
+        0x650d,
+        0x0183,
+        0x6508,
+        0x2a6e,
+        0x3165,
+        0x0310,
+        0xa400,
+        0xa349,
+        0x5816,
+        0x0201,
+        0x5801,
+        0xa400,
+        0x001a,
+        0x57e3,
+        0x0183,
+        0x57e3,
+        0x6164,
+        0x2a6e,
+        0x3165,
+        0x0311,
+        0x0138,
+        0xa349,
+        0x5808,
+        0x640c,
+        0x2a6e,
+        0x020a,
+        0x2a6e,
+        0x593d,
+        0xa701,
+        0x6400,
+        0xa400,
+        0x316e,
+        0x0184,
+        0x6505,
+        0x0185,
+        0x2210,
+        0x001b,
+        0x6508,
+        0x316e,
+        0x0138,
+        0xa349,
+        0x580a,
+        0x573a,
+        0xa349,
+        0x5807,
+        0x572f,
+        0xa349,
+        0x5804,
+        0x5727,
+        0xa349,
+        0x5801,
+        0x571c,
+        0x316e,
+        0x6411,
+        0x2d6f,
+        0x001a,
+        0x6508,
+        0x316e,
+        0x0138,
+        0xba70,
+        0x5602,
+        0x0100,
+        0x7170,
+        0xa74b,
+        0x9202,
+        0x2d76,
+        0x2375,
+        0x7173,
+        0x7171,
+        0x0138,
+        0x9c09,
+        0x3570,
+        0x3376,
+        0x590e,
+        0xa764,
+        0x2372,
+        0x204a,
+        0x2374,
+        0x2049,
+        0x7471,
+        0x013f,
+        0x2373,
+        0x2a76,
+        0x5374,
+        0x565f,
+        0x5173,
+        0x565d,
+        0x2a76,
+        0x5881,
+        0x2378,
+        0x2c71,
+        0x2377,
+        0x001d,
+        0x560c,
+        0x7672,
+        0x5607,
+        0x2a76,
+        0x5273,
+        0x5605,
+        0x2a74,
+        0x0183,
+        0x5601,
+        0x5653,
+        0x2a76,
+        0x2973,
+        0x560b,
+        0x7672,
+        0x5607,
+        0x2a76,
+        0x5074,
+        0x5605,
+        0x2a73,
+        0x0183,
+        0x5601,
+        0x5647,
+        0x2a76,
+        0x2874,
+        0x5858,
+        0x0017,
+        0x5638,
+        0x2a77,
+        0x2e65,
+        0x2378,
+        0x7573,
+        0x560b,
+        0x0205,
+        0x5075,
+        0x5608,
+        0x2a78,
+        0x001a,
+        0x5602,
+        0x2a75,
+        0x5602,
+        0x2a75,
+        0x0003,
+        0x2378,
+        0x2a76,
+        0x2377,
+        0x2c78,
+        0x2376,
+        0x7571,
+        0x5605,
+        0x001d,
+        0x5603,
+        0x2a77,
+        0x9205,
+        0x2376,
+        0x2a74,
+        0x0183,
+        0x560a,
+        0x2a73,
+        0x0183,
+        0x5607,
+        0xa513,
+        0x5601,
+        0x5604,
+        0x0301,
+        0x2000,
+        0x0303,
+        0x5611,
+        0x2a77,
+        0x2a76,
+        0x7470,
+        0x5603,
+        0xa503,
+        0x560b,
+        0x5606,
+        0x0302,
+        0x0205,
+        0xa701,
+        0x9201,
+        0x5265,
+        0x5603,
+        0x5a72,
+        0x575c,
+        0x6505,
+        0x2a76,
+        0x7470,
+        0x5615,
+        0x0138,
+        0x2a74,
+        0x0183,
+        0x560a,
+        0x2a73,
+        0x0183,
+        0x560a,
+        0x2a73,
+        0x2b74,
+        0x2000,
+        0x0303,
+        0x7172,
+        0x2376,
+        0x5769,
+        0x2a73,
+        0x2b64,
+        0x5704,
+        0x2a74,
+        0x2000,
+        0x0303,
+        0x5708,
+        0x0201,
+        0x2a70,
+        0xa701,
+        0x0302,
+        0x3371,
+        0x6515,
+        0xba70,
+        0x5663,
+        0x0100,
+        0xa701,
+        0x9203,
+        0x2b76,
+        0x5805,
+        0x2c78,
+        0xa701,
+        0x9103,
+        0x0303,
+        0x0138,
+        0xba70,
+        0x568a,
+        0x57d0,
+        0x5626,
+        0xa349,
+        0x5844,
+        0x001a,
+        0x6508,
+        0x526f,
+        0x6508,
+        0x2a6e,
+        0x640e,
+        0x2a6f,
+        0x2c66,
+        0x0303,
+        0x0209,
+        0x2a6f,
+        0x2a66,
+        0x0312,
+        0x0303,
+        0x2a6e,
+        0x2a66,
+        0x0300,
+        0x0303,
+        0xa400,
+        0xa349,
+        0x582f,
+        0x0202,
+        0x001b,
+        0x650d,
+        0x6064,
+        0x526f,
+        0x6508,
+        0x5812,
+        0x2a6e,
+        0x0400,
+        0xa400,
+        0xa349,
+        0x5823,
+        0x0201,
+        0x5801,
+        0xa400,
+        0x001a,
+        0x650f,
+        0x536f,
+        0x6510,
+        0x5805,
+        0xa701,
+        0x2c6e,
+        0xa6d8,
+        0x0400,
+        0x0138,
+        0x2a6f,
+        0x2c65,
+        0xa701,
+        0x2b66,
+        0x0138,
+        0xa349,
+        0x580f,
+        0x640c,
+        0x001b,
+        0x6508,
+        0x2a6e,
+        0x2d6f,
+        0xa701,
+        0x2c6e,
+        0x2d65,
+        0x020a,
+        0x3165,
+        0x6416,
+        0xa702,
+        0x6400,
+        0x2f6f,
+        0xa400,
+        0x2a6e,
+        0x6411,
+        0x2a6f,
+        0x0185,
+        0x2210,
+        0x0188,
+        0x6508,
+        0x001a,
+        0x6508,
+        0x010f,
+        0x0138,
+        0xa349,
+        0x5877,
+        0x5801,
+        0xa400,
+        0x010c,
+        0x2a6f,
+        0x0208,
+        0x2d6f,
+        0x2a6e,
+        0x2d66,
+        0x2366,
+        0x0208,
+        0x2d6e,
+        0x0301,
+        0x3165,
+        0x2b6f,
+        0x0208,
+        0x2a6e,
+        0x2b6f,
+        0x0303,
+        0x0302,
+        0x2000,
+        0x0303,
+        0x2000,
+        0x2d6e,
+        0x2a6f,
+        0x2d6c,
+        0x030d,
+        0x0302,
+        0x0209,
+        0x3165,
+        0x0304,
+        0x0138,
+        0xa349,
+        0x5856,
+        0x001b,
+        0x650d,
+        0x0183,
+        0x6508,
+        0x2d6e,
+        0x2b6f,
+        0x2a6f,
+        0x3165,
+        0x0304,
+        0x2000,
+        0x2d6f,
+        0x2000,
+        0x2d6e,
+        0xa6c6,
+        0x0400,
+        0xa400,
+        0xa349,
+        0x5844,
+        0x5801,
+        0xa400,
+        0x001b,
+        0x650f,
+        0x0183,
+        0x6510,
+        0x2d6e,
+        0x0000,
+        0x2b6f,
+        0x0304,
+        0x2000,
+        0x2d6f,
+        0x2000,
+        0x2d6e,
+        0x2a66,
+        0x0400,
+        0x0138,
+        0xa349,
+        0x5831,
+        0x5803,
+        0xa700,
+        0x6400,
+        0xa400,
+        0x9c03,
+        0x2370,
+        0x6414,
+        0x2a6e,
+        0x0023,
+        0x6064,
+        0x020b,
+        0x2a6f,
+        0x0023,
+        0x6064,
+        0x020b,
+        0x3571,
+        0x0301,
+        0xa702,
+        0x3165,
+        0x0304,
+        0x2a65,
+        0x0216,
+        0xa703,
+        0x0302,
+        0xa706,
+        0x0304,
+        0x2a65,
+        0x2b65,
+        0x020a,
+        0x2d67,
+        0x2e66,
+        0xa702,
+        0x2e67,
+        0xa703,
+        0x0304,
+        0x0003,
+        0x2b66,
+        0xa705,
+        0xa706,
+        0x0304,
+        0x0301,
+        0x3a71,
+        0x0302,
+        0x0303,
+        0x0302,
+        0x2b64,
+        0x0209,
+        0x2a70,
+        0x0138,
+        0x2a6e,
+        0x640b,
+        0x2a6f,
+        0x640b,
+        0x010f,
+        0x0138,
+        0xa349,
+        0x58b8,
+        0x7670,
+        0x6517,
+        0x5801,
+        0xa400,
+        0x0216,
+        0x2000,
+        0x2d6e,
+        0x0231,
+        0x2000,
+        0x2b6c,
+        0x236d,
+        0x0231,
+        0x3165,
+        0x0302,
+        0x3165,
+        0x2e6e,
+        0x0211,
+        0x2d6d,
+        0x0302,
+        0x0209,
+        0x2055,
+        0x2d6e,
+        0x020a,
+        0x0304,
+        0x0138,
+        0xa349,
+        0x0003,
+        0x5601,
+        0xa349,
+        0x589a,
+        0x7670,
+        0x6518,
+        0x5802,
+        0xa400,
+        0x0003,
+        0x0183,
+        0x5624,
+        0x0017,
+        0x5625,
+        0x001c,
+        0x561c,
+        0x0216,
+        0x0021,
+        0x560c,
+        0x2a6e,
+        0x3165,
+        0x2b6e,
+        0x0304,
+        0x2000,
+        0x2d6e,
+        0x2000,
+        0x3166,
+        0x0400,
+        0x2000,
+        0x0303,
+        0x0138,
+        0x0000,
+        0x2b6e,
+        0x0304,
+        0x2000,
+        0x0000,
+        0x2d6e,
+        0x3166,
+        0x0400,
+        0x2000,
+        0x0303,
+        0x0003,
+        0x2b6c,
+        0x0138,
+        0x591c,
+        0x0003,
+        0x6164,
+        0x0138,
+        0x001a,
+        0x650f,
+        0x6510,
+        0x2000,
+        0x0138,
+        0xa349,
+        0x5868,
+        0x640c,
+        0x7670,
+        0x5662,
+        0x0017,
+        0x6504,
+        0x9c02,
+        0x0000,
+        0x0003,
+        0x6164,
+        0x0309,
+        0x4e6c,
+        0x7170,
+        0x2370,
+        0x2a6e,
+        0x020a,
+        0xa707,
+        0x2371,
+        0x0301,
+        0x2a6e,
+        0x0003,
+        0x0300,
+        0xa704,
+        0x0304,
+        0x2368,
+        0x2a70,
+        0x5265,
+        0x5613,
+        0x2a6e,
+        0x2464,
+        0x0303,
+        0x2055,
+        0x2a6c,
+        0x2000,
+        0x0216,
+        0x6064,
+        0x0301,
+        0x0304,
+        0x020a,
+        0x0303,
+        0x2a6e,
+        0x032a,
+        0x2a6e,
+        0x020a,
+        0x3165,
+        0x0304,
+        0x560b,
+        0x6419,
+        0x0216,
+        0x2009,
+        0x2d6e,
+        0x020b,
+        0x6164,
+        0x0303,
+        0x2e6e,
+        0x0212,
+        0x2d6e,
+        0x020a,
+        0x010c,
+        0x0216,
+        0x0021,
+        0x5604,
+        0x316c,
+        0x596c,
+        0x2c70,
+        0x560e,
+        0x0000,
+        0x2b6e,
+        0x0304,
+        0x2000,
+        0x0000,
+        0x2d6e,
+        0x3166,
+        0x0400,
+        0x2000,
+        0x0303,
+        0x0003,
+        0x2000,
+        0x2c70,
+        0x0301,
+        0x2a67,
+        0x599c,
+        0x0304,
+        0x0000,
+        0x2d67,
+        0x2a6e,
+        0x6164,
+        0x0303,
+        0x2a67,
+        0x0216,
+        0x2b6e,
+        0x2464,
+        0x0304,
+        0x6064,
+        0x0304,
+        0x0003,
+        0x0301,
+        0xa500,
+        0x5603,
+        0x5a71,
+        0x572a,
+        0x2214,
+        0x7470,
+        0x0003,
+        0xa400,
+        0x2a6e,
+        0x0183,
+        0x5603,
+        0x640b,
+        0x010e,
+        0x0138,
+        0x001a,
+        0x2210,
+        0x7170,
+        0x5705,
+        0xa34a,
+        0x9c06,
+        0x583c,
+        0x2a70,
+        0x2468,
+        0x2b64,
+        0x236b,
+        0x5623,
+        0xa34a,
+        0x9c06,
+        0x5834,
+        0x5652,
+        0xa34a,
+        0x9c06,
+        0x5830,
+        0x2a70,
+        0x2474,
+        0x564c,
+        0xa34a,
+        0x9c06,
+        0xa700,
+        0x5605,
+        0xa34b,
+        0x9c06,
+        0x2a66,
+        0x0185,
+        0x565c,
+        0x2372,
+        0x6164,
+        0x001b,
+        0x5658,
+        0x010e,
+        0x581e,
+        0x2a72,
+        0x2469,
+        0xa703,
+        0x0301,
+        0x2c70,
+        0x2368,
+        0x2a72,
+        0x6164,
+        0x2c70,
+        0x2374,
+        0x7170,
+        0x6175,
+        0x7172,
+        0x562f,
+        0xa34a,
+        0x9c06,
+        0x580d,
+        0x2a70,
+        0x2368,
+        0x6175,
+        0x5628,
+        0xa34a,
+        0x9c06,
+        0x5806,
+        0x2a70,
+        0x2474,
+        0xa702,
+        0x2369,
+        0x2375,
+        0x561f,
+        0xa233,
+        0x3570,
+        0x0185,
+        0x5634,
+        0x2a71,
+        0x0188,
+        0x5631,
+        0x001a,
+        0x562f,
+        0x0017,
+        0x5632,
+        0x9203,
+        0x0024,
+        0x562a,
+        0x236d,
+        0xa701,
+        0x2373,
+        0x9103,
+        0x5065,
+        0x5624,
+        0xa702,
+        0x246d,
+        0x236b,
+        0xa701,
+        0x236a,
+        0x2369,
+        0x2a70,
+        0x2374,
+        0x2b64,
+        0x2368,
+        0x0138,
+        0x2a71,
+        0x001e,
+        0x5614,
+        0x2a74,
+        0x2d68,
+        0x2a73,
+        0x2d69,
+        0x0302,
+        0x3174,
+        0x2373,
+        0x7572,
+        0x5603,
+        0x616a,
+        0x2a6a,
+        0x2774,
+        0x7570,
+        0x5602,
+        0x2a6b,
+        0x2468,
+        0x2a75,
+        0x2469,
+        0x5b6d,
+        0x5716,
+        0x2a74,
+        0xa400,
+        0x756b,
+        0x2201,
+        0x2023,
+        0x010c,
+        0xa400,
+        0xa701,
+        0xa400,
+        0xa700,
+        0xa400,
+        0x756b,
+        0x2205,
+        0x2049,
+        0x010c,
+        0x0138,
+        0x5905,
+        0xa400,
+        0x756b,
+        0x2204,
+        0x204a,
+        0x010c,
+        0x0138,
+        0x5905,
+        0xa400,
+        0xa388,
+        0xa701,
+        0xa700,
+        0xa400,
+        0x019f,
+        0x560b,
+        0x01bc,
+        0x5609,
+        0xa349,
+        0xa710,
+        0x0210,
+        0xa73f,
+        0x0302,
+        0x5165,
+        0x2201,
+        0x3165,
+        0x5601,
+        0xa349,
+        0x0201,
+        0x0022,
+        0x560a,
+        0x0183,
+        0x2201,
+        0x0186,
+        0x6164,
+        0x0189,
+        0x6164,
+        0x0186,
+        0xa400,
+        0x6164,
+        0x5704,
+        0xa702,
+        0xa400,
+        0xa359,
+        0x028b,
+        0x2a6c,
+        0x028c,
+        0x2a6c,
+        0x028d,
+        0xa400,
+        0xa34a,
+        0x0280,
+        0x3165,
+        0x0280,
+        0x0302,
+        0xa400,
+        0xa34a,
+        0x0188,
+        0x5747,
+        0x3165,
+        0x0280,
+        0x0301,
+        0x0281,
+        0xa400,
+        0x0014,
+        0x580e,
+        0x5812,
+        0x561e,
+        0x580b,
+        0x5620,
+        0x5809,
+        0x581e,
+        0x5626,
+        0x5806,
+        0x5629,
+        0x5804,
+        0x5827,
+        0x561e,
+        0x5801,
+        0x561c,
+        0x5806,
+        0x5820,
+        0x5815,
+        0x5810,
+        0x5615,
+        0xa11d,
+        0x5601,
+        0xa21d,
+        0xa215,
+        0x0138,
+        0xa236,
+        0x5601,
+        0xa136,
+        0xa237,
+        0x0138,
+        0xa236,
+        0xa137,
+        0x0138,
+        0xa13f,
+        0x0138,
+        0xa23f,
+        0x0138,
+        0xa12f,
+        0x0138,
+        0xa22f,
+        0x0138,
+        0xa234,
+        0x5601,
+        0xa134,
+        0xa235,
+        0x0138,
+        0xa234,
+        0xa135,
+        0x0138,
+        0xa21e,
+        0x0138,
+        0xa11e,
+        0x0138,
+        0xa21f,
+        0x0138,
+        0xa11f,
+        0x0138,
+        0xa222,
+        0xa223,
+        0x0138,
+        0xa122,
+        0x5703,
+        0xa222,
+        0x5601,
+        0xa122,
+        0xa123,
+        0x0138,
+        0xa121,
+        0x0138,
+        0xa221,
+        0x0138,
+        0xa21c,
+        0x5601,
+        0xa11c,
+        0xa215,
+        0x0138,
+        0xa204,
+        0x5601,
+        0xa104,
+        0xa205,
+        0x0138,
+        0xa204,
+        0xa105,
+        0x0138,
+        0xa233,
+        0x0138,
+        0xa133,
+        0x0138,
+        0xa132,
+        0x0138,
+        0xa232,
+        0x0138,
+        0x0174,
+        0x581f,
+        0x4462,
+        0x4479,
+        0x5820,
+        0xfa50,
+        0x7561,
+        0x446c,
+        0x4469,
+        0x581b,
+        0xfa57,
+        0x6c61,
+        0xfa74,
+        0x7265,
+        0x5816,
+        0xfa4d,
+        0x7261,
+        0xfa63,
+        0x7375,
+        0x5811,
+        0xfa4e,
+        0x6965,
+        0x446c,
+        0x580d,
+        0xfa26,
+        0x6d20,
+        0xfa6f,
+        0x6572,
+        0x5808,
+        0x5803,
+        0x0101,
+        0x8d08,
+        0x0138,
+        0xfa57,
+        0x2050,
+        0xfa33,
+        0x5334,
+        0x0175,
+        0x8d08,
+        0x0174,
+        0x0138,
+        0xa349,
+        0x2046,
+        0x3165,
+        0x0300,
+        0x2a6c,
+        0x020c,
+        0x2e65,
+        0x0302,
+        0x204f,
+        0x0303,
+        0xa400,
+        0xa3c9,
+        0x2146,
+        0x3f66,
+        0x0600,
+        0x3a6c,
+        0x050c,
+        0x3e66,
+        0x0602,
+        0x214f,
+        0x0603,
+        0xa400,
+        0xa35b,
+        0xa233,
+        0x2b64,
+        0x3166,
+        0x0017,
+        0x2212,
+        0x2b64,
+        0x2368,
+        0x2a65,
+        0x0603,
+        0x236b,
+        0x001a,
+        0x560a,
+        0x020a,
+        0xa632,
+        0x001d,
+        0x58aa,
+        0x0302,
+        0x0018,
+        0x2765,
+        0x2e68,
+        0x336b,
+        0xa400,
+        0x0205,
+        0x020a,
+        0x2e68,
+        0x2a66,
+        0x2e68,
+        0x0003,
+        0x717c,
+        0x336b,
+        0xa403,
+        0xa349,
+        0x0188,
+        0x2201,
+        0x001b,
+        0x2201,
+        0x236d,
+        0x2464,
+        0x5811,
+        0x2464,
+        0x0205,
+        0xa400,
+        0xa349,
+        0x0188,
+        0x2201,
+        0x001a,
+        0x2201,
+        0x0017,
+        0x560f,
+        0x001e,
+        0x560f,
+        0x018a,
+        0x5609,
+        0x236d,
+        0x5801,
+        0xa400,
+        0x6064,
+        0x0003,
+        0x580f,
+        0x2d6d,
+        0x0003,
+        0x0138,
+        0xa700,
+        0xa400,
+        0xa701,
+        0xa400,
+        0x2000,
+        0x0003,
+        0xa400,
+        0xa349,
+        0x0017,
+        0x5705,
+        0x5801,
+        0xa400,
+        0x9c08,
+        0x2371,
+        0x2377,
+        0x2000,
+        0x5200,
+        0x5614,
+        0xa701,
+        0x3165,
+        0x0302,
+        0x2371,
+        0x580f,
+        0xa701,
+        0x0223,
+        0x2d77,
+        0x0220,
+        0x0303,
+        0x2055,
+        0x2765,
+        0x2464,
+        0x2a77,
+        0x0300,
+        0x0303,
+        0x3171,
+        0x0230,
+        0x2d71,
+        0x0138,
+        0xa716,
+        0x747b,
+        0x2464,
+        0x2370,
+        0x2373,
+        0x582f,
+        0x2374,
+        0x2375,
+        0x0003,
+        0x2376,
+        0xa700,
+        0x2a75,
+        0x2a70,
+        0x2a71,
+        0x0003,
+        0x0300,
+        0x0303,
+        0x2a76,
+        0x0003,
+        0x2376,
+        0x0303,
+        0x0301,
+        0x2a70,
+        0x0000,
+        0x2465,
+        0x2665,
+        0x0302,
+        0x2d74,
+        0x2a73,
+        0x0216,
+        0x2a70,
+        0x6064,
+        0x0216,
+        0x0302,
+        0x2464,
+        0x0304,
+        0x2374,
+        0x2475,
+        0x3165,
+        0x5a70,
+        0x571d,
+        0x2e75,
+        0xa702,
+        0x0208,
+        0xa701,
+        0x2c71,
+        0x0303,
+        0x0212,
+        0x0304,
+        0x0138,
+        0xa349,
+        0x5801,
+        0xa400,
+        0x0017,
+        0x0138,
+        0x001a,
+        0x5603,
+        0x010e,
+        0xa701,
+        0x0138,
+        0x010e,
+        0xa701,
+        0x0003,
+        0x0138,
+        0xa3ca,
+        0x0604,
+        0x560b,
+        0xa3c9,
+        0x0206,
+        0x3165,
+        0x0206,
+        0x5609,
+        0xa3c9,
+        0x0200,
+        0x3165,
+        0x0200,
+        0x5604,
+        0xa3c9,
+        0x0204,
+        0x3165,
+        0x0204,
+        0x3165,
+        0xa400,
+        0xa3c9,
+        0x5801,
+        0xa400,
+        0x3165,
+        0x0003,
+        0x3165,
+        0x0138,
+        0xa3c9,
+        0x6164,
+        0x0530,
+        0xa400,
+        0xa3c9,
+        0x0185,
+        0x5611,
+        0x0017,
+        0x5608,
+        0xa641,
+        0x0185,
+        0x5612,
+        0x0017,
+        0x5607,
+        0x0505,
+        0x0604,
+        0xa400,
+        0x3165,
+        0x5937,
+        0x3165,
+        0xa400,
+        0x3165,
+        0x593b,
+        0xa400,
+        0x593d,
+        0x3165,
+        0x0185,
+        0x6505,
+        0x013f,
+        0x570a,
+        0x5943,
+        0xa700,
+        0xa400,
+        0xa3ca,
+        0x5926,
+        0x5602,
+        0xa3ca,
+        0x3367,
+        0x0603,
+        0xa700,
+        0x3165,
+        0xa400,
+        0xa3c9,
+        0x3d64,
+        0xa400,
+        0xa3c9,
+        0x3d64,
+        0x3d6c,
+        0xa400,
+        0xa3c9,
+        0x5801,
+        0xa400,
+        0x0003,
+        0x3165,
+        0x581b,
+        0x3165,
+        0x0003,
+        0x0138,
+        0xa3c9,
+        0x5907,
+        0x0538,
+        0x2056,
+        0x0301,
+        0xa400,
+        0xa3c9,
+        0x2a64,
+        0x0003,
+        0x2a66,
+        0x6164,
+        0x0508,
+        0x2a66,
+        0xa701,
+        0x2c69,
+        0x0508,
+        0x0602,
+        0x2000,
+        0xa700,
+        0x0603,
+        0xa400,
+        0xa3c9,
+        0x5801,
+        0xa400,
+        0x001d,
+        0x5602,
+        0x7170,
+        0x0538,
+        0x010d,
+        0x3d64,
+        0x6164,
+        0x050a,
+        0x0601,
+        0x0508,
+        0x7470,
+        0x0538,
+        0x0138,
+        0xa3c9,
+        0x010d,
+        0x6164,
+        0x050a,
+        0x3f66,
+        0x6064,
+        0x050a,
+        0x0603,
+        0x0601,
+        0x0508,
+        0xa400,
+        0xa3c9,
+        0xa801,
+        0x3f66,
+        0x0602,
+        0x3a6c,
+        0x6164,
+        0x3f66,
+        0x0604,
+        0x0508,
+        0x2100,
+        0x0603,
+        0xa400,
+        0xa3ca,
+        0x0508,
+        0x3f66,
+        0x0508,
+        0x3f66,
+        0x0604,
+        0xa400,
+        0xa3c9,
+        0x0508,
+        0x2152,
+        0x5603,
+        0xa3c9,
+        0x0508,
+        0x2154,
+        0x0603,
+        0xa400,
+        0xa3c9,
+        0xa80a,
+        0x5602,
+        0xa3c9,
+        0xa802,
+        0x3f66,
+        0x0600,
+        0xa400,
+        0xa3c9,
+        0x2100,
+        0x0603,
+        0x0509,
+        0x3a6c,
+        0x3165,
+        0x0003,
+        0x0520,
+        0xa702,
+        0xa700,
+        0x0603,
+        0x0538,
+        0x0603,
+        0xa400,
+        0xa3c9,
+        0x010d,
+        0x0505,
+        0x0301,
+        0xa701,
+        0x9204,
+        0x5265,
+        0x5604,
+        0x010f,
+        0x6164,
+        0x0508,
+        0xa400,
+        0x9c01,
+        0x010f,
+        0xa808,
+        0x2370,
+        0x6164,
+        0x020b,
+        0x0604,
+        0xa700,
+        0x2a70,
+        0x020b,
+        0x0602,
+        0x0603,
+        0x6070,
+        0xa700,
+        0x2a70,
+        0x020b,
+        0x0601,
+        0x0603,
+        0x5e70,
+        0x570c,
+        0xa400,
+        0x236c,
+        0x013f,
+        0x6164,
+        0x0138,
+        0xa34a,
+        0x0304,
+        0x0204,
+        0xa400 };
+const unsigned short int xrom_size = sizeof(xrom) / sizeof(const s_opcode);
@@ -0,0 +1,180 @@
+
+// XROM XLBL source step addresses.
+
+#ifndef XLBL_LABELS_H
+#define XLBL_LABELS_H
+
+#define XROM_2DERIV           585
+#define XROM_AGM              875
+#define XROM_Bn               2888
+#define XROM_Bn_star          2877
+#define XROM_CDFU_BINOMIAL    2110
+#define XROM_CDFU_CAUCHY      1152
+#define XROM_CDFU_CHI2        1684
+#define XROM_CDFU_EXPON       1195
+#define XROM_CDFU_F           2203
+#define XROM_CDFU_GEOM        1237
+#define XROM_CDFU_LOGIT       1308
+#define XROM_CDFU_LOGNORMAL   1354
+#define XROM_CDFU_NORMAL      1381
+#define XROM_CDFU_POIS2       1910
+#define XROM_CDFU_POISSON     1863
+#define XROM_CDFU_Q           1420
+#define XROM_CDFU_T           2324
+#define XROM_CDFU_WEIB        1583
+#define XROM_CDF_BINOMIAL     2122
+#define XROM_CDF_CAUCHY       1155
+#define XROM_CDF_CHI2         1698
+#define XROM_CDF_EXPON        1205
+#define XROM_CDF_F            2221
+#define XROM_CDF_GEOM         1249
+#define XROM_CDF_LOGIT        1316
+#define XROM_CDF_LOGNORMAL    1361
+#define XROM_CDF_NORMAL       1384
+#define XROM_CDF_POIS2        1913
+#define XROM_CDF_POISSON      1874
+#define XROM_CDF_Q            1433
+#define XROM_CDF_T            2327
+#define XROM_CDF_WEIB         1595
+#define XROM_CPX_AGM          891
+#define XROM_CPX_COMB         905
+#define XROM_CPX_FIB          2834
+#define XROM_CPX_I            2635
+#define XROM_CPX_PARL         839
+#define XROM_CPX_PERM         902
+#define XROM_CPX_W0           1023
+#define XROM_CPX_W_INVERSE    1051
+#define XROM_ChebychevTn      2501
+#define XROM_ChebychevUn      2505
+#define XROM_DATE_ADD         2681
+#define XROM_DATE_DELTA       2675
+#define XROM_DATE_TO          2668
+#define XROM_DEGREES          2715
+#define XROM_DERIV            655
+#define XROM_D_DMY            2731
+#define XROM_D_MDY            2736
+#define XROM_D_YMD            2733
+#define XROM_E3OFF            2741
+#define XROM_E3ON             2739
+#define XROM_ERF              1124
+#define XROM_ERFC             1116
+#define XROM_FIB              2823
+#define XROM_FIXENG           2763
+#define XROM_FIXSCI           2761
+#define XROM_F_DENANY         2766
+#define XROM_F_DENFAC         2771
+#define XROM_F_DENFIX         2768
+#define XROM_GRADIANS         2720
+#define XROM_HIDE_Y_REG       2780
+#define XROM_HR12             2727
+#define XROM_HR24             2729
+#define XROM_HermiteH         2547
+#define XROM_HermiteHe        2540
+#define XROM_IDIV             3229
+#define XROM_IM_LZOFF         2759
+#define XROM_IM_LZON          2757
+#define XROM_INTEGRATE        322
+#define XROM_ISGN_1C          2750
+#define XROM_ISGN_2C          2747
+#define XROM_ISGN_SM          2754
+#define XROM_ISGN_UN          2752
+#define XROM_JG1582           2723
+#define XROM_JG1752           2725
+#define XROM_LaguerreLn       2511
+#define XROM_LaguerreLnA      2515
+#define XROM_LegendrePn       2493
+#define XROM_MARGIN           859
+#define XROM_NEXTPRIME        2639
+#define XROM_PARL             829
+#define XROM_PDF_BINOMIAL     2089
+#define XROM_PDF_CAUCHY       1141
+#define XROM_PDF_CHI2         1657
+#define XROM_PDF_EXPON        1186
+#define XROM_PDF_F            2170
+#define XROM_PDF_GEOM         1225
+#define XROM_PDF_LOGIT        1297
+#define XROM_PDF_LOGNORMAL    1347
+#define XROM_PDF_NORMAL       1374
+#define XROM_PDF_POIS2        1907
+#define XROM_PDF_POISSON      1849
+#define XROM_PDF_Q            1409
+#define XROM_PDF_T            2297
+#define XROM_PDF_WEIB         1566
+#define XROM_PERCENT          847
+#define XROM_PERCHG           851
+#define XROM_PERMARGIN        869
+#define XROM_PERMMR           863
+#define XROM_PERTOT           856
+#define XROM_PRODUCT          797
+#define XROM_QF_BINOMIAL      2142
+#define XROM_QF_CAUCHY        1173
+#define XROM_QF_CHI2          1718
+#define XROM_QF_EXPON         1216
+#define XROM_QF_F             2240
+#define XROM_QF_GEOM          1269
+#define XROM_QF_LOGIT         1334
+#define XROM_QF_LOGNORMAL     1368
+#define XROM_QF_NORMAL        1398
+#define XROM_QF_POIS2         1916
+#define XROM_QF_POISSON       1888
+#define XROM_QF_Q             1448
+#define XROM_QF_T             2377
+#define XROM_QF_WEIB          1614
+#define XROM_QUAD             2845
+#define XROM_RADIANS          2717
+#define XROM_RADIX_COM        2710
+#define XROM_RADIX_DOT        2712
+#define XROM_SEPOFF           2745
+#define XROM_SEPON            2743
+#define XROM_SETCHN           2700
+#define XROM_SETEUR           2690
+#define XROM_SETIND           2698
+#define XROM_SETJAP           2703
+#define XROM_SETUK            2693
+#define XROM_SETUSA           2695
+#define XROM_SHOW_Y_REG       2778
+#define XROM_SIGMA            764
+#define XROM_SIGN             2996
+#define XROM_SOLVE            19
+#define XROM_STACK_4_LEVEL    2774
+#define XROM_STACK_8_LEVEL    2776
+#define XROM_START            1
+#define XROM_W0               923
+#define XROM_W1               929
+#define XROM_WHO              2782
+#define XROM_W_INVERSE        1047
+#define XROM_ZETA             2915
+#define XROM_beta             1055
+#define XROM_cpx_ACOS         3094
+#define XROM_cpx_ACOSH        3131
+#define XROM_cpx_ASIN         3085
+#define XROM_cpx_ASINH        3115
+#define XROM_cpx_ATAN         3100
+#define XROM_cpx_ATANH        3142
+#define XROM_cpx_CONJ         3029
+#define XROM_cpx_CROSS        3072
+#define XROM_cpx_DOT          3069
+#define XROM_cpx_EXPM1        3178
+#define XROM_cpx_FACT         3036
+#define XROM_cpx_FRAC         3018
+#define XROM_cpx_IDIV         3010
+#define XROM_cpx_LN1P         3192
+#define XROM_cpx_LOG10        3161
+#define XROM_cpx_LOG2         3165
+#define XROM_cpx_LOGXY        3154
+#define XROM_cpx_POW10        3170
+#define XROM_cpx_POW2         3173
+#define XROM_cpx_ROUND        3013
+#define XROM_cpx_SIGN         3040
+#define XROM_cpx_TRUNC        3023
+#define XROM_cpx_beta         1065
+#define XROM_cpx_gd           1092
+#define XROM_cpx_inv_gd       1106
+#define XROM_cpx_lnbeta       1075
+#define XROM_cpx_x2           3078
+#define XROM_cpx_x3           3081
+#define XROM_gd               1085
+#define XROM_int_ULP          3225
+#define XROM_inv_gd           1096
+
+#endif // XLBL_LABELS_H
@@ -0,0 +1,32 @@
+
+// XROM virtual LBL target step addresses.
+
+const unsigned short int xrom_targets[] = {
+	1937, // virtual LBL 00
+	2999, // virtual LBL 01
+	582, // virtual LBL 02
+	580, // virtual LBL 03
+	2626, // virtual LBL 04
+	2612, // virtual LBL 05
+	3088, // virtual LBL 06
+	1436, // virtual LBL 07
+	2619, // virtual LBL 08
+	1626, // virtual LBL 09
+	1647, // virtual LBL 10
+	1643, // virtual LBL 11
+	1636, // virtual LBL 12
+	2617, // virtual LBL 13
+	1650, // virtual LBL 14
+	1653, // virtual LBL 15
+	1655, // virtual LBL 16
+	1629, // virtual LBL 17
+	1879, // virtual LBL 18
+	2127, // virtual LBL 19
+	1515, // virtual LBL 20
+	1284, // virtual LBL 21
+	1833, // virtual LBL 22
+	1410, // virtual LBL 23
+	1434, // virtual LBL 24
+	1516  // virtual LBL 25
+}; // xrom_targets[]
+